@@ -42,6 +42,14 @@ MACRO (MYSQL_USE_BUNDLED_LZ4)
   INCLUDE_DIRECTORIES(BEFORE SYSTEM ${CMAKE_SOURCE_DIR}/extra/lz4)
 
   IF (MYSQL_SOURCE_DIR AND MYSQL_BUILD_DIR)
+    # lz4frame.h is needed by the storage library
+    FILE(GLOB_RECURSE LZ4_INCLUDE_FILE ${MYSQL_SOURCE_DIR}/extra/lz4/*/lz4frame.h)
+    IF (LZ4_INCLUDE_FILE)
+      LIST(GET LZ4_INCLUDE_FILE 0 LZ4_INCLUDE_FILE)
+      GET_FILENAME_COMPONENT(LZ4_INCLUDE_DIR ${LZ4_INCLUDE_FILE} DIRECTORY)
+      INCLUDE_DIRECTORIES(BEFORE SYSTEM ${LZ4_INCLUDE_DIR})
+    ENDIF()
+
     IF (WIN32)
       find_file(LZ4_LIBRARY NAMES "lz4_lib.lib" PATHS "${MYSQL_BUILD_DIR}/${CMAKE_BUILD_TYPE}" "${MYSQL_BUILD_DIR}/utilities/${CMAKE_BUILD_TYPE}" "${MYSQL_BUILD_DIR}/archive_output_directory/${CMAKE_BUILD_TYPE}" NO_DEFAULT_PATH)
     ELSE()
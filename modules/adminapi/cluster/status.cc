@@ -26,8 +26,10 @@
 #include "modules/adminapi/cluster/status.h"
 
 #include <algorithm>
+#include <exception>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "modules/adminapi/cluster/api_options.h"
 #include "modules/adminapi/cluster_set/cluster_set_impl.h"
@@ -35,11 +37,13 @@
 #include "modules/adminapi/common/common.h"
 #include "modules/adminapi/common/common_status.h"
 #include "modules/adminapi/common/dba_errors.h"
+#include "modules/adminapi/common/instance_pool.h"
 #include "modules/adminapi/common/metadata_storage.h"
 #include "modules/adminapi/common/parallel_applier_options.h"
 #include "modules/adminapi/common/server_features.h"
 #include "modules/adminapi/common/sql.h"
 #include "mysqlshdk/include/scripting/types.h"
+#include "mysqlshdk/include/shellcore/shell_init.h"
 #include "mysqlshdk/libs/mysql/async_replication.h"
 #include "mysqlshdk/libs/mysql/clone.h"
 #include "mysqlshdk/libs/mysql/group_replication.h"
@@ -47,6 +51,8 @@
 #include "mysqlshdk/libs/utils/debug.h"
 #include "mysqlshdk/libs/utils/logger.h"
 #include "mysqlshdk/libs/utils/options.h"
+#include "mysqlshdk/libs/utils/profiling.h"
+#include "mysqlshdk/libs/utils/threads.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
 namespace mysqlsh {
@@ -122,6 +128,8 @@ inline bool set_ts(shcore::Dictionary_t dict, const std::string &prop,
   return false;
 }
 
+constexpr std::size_t k_max_parallel_members = 16;
+
 }  // namespace
 
 Status::Status(const std::shared_ptr<Cluster_impl> &cluster,
@@ -131,19 +139,57 @@ Status::Status(const std::shared_ptr<Cluster_impl> &cluster,
 Status::~Status() = default;
 
 void Status::connect_to_members() {
-  auto ipool = current_ipool();
+  struct Connection {
+    const Instance_metadata *md = nullptr;
+    std::shared_ptr<Instance> instance;
+    std::string error;
+    double elapsed = 0.0;
+  };
+
+  std::vector<Connection> connections;
+  connections.reserve(m_instances.size());
 
   for (const auto &inst : m_instances) {
-    try {
-      if (inst.instance_type == Instance_type::READ_REPLICA) {
-        m_read_replica_sessions[inst.endpoint] =
-            ipool->connect_unchecked_endpoint(inst.endpoint);
-      } else {
-        m_member_sessions[inst.endpoint] =
-            ipool->connect_unchecked_endpoint(inst.endpoint);
-      }
-    } catch (const shcore::Error &e) {
-      m_member_connect_errors[inst.endpoint] = e.format();
+    connections.emplace_back().md = &inst;
+  }
+
+  // pool guards its entries, it can be used by all the workers
+  const auto ipool = current_ipool();
+
+  // members are slow to respond when they are unreachable, connect to all of
+  // them at once instead of waiting for each one in turn
+  mysqlshdk::utils::map_reduce<bool, bool>(
+      connections.begin(), connections.end(),
+      [&ipool](Connection &c) {
+        mysqlsh::Mysql_thread thdinit;
+        mysqlshdk::utils::Duration duration;
+
+        duration.start();
+
+        try {
+          c.instance = ipool->connect_unchecked_endpoint(c.md->endpoint);
+        } catch (const shcore::Error &e) {
+          c.error = e.format();
+        }
+
+        duration.finish();
+        c.elapsed = duration.seconds_elapsed();
+
+        return true;
+      },
+      [](bool, bool) { return true; }, k_max_parallel_members);
+
+  for (auto &c : connections) {
+    const auto &endpoint = c.md->endpoint;
+
+    m_member_connect_times[endpoint] = c.elapsed;
+
+    if (!c.instance) {
+      m_member_connect_errors[endpoint] = std::move(c.error);
+    } else if (c.md->instance_type == Instance_type::READ_REPLICA) {
+      m_read_replica_sessions[endpoint] = std::move(c.instance);
+    } else {
+      m_member_sessions[endpoint] = std::move(c.instance);
     }
   }
 }
@@ -475,14 +521,14 @@ LIMIT
 void Status::collect_basic_local_status(shcore::Dictionary_t dict,
                                         const mysqlsh::dba::Instance &instance,
                                         bool is_primary) {
-  if (m_cluster->is_cluster_set_member()) {
+  if (m_is_cluster_set_member) {
     // PRIMARY of PC has no relevant replication lag info
     // PRIMARY of RC shows lag from clusterset_replication channel
     // SECONDARY members show replication from gr_applier channel
     std::string_view channel_name;
 
     if (is_primary) {
-      if (!m_cluster->is_primary_cluster()) {
+      if (!m_is_primary_cluster) {
         channel_name = k_clusterset_async_channel_name;
       }
     } else {
@@ -1353,6 +1399,124 @@ shcore::Array_t validate_instance_recovery_user(
 }
 }  // namespace
 
+/**
+ * Queries the state of a member from its own session. Called concurrently for
+ * all the members, must not access the Metadata or any other shared session.
+ */
+void Status::probe_member(Member_probe *probe) {
+  using mysqlshdk::gr::Member_role;
+  using mysqlshdk::gr::Member_state;
+  using mysqlshdk::mysql::Replication_channel;
+
+  const auto &instance = probe->instance;
+  auto &minfo = probe->info;
+  auto &member = probe->member;
+  auto &self_state = probe->self_state;
+  auto &super_read_only = probe->super_read_only;
+  auto &offline_mode = probe->offline_mode;
+  auto &fence_sysvars = probe->fence_sysvars;
+  auto &auto_rejoin = probe->auto_rejoin;
+  auto &applier_channel = probe->applier_channel;
+  auto &recovery_channel = probe->recovery_channel;
+  auto &parallel_applier_options = probe->parallel_applier_options;
+
+  // Get the current parallel-applier options
+  parallel_applier_options = Parallel_applier_options(*instance);
+
+  // Get super_read_only value of each instance to set the mode
+  // accurately.
+  super_read_only = instance->get_sysvar_bool("super_read_only");
+
+  // Get offline_mode value of each instance to set the mode accurately.
+  offline_mode = instance->get_sysvar_bool("offline_mode");
+
+  // Check if auto-rejoin is running.
+  auto_rejoin = mysqlshdk::gr::is_running_gr_auto_rejoin(*instance);
+
+  self_state = mysqlshdk::gr::get_member_state(*instance);
+
+  minfo.version = instance->get_version().get_base();
+
+  if (m_extended.has_value()) {
+    if (*m_extended >= 1) {
+      fence_sysvars = instance->get_fence_sysvars();
+
+      const auto &workers =
+          parallel_applier_options.replica_parallel_workers;
+      if (workers.value_or(0) > 0) {
+        (*member)["applierWorkerThreads"] = shcore::Value(*workers);
+      }
+    }
+
+    if (*m_extended >= 3) {
+      collect_local_status(member, *instance,
+                           minfo.state == Member_state::RECOVERING);
+    }
+    if (minfo.state == Member_state::ONLINE)
+      collect_basic_local_status(member, *instance,
+                                 minfo.role == Member_role::PRIMARY);
+
+    shcore::Value recovery_info;
+    if (minfo.state == Member_state::RECOVERING) {
+      std::string status;
+      std::tie(status, recovery_info) = recovery_status(
+          *instance, probe->join_time.get_type() == shcore::String
+                         ? probe->join_time.as_string()
+                         : "");
+      if (!status.empty()) {
+        (*member)["recoveryStatusText"] = shcore::Value(status);
+      }
+    }
+
+    // Include recovery channel info if RECOVERING or if there's an error
+    if (mysqlshdk::mysql::get_channel_status(
+            *instance, mysqlshdk::gr::k_gr_recovery_channel,
+            &recovery_channel) &&
+        *m_extended > 0) {
+      if (minfo.state == Member_state::RECOVERING ||
+          recovery_channel.status() != Replication_channel::OFF) {
+        mysqlshdk::mysql::Replication_channel_master_info master_info;
+        mysqlshdk::mysql::Replication_channel_relay_log_info relay_info;
+
+        mysqlshdk::mysql::get_channel_info(
+            *instance, mysqlshdk::gr::k_gr_recovery_channel, &master_info,
+            &relay_info);
+
+        if (!recovery_info) recovery_info = shcore::Value::new_map();
+
+        (*recovery_info.as_map())["recoveryChannel"] = shcore::Value(
+            channel_status(&recovery_channel, &master_info, &relay_info, "",
+                           *m_extended - 1, true, false));
+      }
+    }
+    if (recovery_info) (*member)["recovery"] = recovery_info;
+
+    // Include applier channel info ONLINE and channel not ON
+    // or != RECOVERING and channel not OFF
+    if (mysqlshdk::mysql::get_channel_status(
+            *instance, mysqlshdk::gr::k_gr_applier_channel,
+            &applier_channel) &&
+        *m_extended > 0) {
+      if ((self_state == Member_state::ONLINE &&
+           applier_channel.status() != Replication_channel::ON) ||
+          (self_state != Member_state::RECOVERING &&
+           self_state != Member_state::ONLINE &&
+           applier_channel.status() != Replication_channel::OFF)) {
+        mysqlshdk::mysql::Replication_channel_master_info master_info;
+        mysqlshdk::mysql::Replication_channel_relay_log_info relay_info;
+
+        mysqlshdk::mysql::get_channel_info(
+            *instance, mysqlshdk::gr::k_gr_applier_channel, &master_info,
+            &relay_info);
+
+        (*member)["applierChannel"] = shcore::Value(
+            channel_status(&applier_channel, &master_info, &relay_info, "",
+                           *m_extended - 1, false, false));
+      }
+    }
+  }
+}
+
 shcore::Dictionary_t Status::get_topology(
     const std::vector<mysqlshdk::gr::Member> &member_info) {
   using mysqlshdk::gr::Member_role;
@@ -1497,134 +1661,88 @@ shcore::Dictionary_t Status::get_topology(
   auto mismatched_recovery_accounts =
       m_cluster->get_mismatched_recovery_accounts();
 
-  // Flag to mark the primary instance was already feeded with rogue
-  // read-replicas info. Used to avoid all members being fed with the same
-  // read-replica when in multi-primary mode
-  bool already_feeded_primary = false;
-
-  for (const auto &inst : instances) {
-    shcore::Dictionary_t member = shcore::make_dict();
-    mysqlshdk::gr::Member minfo(get_member(inst.actual_server_uuid));
-    mysqlshdk::gr::Member_state self_state =
-        mysqlshdk::gr::Member_state::MISSING;
-
-    auto &instance = m_member_sessions[inst.md.endpoint];
-
-    std::optional<bool> super_read_only;
-    std::optional<bool> offline_mode;
-    std::vector<std::string> fence_sysvars;
-    bool auto_rejoin = false;
-
-    Replication_channel applier_channel;
-    Replication_channel recovery_channel;
-
-    Parallel_applier_options parallel_applier_options;
+  std::vector<Member_probe> probes(instances.size());
 
-    if (instance) {
-      // Get the current parallel-applier options
-      parallel_applier_options = Parallel_applier_options(*instance);
+  for (std::size_t i = 0; i < instances.size(); ++i) {
+    auto &probe = probes[i];
 
-      // Get super_read_only value of each instance to set the mode
-      // accurately.
-      super_read_only = instance->get_sysvar_bool("super_read_only");
+    probe.instance = m_member_sessions[instances[i].md.endpoint];
+    probe.info = get_member(instances[i].actual_server_uuid);
+    probe.member = shcore::make_dict();
 
-      // Get offline_mode value of each instance to set the mode accurately.
-      offline_mode = instance->get_sysvar_bool("offline_mode");
-
-      // Check if auto-rejoin is running.
-      auto_rejoin = mysqlshdk::gr::is_running_gr_auto_rejoin(*instance);
+    if (probe.instance && m_extended.has_value() &&
+        probe.info.state == Member_state::RECOVERING) {
+      // Get the join timestamp from the Metadata
+      m_cluster->get_metadata_storage()->query_instance_attribute(
+          probe.instance->get_uuid(), k_instance_attribute_join_time,
+          &probe.join_time);
+    }
+  }
 
-      self_state = mysqlshdk::gr::get_member_state(*instance);
+  m_is_cluster_set_member = m_cluster->is_cluster_set_member();
+  m_is_primary_cluster =
+      m_is_cluster_set_member && m_cluster->is_primary_cluster();
 
-      minfo.version = instance->get_version().get_base();
+  // each member is queried using its own session, which allows to do this
+  // concurrently
+  mysqlshdk::utils::map_reduce<bool, bool>(
+      probes.begin(), probes.end(),
+      [this](Member_probe &probe) {
+        if (probe.instance) {
+          mysqlsh::Mysql_thread thdinit;
+          mysqlshdk::utils::Duration duration;
 
-      if (m_extended.has_value()) {
-        if (*m_extended >= 1) {
-          fence_sysvars = instance->get_fence_sysvars();
+          duration.start();
 
-          const auto &workers =
-              parallel_applier_options.replica_parallel_workers;
-          if (workers.value_or(0) > 0) {
-            (*member)["applierWorkerThreads"] = shcore::Value(*workers);
+          try {
+            probe_member(&probe);
+          } catch (...) {
+            probe.error = std::current_exception();
           }
-        }
 
-        if (*m_extended >= 3) {
-          collect_local_status(member, *instance,
-                               minfo.state == Member_state::RECOVERING);
-        }
-        if (minfo.state == Member_state::ONLINE)
-          collect_basic_local_status(member, *instance,
-                                     minfo.role == Member_role::PRIMARY);
-
-        shcore::Value recovery_info;
-        if (minfo.state == Member_state::RECOVERING) {
-          std::string status;
-          // Get the join timestamp from the Metadata
-          shcore::Value join_time;
-          m_cluster->get_metadata_storage()->query_instance_attribute(
-              instance->get_uuid(), k_instance_attribute_join_time, &join_time);
-
-          std::tie(status, recovery_info) =
-              recovery_status(*instance, join_time.get_type() == shcore::String
-                                             ? join_time.as_string()
-                                             : "");
-          if (!status.empty()) {
-            (*member)["recoveryStatusText"] = shcore::Value(status);
-          }
+          duration.finish();
+          probe.elapsed = duration.seconds_elapsed();
         }
 
-        // Include recovery channel info if RECOVERING or if there's an error
-        if (mysqlshdk::mysql::get_channel_status(
-                *instance, mysqlshdk::gr::k_gr_recovery_channel,
-                &recovery_channel) &&
-            *m_extended > 0) {
-          if (minfo.state == Member_state::RECOVERING ||
-              recovery_channel.status() != Replication_channel::OFF) {
-            mysqlshdk::mysql::Replication_channel_master_info master_info;
-            mysqlshdk::mysql::Replication_channel_relay_log_info relay_info;
-
-            mysqlshdk::mysql::get_channel_info(
-                *instance, mysqlshdk::gr::k_gr_recovery_channel, &master_info,
-                &relay_info);
-
-            if (!recovery_info) recovery_info = shcore::Value::new_map();
-
-            (*recovery_info.as_map())["recoveryChannel"] = shcore::Value(
-                channel_status(&recovery_channel, &master_info, &relay_info, "",
-                               *m_extended - 1, true, false));
-          }
-        }
-        if (recovery_info) (*member)["recovery"] = recovery_info;
-
-        // Include applier channel info ONLINE and channel not ON
-        // or != RECOVERING and channel not OFF
-        if (mysqlshdk::mysql::get_channel_status(
-                *instance, mysqlshdk::gr::k_gr_applier_channel,
-                &applier_channel) &&
-            *m_extended > 0) {
-          if ((self_state == Member_state::ONLINE &&
-               applier_channel.status() != Replication_channel::ON) ||
-              (self_state != Member_state::RECOVERING &&
-               self_state != Member_state::ONLINE &&
-               applier_channel.status() != Replication_channel::OFF)) {
-            mysqlshdk::mysql::Replication_channel_master_info master_info;
-            mysqlshdk::mysql::Replication_channel_relay_log_info relay_info;
-
-            mysqlshdk::mysql::get_channel_info(
-                *instance, mysqlshdk::gr::k_gr_applier_channel, &master_info,
-                &relay_info);
-
-            (*member)["applierChannel"] = shcore::Value(
-                channel_status(&applier_channel, &master_info, &relay_info, "",
-                               *m_extended - 1, false, false));
-          }
-        }
+        return true;
+      },
+      [](bool, bool) { return true; }, k_max_parallel_members);
+
+  // Flag to mark the primary instance was already feeded with rogue
+  // read-replicas info. Used to avoid all members being fed with the same
+  // read-replica when in multi-primary mode
+  bool already_feeded_primary = false;
+
+  for (std::size_t i = 0; i < instances.size(); ++i) {
+    const auto &inst = instances[i];
+    auto &probe = probes[i];
+
+    if (probe.error) std::rethrow_exception(probe.error);
+
+    const auto &instance = probe.instance;
+    const auto &member = probe.member;
+    const auto &minfo = probe.info;
+    const auto self_state = probe.self_state;
+    const auto &super_read_only = probe.super_read_only;
+    const auto &offline_mode = probe.offline_mode;
+    const auto &fence_sysvars = probe.fence_sysvars;
+    const auto auto_rejoin = probe.auto_rejoin;
+    const auto &applier_channel = probe.applier_channel;
+    const auto &recovery_channel = probe.recovery_channel;
+    const auto &parallel_applier_options = probe.parallel_applier_options;
+
+    if (m_extended.value_or(0) >= 2) {
+      if (const auto it = m_member_connect_times.find(inst.md.endpoint);
+          it != m_member_connect_times.end()) {
+        (*member)["shellConnectTime"] = shcore::Value(it->second);
       }
+    }
 
-    } else {
+    if (!instance) {
       (*member)["shellConnectError"] =
           shcore::Value(m_member_connect_errors[inst.md.endpoint]);
+    } else if (m_extended.value_or(0) >= 2) {
+      (*member)["shellProbeTime"] = shcore::Value(probe.elapsed);
     }
     feed_metadata_info(member, inst.md);
 
@@ -26,6 +26,7 @@
 #ifndef MODULES_ADMINAPI_CLUSTER_STATUS_H_
 #define MODULES_ADMINAPI_CLUSTER_STATUS_H_
 
+#include <exception>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -34,6 +35,7 @@
 
 #include "modules/adminapi/cluster/cluster_impl.h"
 #include "modules/adminapi/common/async_topology.h"
+#include "modules/adminapi/common/parallel_applier_options.h"
 #include "modules/command_interface.h"
 #include "mysql/instance.h"
 #include "mysqlshdk/libs/mysql/group_replication.h"
@@ -52,6 +54,30 @@ class Status final : public Command_interface {
     mysqlshdk::mysql::Replication_channel repl_channel_info;
   };
 
+  /**
+   * State of a member, as queried from its own session.
+   */
+  struct Member_probe {
+    std::shared_ptr<Instance> instance;
+    mysqlshdk::gr::Member info;
+    shcore::Value join_time;
+
+    shcore::Dictionary_t member;
+    mysqlshdk::gr::Member_state self_state =
+        mysqlshdk::gr::Member_state::MISSING;
+    std::optional<bool> super_read_only;
+    std::optional<bool> offline_mode;
+    std::vector<std::string> fence_sysvars;
+    bool auto_rejoin = false;
+    mysqlshdk::mysql::Replication_channel applier_channel;
+    mysqlshdk::mysql::Replication_channel recovery_channel;
+    Parallel_applier_options parallel_applier_options;
+
+    // time spent querying the member, in seconds
+    double elapsed = 0.0;
+    std::exception_ptr error;
+  };
+
  public:
   using Member_stats_map =
       std::map<std::string, std::pair<mysqlshdk::db::Row_by_name,
@@ -118,8 +144,14 @@ class Status final : public Command_interface {
   std::unordered_map<std::string, std::string, std::hash<std::string>,
                      mysqlshdk::utils::Endpoint_comparer>
       m_member_connect_errors;
+  // time it took to connect to each member, in seconds
+  std::unordered_map<std::string, double, std::hash<std::string>,
+                     mysqlshdk::utils::Endpoint_comparer>
+      m_member_connect_times;
 
   bool m_no_quorum = false;
+  bool m_is_cluster_set_member = false;
+  bool m_is_primary_cluster = false;
   std::optional<int64_t> m_cluster_transaction_size_limit = -1;
 
   void connect_to_members();
@@ -159,6 +191,8 @@ class Status final : public Command_interface {
                             const mysqlsh::dba::Instance &instance,
                             bool recovering);
 
+  void probe_member(Member_probe *probe);
+
   void feed_metadata_info(shcore::Dictionary_t dict,
                           const Instance_metadata &info);
 
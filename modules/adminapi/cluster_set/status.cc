@@ -291,21 +291,19 @@ void check_cluster_consistency(
     const mysqlshdk::mysql::Gtid_set &cluster_received_gtid,
     const std::vector<std::string> &view_change_uuids,
     const mysqlshdk::mysql::Gtid_set &primary_gtid, int extended) {
-  auto cluster_server = cluster->get_cluster_server();
-
   mysqlshdk::mysql::Gtid_set gtid_missing = primary_gtid;
-  gtid_missing.subtract(cluster_gtid, *cluster_server);
+  gtid_missing.subtract(cluster_gtid);
 
   mysqlshdk::mysql::Gtid_set gtid_errant = cluster_gtid;
 
   // filter out GTIDs received via clusterset AR channel, so that we don't
   // report transactions that were already replicated but not yet exposed to
   // GTID_EXECUTED at the source (can happen if the primary has very high load)
-  gtid_errant.subtract(cluster_received_gtid, *cluster_server);
+  gtid_errant.subtract(cluster_received_gtid);
 
   for (const auto &uuid : view_change_uuids)
-    gtid_errant.subtract(gtid_errant.get_gtids_from(uuid), *cluster_server);
-  gtid_errant.subtract(primary_gtid, *cluster_server);
+    gtid_errant.subtract(gtid_errant.get_gtids_from(uuid));
+  gtid_errant.subtract(primary_gtid);
 
   if (extended > 0 || !gtid_errant.empty()) {
     status->set("transactionSetConsistencyStatus",
@@ -563,13 +563,24 @@ std::shared_ptr<Instance> Instance_pool::adopt(
 std::shared_ptr<Instance> Instance_pool::connect_unchecked(
     const mysqlshdk::db::Connection_options &opts) {
   DBUG_TRACE;
-  for (auto &inst : m_pool) {
-    if (!inst.leased && inst.instance->get_connection_options() == opts) {
-      inst.leased = true;
-      return inst.instance;
+  {
+    std::lock_guard lock{m_pool_mutex};
+
+    for (auto &inst : m_pool) {
+      if (!inst.leased && inst.instance->get_connection_options() == opts) {
+        inst.leased = true;
+        return inst.instance;
+      }
     }
   }
 
+  std::unique_lock<std::mutex> prompt_lock;
+
+  if (m_allow_password_prompt && !opts.has_password()) {
+    // user may be asked for the password, one prompt at a time
+    prompt_lock = std::unique_lock{m_prompt_mutex};
+  }
+
   return Instance::connect(opts, m_allow_password_prompt);
 }
 
@@ -605,13 +616,17 @@ std::shared_ptr<Instance> Instance_pool::connect_unchecked_uuid(
   DBUG_TRACE;
   Auth_options auth = m_default_auth_opts;
 
-  for (auto &inst : m_pool) {
-    Auth_options iauth;
-    iauth.get(inst.instance->get_connection_options());
+  {
+    std::lock_guard lock{m_pool_mutex};
+
+    for (auto &inst : m_pool) {
+      Auth_options iauth;
+      iauth.get(inst.instance->get_connection_options());
 
-    if (!inst.leased && inst.instance->get_uuid() == uuid && iauth == auth) {
-      inst.leased = true;
-      return inst.instance;
+      if (!inst.leased && inst.instance->get_uuid() == uuid && iauth == auth) {
+        inst.leased = true;
+        return inst.instance;
+      }
     }
   }
 
@@ -1103,12 +1118,14 @@ std::shared_ptr<Instance> Instance_pool::add_leased_instance(
   Pool_entry entry;
   entry.instance = instance;
   entry.leased = true;
+  std::lock_guard lock{m_pool_mutex};
   m_pool.emplace_back(entry);
   return instance;
 }
 
 void Instance_pool::return_instance(Instance *instance) {
   DBUG_TRACE;
+  std::lock_guard lock{m_pool_mutex};
   for (auto i = m_pool.begin(); i != m_pool.end(); ++i) {
     if (i->instance.get() == instance) {
       if (!i->leased) throw std::logic_error("Returning unleased instance");
@@ -1120,6 +1137,7 @@ void Instance_pool::return_instance(Instance *instance) {
 
 std::shared_ptr<Instance> Instance_pool::forget_instance(Instance *instance) {
   DBUG_TRACE;
+  std::lock_guard lock{m_pool_mutex};
   for (auto i = m_pool.begin(); i != m_pool.end(); ++i) {
     if (i->instance.get() == instance) {
       auto ptr = i->instance;
@@ -28,6 +28,7 @@
 
 #include <list>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <vector>
@@ -254,7 +255,8 @@ class Instance_pool final {
   // The caller is still responsible for calling release() on it.
   std::shared_ptr<Instance> adopt(const std::shared_ptr<Instance> &instance);
 
-  // Connect to the specified instance without doing any checks
+  // Connect to the specified instance without doing any checks. This can be
+  // called concurrently, password prompts are serialized.
   std::shared_ptr<Instance> connect_unchecked(
       const mysqlshdk::db::Connection_options &opts);
 
@@ -323,6 +325,8 @@ class Instance_pool final {
                      mysqlshdk::db::Connection_options *opts);
 
   std::list<Pool_entry> m_pool;
+  std::mutex m_pool_mutex;
+  std::mutex m_prompt_mutex;
   Auth_options m_default_auth_opts;
   struct Metadata_cache;
   Metadata_cache *m_mdcache = nullptr;
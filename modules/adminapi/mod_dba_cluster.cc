@@ -510,7 +510,8 @@ The extended option supports Integer or Boolean values:
        states as reported by Group Replication and the list of fenced system
        variables;
 @li 2: includes information about transactions processed by connection and
-       applier;
+       applier, as well as the time taken by the Shell to connect to and
+       query each cluster member;
 @li 3: includes more detailed stats about the replication machinery of each
        cluster member;
 @li Boolean: equivalent to assign either 0 (false) or 1 (true).
@@ -70,6 +70,8 @@ const shcore::Option_pack_def<Ddl_dumper_options>
           .include<Dump_options>()
           .optional("chunking", &Ddl_dumper_options::m_split)
           .optional("bytesPerChunk", &Ddl_dumper_options::set_bytes_per_chunk)
+          .optional("adaptiveChunking",
+                    &Ddl_dumper_options::set_adaptive_chunking)
           .optional("threads", &Ddl_dumper_options::set_threads)
           .optional("triggers", &Ddl_dumper_options::m_dump_triggers)
           .optional("tzUtc", &Ddl_dumper_options::m_timezone_utc)
@@ -137,16 +139,18 @@ void Ddl_dumper_options::on_unpacked_options() {
   m_s3_bucket_options.throw_on_conflict(m_blob_storage_options);
   m_blob_storage_options.throw_on_conflict(m_oci_bucket_options);
 
+  // each thread writes its own file, parts of large files are additionally
+  // uploaded in parallel, up to the number of threads
   if (m_oci_bucket_options) {
-    set_storage_config(m_oci_bucket_options.config());
+    set_storage_config(m_oci_bucket_options.config(), m_threads);
   }
 
   if (m_s3_bucket_options) {
-    set_storage_config(m_s3_bucket_options.config());
+    set_storage_config(m_s3_bucket_options.config(), m_threads);
   }
 
   if (m_blob_storage_options) {
-    set_storage_config(m_blob_storage_options.config());
+    set_storage_config(m_blob_storage_options.config(), m_threads);
   }
 
   if (m_bytes_per_chunk < expand_to_bytes(k_minimum_chunk_size)) {
@@ -195,6 +199,16 @@ void Ddl_dumper_options::set_bytes_per_chunk(const std::string &value) {
   m_bytes_per_chunk = expand_to_bytes(value);
 }
 
+void Ddl_dumper_options::set_adaptive_chunking(bool value) {
+  if (value && !split()) {
+    throw std::invalid_argument(
+        "The option 'adaptiveChunking' cannot be used if the 'chunking' "
+        "option is set to false.");
+  }
+
+  m_adaptive_chunking = value;
+}
+
 void Ddl_dumper_options::enable_mds_compatibility_checks() {
   enable_mds_compatibility();
 }
@@ -57,6 +57,8 @@ class Ddl_dumper_options : public Dump_options {
 
   uint64_t bytes_per_chunk() const override { return m_bytes_per_chunk; }
 
+  bool adaptive_chunking() const override { return m_adaptive_chunking; }
+
   std::size_t threads() const override { return m_threads; }
 
   std::size_t worker_threads() const override { return m_worker_threads; }
@@ -99,6 +101,7 @@ class Ddl_dumper_options : public Dump_options {
 
  private:
   void set_bytes_per_chunk(const std::string &value);
+  void set_adaptive_chunking(bool value);
   void set_ocimds(bool value);
   void set_compatibility_options(const std::vector<std::string> &options);
   void set_target_version_str(const std::string &value);
@@ -113,6 +116,7 @@ class Ddl_dumper_options : public Dump_options {
 
   bool m_split = true;
   uint64_t m_bytes_per_chunk;
+  bool m_adaptive_chunking = false;
 
   // Number of threads requested by the user (or default)
   // At most this number of database connections will be used in the dump
@@ -26,12 +26,23 @@
 #ifndef MODULES_UTIL_DUMP_DIALECT_DUMP_WRITER_H_
 #define MODULES_UTIL_DUMP_DIALECT_DUMP_WRITER_H_
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+#ifdef _WIN32
+#include <intrin.h>
+#endif
+
 #include "mysqlshdk/libs/utils/utils_general.h"
 
 #include "modules/util/dump/dump_writer.h"
@@ -82,6 +93,136 @@ struct csv_unix_traits : public dialect_traits {
   static constexpr bool fields_optionally_enclosed = false;
 };
 
+/**
+ * Returns the character which should follow the FIELDS ESCAPED BY character if
+ * the given character needs to be escaped, or 0 if it can be written as is.
+ */
+template <class T>
+constexpr char escaped_char(char c) {
+  // note: this doesn't produce output consistent with SELECT .. INTO
+  // OUTFILE (i.e. tabs are escaped), but LOAD DATA INFILE handles
+  // this correctly and escaping i.e. carriage return characters helps
+  // with readability
+
+  switch (c) {
+    case '\0':
+      return '0';
+
+    case '\b':
+      return 'b';
+
+    case '\n':
+      return 'n';
+
+    case '\r':
+      return 'r';
+
+    case '\t':
+      return 't';
+
+    case 0x1A:  // ASCII 26
+      return 'Z';
+
+    default:
+      if (c == T::fields_escaped_by[0] || c == T::fields_terminated_by[0] ||
+          c == T::lines_terminated_by[0] ||
+          (T::fields_enclosed_by[0] && c == T::fields_enclosed_by[0])) {
+        return c;
+      }
+
+      return 0;
+  }
+}
+
+/**
+ * Checks if the given character may need to be escaped: all control characters
+ * up to ASCII 26 are reported, escaped_char() gives the final answer.
+ */
+template <class T>
+constexpr bool maybe_escaped(char c) {
+  return static_cast<unsigned char>(c) <= 0x1A ||
+         c == T::fields_escaped_by[0] || c == T::fields_terminated_by[0] ||
+         c == T::lines_terminated_by[0] ||
+         (T::fields_enclosed_by[0] && c == T::fields_enclosed_by[0]);
+}
+
+inline int first_set_bit(uint32_t mask) {
+#ifdef _WIN32
+  unsigned long x = 0;
+  (void)_BitScanForward(&x, mask);
+  return static_cast<int>(x);
+#else
+  return __builtin_ctz(mask);
+#endif
+}
+
+/**
+ * Finds the first character in the given range which may need to be escaped
+ * (see maybe_escaped()), returns end if there's no such character.
+ *
+ * Text columns usually contain long runs of characters which are written as
+ * is, these are scanned 32 (AVX2) or 16 (SSE2) bytes at a time.
+ */
+template <class T>
+inline const char *find_maybe_escaped(const char *p, const char *end) {
+#if defined(__AVX2__)
+  {
+    const auto control = _mm256_set1_epi8(0x1A);
+    const auto escaped_by = _mm256_set1_epi8(T::fields_escaped_by[0]);
+    const auto terminated_by = _mm256_set1_epi8(T::fields_terminated_by[0]);
+    const auto lines_terminated_by =
+        _mm256_set1_epi8(T::lines_terminated_by[0]);
+    // if FIELDS ENCLOSED BY is not set, this is '\0', matched as control
+    const auto enclosed_by = _mm256_set1_epi8(T::fields_enclosed_by[0]);
+
+    for (; end - p >= 32; p += 32) {
+      const auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+      // unsigned v <= 0x1A
+      auto m = _mm256_cmpeq_epi8(_mm256_min_epu8(v, control), v);
+      m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, escaped_by));
+      m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, terminated_by));
+      m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, lines_terminated_by));
+      m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, enclosed_by));
+
+      if (const auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(m))) {
+        return p + first_set_bit(mask);
+      }
+    }
+  }
+#endif
+
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+  {
+    const auto control = _mm_set1_epi8(0x1A);
+    const auto escaped_by = _mm_set1_epi8(T::fields_escaped_by[0]);
+    const auto terminated_by = _mm_set1_epi8(T::fields_terminated_by[0]);
+    const auto lines_terminated_by = _mm_set1_epi8(T::lines_terminated_by[0]);
+    const auto enclosed_by = _mm_set1_epi8(T::fields_enclosed_by[0]);
+
+    for (; end - p >= 16; p += 16) {
+      const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+      auto m = _mm_cmpeq_epi8(_mm_min_epu8(v, control), v);
+      m = _mm_or_si128(m, _mm_cmpeq_epi8(v, escaped_by));
+      m = _mm_or_si128(m, _mm_cmpeq_epi8(v, terminated_by));
+      m = _mm_or_si128(m, _mm_cmpeq_epi8(v, lines_terminated_by));
+      m = _mm_or_si128(m, _mm_cmpeq_epi8(v, enclosed_by));
+
+      if (const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(m))) {
+        return p + first_set_bit(mask);
+      }
+    }
+  }
+#endif
+
+  for (; p != end; ++p) {
+    if (maybe_escaped<T>(*p)) {
+      return p;
+    }
+  }
+
+  return end;
+}
+
 /**
  * This class provides a bit more optimized implementation of Text_dump_writer
  * and intends to only handle dialects supported by import/export utilities. If
@@ -245,47 +386,19 @@ class Dialect_dump_writer : public Dump_writer {
     buffer()->will_write(2 * length);
     const auto end = data + length;
 
-    for (auto p = data; p != end; ++p) {
-      const auto c = *p;
-      char to_write = 0;
-
-      // note: this doesn't produce output consistent with SELECT .. INTO
-      // OUTFILE (i.e. tabs are escaped), but LOAD DATA INFILE handles
-      // this correctly and escaping i.e. carriage return characters helps
-      // with readability
-
-      switch (c) {
-        case '\0':
-          to_write = '0';
-          break;
-
-        case '\b':
-          to_write = 'b';
-          break;
-
-        case '\n':
-          to_write = 'n';
-          break;
+    for (auto p = data;; ++p) {
+      // copy characters which don't need to be escaped in bulk
+      const auto next = find_maybe_escaped<T>(p, end);
+      buffer()->append(p, next - p);
 
-        case '\r':
-          to_write = 'r';
-          break;
-
-        case '\t':
-          to_write = 't';
-          break;
+      if (next == end) {
+        break;
+      }
 
-        case 0x1A:  // ASCII 26
-          to_write = 'Z';
-          break;
+      p = next;
 
-        default:
-          if (c == T::fields_escaped_by[0] || c == T::fields_terminated_by[0] ||
-              c == T::lines_terminated_by[0] || should_escape(c)) {
-            to_write = c;
-          }
-          break;
-      }
+      const auto c = *p;
+      const auto to_write = escaped_char<T>(c);
 
       if (0 != to_write) {
         buffer()->append(T::fields_escaped_by[0]);
@@ -296,22 +409,6 @@ class Dialect_dump_writer : public Dump_writer {
     }
   }
 
-  inline bool should_escape(char c) {
-    return should_escape<s_fields_enclosed_by_length>(c);
-  }
-
-  template <int N, std::enable_if_t<0 == N, int> = 0>
-  inline bool should_escape(char) {
-    // FIELDS ENCLOSED BY character is not specified, nothing to do
-    return false;
-  }
-
-  template <int N, std::enable_if_t<1 == N, int> = 0>
-  inline bool should_escape(char c) {
-    // FIELDS ENCLOSED BY character is specified, escape it
-    return c == T::fields_enclosed_by[0];
-  }
-
   inline void quote_field(uint32_t idx) {
     quote_field<s_fields_enclosed_by_length>(idx);
   }
@@ -101,6 +101,20 @@ void Dump_options::set_storage_config(
   m_storage_config = std::move(storage_config);
 }
 
+void Dump_options::set_storage_config(
+    std::shared_ptr<mysqlshdk::storage::backend::object_storage::Config>
+        storage_config,
+    std::size_t max_parts_in_flight) {
+  // Only files larger than a single part are affected, memory used by each of
+  // them is bounded by (k_max_parts_in_flight + 1) * part size.
+  constexpr std::size_t k_max_parts_in_flight = 4;
+
+  storage_config->set_max_parts_in_flight(
+      std::clamp<std::size_t>(max_parts_in_flight, 1, k_max_parts_in_flight));
+  set_storage_config(
+      std::shared_ptr<mysqlshdk::storage::Config>(std::move(storage_config)));
+}
+
 void Dump_options::on_log_options(const char *msg) const {
   log_info("Dump options: %s", msg);
 }
@@ -39,6 +39,7 @@
 #include "mysqlshdk/include/scripting/types_cpp.h"
 #include "mysqlshdk/libs/db/filtering_options.h"
 #include "mysqlshdk/libs/db/session.h"
+#include "mysqlshdk/libs/storage/backend/object_storage_config.h"
 #include "mysqlshdk/libs/storage/compressed_file.h"
 #include "mysqlshdk/libs/storage/config.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
@@ -88,6 +89,19 @@ class Dump_options {
   void set_storage_config(
       std::shared_ptr<mysqlshdk::storage::Config> storage_config);
 
+  /**
+   * Sets the object storage config, parts of a single file are going to be
+   * uploaded concurrently.
+   *
+   * @param storage_config Object storage config.
+   * @param max_parts_in_flight Requested number of parts of a single file
+   *        which are uploaded concurrently, capped to limit the memory usage.
+   */
+  void set_storage_config(
+      std::shared_ptr<mysqlshdk::storage::backend::object_storage::Config>
+          storage_config,
+      std::size_t max_parts_in_flight);
+
   void set_dry_run_mode(Dry_run dry_run) { m_dry_run_mode = dry_run; }
 
   void disable_index_files() { m_write_index_files = false; }
@@ -161,6 +175,8 @@ class Dump_options {
 
   virtual uint64_t bytes_per_chunk() const = 0;
 
+  virtual bool adaptive_chunking() const = 0;
+
   virtual std::size_t threads() const = 0;
 
   virtual std::size_t worker_threads() const { return threads(); }
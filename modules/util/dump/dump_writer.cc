@@ -144,7 +144,14 @@ Dump_writer::~Dump_writer() {
 
 void Dump_writer::set_output_file(mysqlshdk::storage::IFile *output) {
   m_output = output;
-  m_compressed = dynamic_cast<mysqlshdk::storage::Compressed_file *>(m_output);
+  m_pipelined = dynamic_cast<mysqlshdk::storage::Pipelined_file *>(m_output);
+  // if output is pipelined, compressed file is written by another thread and
+  // number of compressed bytes is reported by the pipelined file
+  m_compressed =
+      m_pipelined
+          ? nullptr
+          : dynamic_cast<mysqlshdk::storage::Compressed_file *>(m_output);
+  m_pipelined_bytes_written = 0;
 }
 
 void Dump_writer::set_index_file(
@@ -197,8 +204,7 @@ Dump_write_result Dump_writer::write_postamble() {
   return write_buffer("postamble");
 }
 
-Dump_write_result Dump_writer::write_buffer(const char *context,
-                                            bool row) const {
+Dump_write_result Dump_writer::write_buffer(const char *context, bool row) {
   assert(m_output);
 
   Dump_write_result result;
@@ -218,8 +224,14 @@ Dump_write_result Dump_writer::write_buffer(const char *context,
                   m_output->full_path().masked().c_str());
     }
 
-    result.write_bytes(m_compressed ? m_compressed->latest_io_size()
-                                    : bytes_written);
+    if (m_pipelined) {
+      const auto total = m_pipelined->bytes_written();
+      result.write_bytes(total - m_pipelined_bytes_written);
+      m_pipelined_bytes_written = total;
+    } else {
+      result.write_bytes(m_compressed ? m_compressed->latest_io_size()
+                                      : bytes_written);
+    }
   }
 
   return result;
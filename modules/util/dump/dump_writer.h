@@ -36,6 +36,7 @@
 #include "mysqlshdk/libs/db/row.h"
 #include "mysqlshdk/libs/storage/compressed_file.h"
 #include "mysqlshdk/libs/storage/ifile.h"
+#include "mysqlshdk/libs/storage/pipelined_file.h"
 
 namespace mysqlsh {
 namespace dump {
@@ -174,7 +175,7 @@ class Dump_writer {
 
   virtual void store_postamble() = 0;
 
-  Dump_write_result write_buffer(const char *context, bool row = false) const;
+  Dump_write_result write_buffer(const char *context, bool row = false);
 
   void write_index();
 
@@ -186,6 +187,11 @@ class Dump_writer {
 
   mysqlshdk::storage::Compressed_file *m_compressed = nullptr;
 
+  mysqlshdk::storage::Pipelined_file *m_pipelined = nullptr;
+
+  // bytes written by m_pipelined, already reported
+  uint64_t m_pipelined_bytes_written = 0;
+
   uint64_t m_bytes_written = 0;
 
   uint64_t m_bytes_written_per_idx = 0;
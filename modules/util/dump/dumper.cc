@@ -52,6 +52,7 @@
 #include "mysqlshdk/libs/mysql/gtid_utils.h"
 #include "mysqlshdk/libs/storage/compressed_file.h"
 #include "mysqlshdk/libs/storage/idirectory.h"
+#include "mysqlshdk/libs/storage/pipelined_file.h"
 #include "mysqlshdk/libs/storage/utils.h"
 #include "mysqlshdk/libs/textui/textui.h"
 #include "mysqlshdk/libs/utils/debug.h"
@@ -673,6 +674,184 @@ class Dumper::Multi_file_writer_controller : public Dump_writer_controller {
   std::unordered_map<std::string, Dump_write_result> m_file_stats;
 };
 
+/**
+ * State shared by all chunks of a table which is chunked adaptively.
+ *
+ * Each chunk is dumped using a series of queries, every one of them covering a
+ * range of values which is expected to hold a fraction of bytesPerChunk, based
+ * on the number of bytes per value observed so far. If there are idle workers,
+ * remaining range of a chunk is split in half and the upper part becomes a new
+ * chunk. Because the number of chunks is not known up front, once all of them
+ * are dumped, an empty final chunk is written.
+ */
+class Dumper::Adaptive_chunking final {
+ public:
+  Adaptive_chunking() = delete;
+
+  Adaptive_chunking(const std::string &column, bool is_unsigned)
+      : m_column(column), m_is_unsigned(is_unsigned) {}
+
+  Adaptive_chunking(const Adaptive_chunking &) = delete;
+  Adaptive_chunking(Adaptive_chunking &&) = delete;
+
+  Adaptive_chunking &operator=(const Adaptive_chunking &) = delete;
+  Adaptive_chunking &operator=(Adaptive_chunking &&) = delete;
+
+  ~Adaptive_chunking() = default;
+
+  inline const std::string &column() const { return m_column; }
+
+  inline bool is_unsigned() const { return m_is_unsigned; }
+
+  /**
+   * Sets the number of bytes per value estimated using table statistics, used
+   * until actual data is dumped.
+   */
+  void set_estimate(double bytes_per_value) {
+    std::lock_guard lock{m_mutex};
+    m_estimated_bytes_per_value = bytes_per_value;
+  }
+
+  /**
+   * Records number of bytes dumped from a range holding the given number of
+   * values.
+   */
+  void update(uint64_t bytes, double values) {
+    std::lock_guard lock{m_mutex};
+    m_observed_bytes += bytes;
+    m_observed_values += values;
+  }
+
+  /**
+   * Provides number of values which are expected to hold the given number of
+   * bytes, at least one.
+   */
+  uint64_t values(uint64_t bytes) const {
+    const auto bpv = bytes_per_value();
+
+    if (bpv <= 0.0) {
+      return std::numeric_limits<uint64_t>::max();
+    }
+
+    const auto result = bytes / bpv;
+
+    if (result >= static_cast<double>(std::numeric_limits<uint64_t>::max())) {
+      return std::numeric_limits<uint64_t>::max();
+    }
+
+    return std::max(static_cast<uint64_t>(result), UINT64_C(1));
+  }
+
+  /**
+   * Provides number of bytes which are expected to be held by the given number
+   * of values.
+   */
+  double bytes(double values) const { return values * bytes_per_value(); }
+
+  /**
+   * Adds a new chunk, returns its ID.
+   */
+  std::size_t add_chunk() {
+    std::lock_guard lock{m_mutex};
+    ++m_pending;
+    return m_chunks++;
+  }
+
+  /**
+   * Marks a chunk as dumped.
+   *
+   * @returns true if the final chunk should be written
+   */
+  bool chunk_finished() {
+    std::lock_guard lock{m_mutex};
+    assert(m_pending > 0);
+    --m_pending;
+    return is_finished();
+  }
+
+  /**
+   * Marks that chunker is not going to add any more chunks.
+   *
+   * @returns true if the final chunk should be written
+   */
+  bool chunking_finished() {
+    std::lock_guard lock{m_mutex};
+    m_chunking_finished = true;
+    return is_finished();
+  }
+
+  /**
+   * ID of the final chunk, valid once all the other chunks are dumped.
+   */
+  std::size_t final_chunk() const {
+    std::lock_guard lock{m_mutex};
+    return m_chunks;
+  }
+
+  void set_metadata(
+      const std::vector<mysqlshdk::db::Column> &metadata,
+      const std::vector<Dump_writer::Encoding_type> &pre_encoded_columns) {
+    std::lock_guard lock{m_mutex};
+
+    if (!m_has_metadata) {
+      m_metadata = metadata;
+      m_pre_encoded_columns = pre_encoded_columns;
+      m_has_metadata = true;
+    }
+  }
+
+  bool has_metadata() const {
+    std::lock_guard lock{m_mutex};
+    return m_has_metadata;
+  }
+
+  const std::vector<mysqlshdk::db::Column> &metadata() const {
+    return m_metadata;
+  }
+
+  const std::vector<Dump_writer::Encoding_type> &pre_encoded_columns() const {
+    return m_pre_encoded_columns;
+  }
+
+ private:
+  double bytes_per_value() const {
+    std::lock_guard lock{m_mutex};
+
+    if (m_observed_bytes > 0 && m_observed_values > 0.0) {
+      return m_observed_bytes / m_observed_values;
+    }
+
+    return m_estimated_bytes_per_value;
+  }
+
+  inline bool is_finished() {
+    if (m_chunking_finished && 0 == m_pending && !m_final_chunk_written) {
+      m_final_chunk_written = true;
+      return true;
+    }
+
+    return false;
+  }
+
+  const std::string m_column;
+  const bool m_is_unsigned;
+
+  mutable std::mutex m_mutex;
+
+  double m_estimated_bytes_per_value = 0.0;
+  uint64_t m_observed_bytes = 0;
+  double m_observed_values = 0.0;
+
+  std::size_t m_chunks = 0;
+  std::size_t m_pending = 0;
+  bool m_chunking_finished = false;
+  bool m_final_chunk_written = false;
+
+  bool m_has_metadata = false;
+  std::vector<mysqlshdk::db::Column> m_metadata;
+  std::vector<Dump_writer::Encoding_type> m_pre_encoded_columns;
+};
+
 class Dumper::Table_worker final {
  public:
   enum class Exception_strategy { ABORT, CONTINUE };
@@ -712,7 +891,9 @@ class Dumper::Table_worker final {
           mysqlshdk::utils::Rate_limit(m_dumper->m_options.max_rate());
 
       while (true) {
+        ++m_dumper->m_num_threads_idle;
         auto work = m_dumper->m_worker_tasks.pop();
+        --m_dumper->m_num_threads_idle;
 
         if (m_dumper->m_worker_interrupt) {
           return;
@@ -765,6 +946,12 @@ class Dumper::Table_worker final {
   std::string prepare_query(
       const Table_data_task &table,
       std::vector<Dump_writer::Encoding_type> *out_pre_encoded_columns) const {
+    return prepare_query(table, table.boundary, out_pre_encoded_columns);
+  }
+
+  std::string prepare_query(
+      const Table_data_task &table, const std::string &boundary,
+      std::vector<Dump_writer::Encoding_type> *out_pre_encoded_columns) const {
     const auto base64 = m_dumper->m_options.use_base64();
     std::string query = "SELECT SQL_NO_CACHE ";
 
@@ -797,7 +984,7 @@ class Dumper::Table_worker final {
                ")";
     }
 
-    query += where(table);
+    query += where(table, boundary);
 
     if (table.index.info) {
       query += " ORDER BY " + table.index.info->columns_sql();
@@ -819,35 +1006,25 @@ class Dumper::Table_worker final {
     duration.start();
 
     std::vector<Dump_writer::Encoding_type> pre_encoded_columns;
-    const auto full_query = prepare_query(table, &pre_encoded_columns);
+    auto full_query = prepare_query(table, &pre_encoded_columns);
     const auto controller = table.controller.get();
 
     try {
       controller->prepare_for_writing();
 
       if (Dry_run::DISABLED == m_dumper->m_options.dry_run_mode()) {
-        const auto result = query(full_query);
-
-        controller->start_writing(result->get_metadata(), pre_encoded_columns);
-
-        while (const auto row = result->fetch_one()) {
-          if (m_dumper->m_worker_interrupt) {
+        if (table.adaptive) {
+          if (!dump_ranges(table, pre_encoded_columns, &full_query)) {
             return;
           }
+        } else {
+          const auto result = query(full_query);
 
-          controller->write_row(row);
-
-          constexpr uint64_t update_every = 2000;
-          if (update_every == controller->progress_stats().rows_written()) {
-            m_dumper->update_progress(controller->progress_stats());
-
-            // we don't know how much data was read from the server, number of
-            // bytes written to the dump file is a good approximation
-            if (m_rate_limit.enabled()) {
-              m_rate_limit.throttle(controller->progress_stats().data_bytes());
-            }
+          controller->start_writing(result->get_metadata(),
+                                    pre_encoded_columns);
 
-            controller->reset_progress();
+          if (!write_rows(result.get(), controller)) {
+            return;
           }
         }
       }
@@ -873,9 +1050,206 @@ class Dumper::Table_worker final {
 
     m_dumper->update_progress(controller->progress_stats());
     m_dumper->finish_writing(table.schema, table.name, controller);
+
+    if (table.adaptive && table.adaptive->chunk_finished()) {
+      write_final_chunk(table, table.adaptive.get());
+    }
+
     m_dumper->data_task_finished();
   }
 
+  /**
+   * Writes all rows from the given result.
+   *
+   * @returns false if dump was interrupted
+   */
+  bool write_rows(mysqlshdk::db::IResult *result,
+                  Dump_writer_controller *controller) {
+    while (const auto row = result->fetch_one()) {
+      if (m_dumper->m_worker_interrupt) {
+        return false;
+      }
+
+      controller->write_row(row);
+
+      constexpr uint64_t update_every = 2000;
+      if (update_every == controller->progress_stats().rows_written()) {
+        m_dumper->update_progress(controller->progress_stats());
+
+        // we don't know how much data was read from the server, number of
+        // bytes written to the dump file is a good approximation
+        if (m_rate_limit.enabled()) {
+          m_rate_limit.throttle(controller->progress_stats().data_bytes());
+        }
+
+        controller->reset_progress();
+      }
+    }
+
+    return true;
+  }
+
+  bool dump_ranges(
+      const Table_data_task &table,
+      const std::vector<Dump_writer::Encoding_type> &pre_encoded_columns,
+      std::string *out_query) {
+    if (table.adaptive->is_unsigned()) {
+      return dump_ranges(table, pre_encoded_columns,
+                         to_uint64_t(table.range_begin),
+                         to_uint64_t(table.range_end), out_query);
+    } else {
+      return dump_ranges(table, pre_encoded_columns,
+                         to_int64_t(table.range_begin),
+                         to_int64_t(table.range_end), out_query);
+    }
+  }
+
+  /**
+   * Dumps the [begin, end] range of an adaptively chunked table, using
+   * multiple queries. If some workers are idle, remaining range is split and
+   * its upper half is pushed as a new chunk.
+   *
+   * @returns false if dump was interrupted
+   */
+  template <typename T>
+  bool dump_ranges(
+      const Table_data_task &table,
+      const std::vector<Dump_writer::Encoding_type> &pre_encoded_columns,
+      T begin, T end, std::string *out_query) {
+    // each query is expected to fetch this many bytes
+    static constexpr uint64_t k_queries_per_chunk = 4;
+
+    const auto adaptive = table.adaptive.get();
+    const auto controller = table.controller.get();
+    const auto bytes_per_query = std::max(
+        m_dumper->m_options.bytes_per_chunk() / k_queries_per_chunk,
+        UINT64_C(1));
+    std::vector<Dump_writer::Encoding_type> unused;
+    bool started = false;
+    // first query uses the number of bytes per value observed in the whole
+    // table, subsequent ones are sized using the previous query
+    uint64_t step = adaptive->values(bytes_per_query);
+    uint64_t bytes = 0;
+
+    while (true) {
+      if (m_dumper->m_worker_interrupt) {
+        return false;
+      }
+
+      if (started) {
+        step = next_step(step, bytes, bytes_per_query);
+      }
+
+      // number of values in the remaining range, minus one
+      const auto remaining = span(begin, end);
+      const T last = step > remaining ? end : advance(begin, step - 1);
+
+      *out_query = prepare_query(
+          table, between(adaptive->column(), begin, last), &unused);
+      unused.clear();
+
+      const auto bytes_before = controller->total_stats().data_bytes();
+      const auto result = query(*out_query);
+
+      if (!started) {
+        const auto &metadata = result->get_metadata();
+
+        controller->start_writing(metadata, pre_encoded_columns);
+        adaptive->set_metadata(metadata, pre_encoded_columns);
+
+        started = true;
+      }
+
+      if (!write_rows(result.get(), controller)) {
+        return false;
+      }
+
+      bytes = controller->total_stats().data_bytes() - bytes_before;
+      adaptive->update(bytes, static_cast<double>(span(begin, last)) + 1.0);
+
+      if (last == end) {
+        break;
+      }
+
+      begin = advance(last, 1);
+
+      if (has_idle_workers()) {
+        const auto left = span(begin, end);
+
+        if (adaptive->bytes(static_cast<double>(left) + 1.0) >=
+            2.0 * bytes_per_query) {
+          const T middle = advance(begin, left / 2);
+
+          log_debug("%sSplitting %s (%s), remaining range: [%s, %s]",
+                    m_log_id.c_str(), table.task_name.c_str(),
+                    table.id.c_str(), std::to_string(begin).c_str(),
+                    std::to_string(end).c_str());
+
+          // checksum of this chunk covers the new one
+          create_and_push_adaptive_chunk_task(table, table.adaptive,
+                                              advance(middle, 1), end, false);
+          end = middle;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  /**
+   * Computes the number of values to be fetched by the next query, given that
+   * the previous one fetched the given number of bytes.
+   */
+  static uint64_t next_step(uint64_t step, uint64_t bytes, uint64_t expected) {
+    // how fast the range of a query can grow, if rows are sparse
+    static constexpr double k_max_growth = 4.0;
+
+    const auto max = step * k_max_growth;
+    const auto next =
+        bytes > 0 ? std::min(static_cast<double>(step) * expected / bytes, max)
+                  : max;
+
+    if (next >= static_cast<double>(std::numeric_limits<uint64_t>::max())) {
+      return std::numeric_limits<uint64_t>::max();
+    }
+
+    return std::max(static_cast<uint64_t>(next), UINT64_C(1));
+  }
+
+  inline bool has_idle_workers() const {
+    return m_dumper->m_num_threads_idle > 0 &&
+           0 == m_dumper->m_worker_tasks.size();
+  }
+
+  template <typename T>
+  static inline uint64_t span(T begin, T end) {
+    assert(begin <= end);
+    // two's complement arithmetic, cannot overflow
+    return static_cast<uint64_t>(end) - static_cast<uint64_t>(begin);
+  }
+
+  template <typename T>
+  static inline T advance(T value, uint64_t n) {
+    return static_cast<T>(static_cast<uint64_t>(value) + n);
+  }
+
+  void write_final_chunk(const Table_task &table, Adaptive_chunking *adaptive) {
+    const auto controller =
+        m_dumper->table_dump_controller(m_dumper->get_table_data_filename(
+            table.basename, adaptive->final_chunk(), true));
+
+    controller->prepare_for_writing();
+
+    if (adaptive->has_metadata()) {
+      controller->start_writing(adaptive->metadata(),
+                                adaptive->pre_encoded_columns());
+    }
+
+    controller->finish_writing();
+
+    m_dumper->finish_writing(table.schema, table.name, controller.get());
+  }
+
   Table_data_task create_table_data_task(const Table_task &table,
                                          const std::string &filename,
                                          int64_t chunk = -1) {
@@ -950,6 +1324,25 @@ class Dumper::Table_worker final {
     m_dumper->push_table_data_task(std::move(data_task));
   }
 
+  template <typename T>
+  void create_and_push_adaptive_chunk_task(
+      const Table_task &table,
+      const std::shared_ptr<Adaptive_chunking> &adaptive, T begin, T end,
+      bool checksum) {
+    const auto idx = adaptive->add_chunk();
+    Table_data_task data_task = create_table_data_task(
+        table, m_dumper->get_table_data_filename(table.basename, idx, false),
+        idx);
+
+    data_task.id = "chunk " + std::to_string(idx);
+    data_task.boundary = "(" + between(adaptive->column(), begin, end) + ")";
+    data_task.adaptive = adaptive;
+    data_task.range_begin = std::to_string(begin);
+    data_task.range_end = std::to_string(end);
+
+    m_dumper->push_table_data_task(std::move(data_task), checksum);
+  }
+
   void checksum_table_data(const Checksum_task &task) {
     log_debug("%sComputing checksum of %s (%s)", m_log_id.c_str(),
               task.name.c_str(), task.id.c_str());
@@ -1026,6 +1419,7 @@ class Dumper::Table_worker final {
     const Table_task *table;
     uint64_t row_count;
     uint64_t rows_per_chunk;
+    uint64_t average_row_length;
     uint64_t accuracy;
     int explain_rows_idx;
     std::string partition;
@@ -1033,6 +1427,7 @@ class Dumper::Table_worker final {
     std::string order_by;
     std::string order_by_desc;
     std::size_t index_column;
+    std::shared_ptr<Adaptive_chunking> adaptive;
   };
 
   static std::string compare(const Chunking_info &info, const Row &value,
@@ -1327,6 +1722,13 @@ class Dumper::Table_worker final {
              m_log_id.c_str(), info.table->task_name.c_str(),
              use_constant_step ? "constant" : "adaptive");
 
+    if constexpr (std::is_integral_v<T>) {
+      if (info.adaptive) {
+        info.adaptive->set_estimate(static_cast<double>(info.row_count) *
+                                    info.average_row_length / index_range);
+      }
+    }
+
     bool last_chunk = false;
 
     while (!last_chunk) {
@@ -1346,6 +1748,16 @@ class Dumper::Table_worker final {
 
       last_chunk = (current >= max);
 
+      if constexpr (std::is_integral_v<T>) {
+        if (info.adaptive) {
+          create_and_push_adaptive_chunk_task(*info.table, info.adaptive, begin,
+                                              end, true);
+          ++ranges_count;
+          ++current;
+          continue;
+        }
+      }
+
       create_and_push_table_data_chunk_task(*info.table,
                                             between(info, begin, end), chunk_id,
                                             ranges_count++, last_chunk);
@@ -1353,6 +1765,15 @@ class Dumper::Table_worker final {
       ++current;
     }
 
+    if (info.adaptive) {
+      if (info.adaptive->chunking_finished()) {
+        write_final_chunk(*info.table, info.adaptive.get());
+      }
+
+      // the final chunk
+      ++ranges_count;
+    }
+
     return ranges_count;
   }
 
@@ -1550,6 +1971,7 @@ class Dumper::Table_worker final {
     info.row_count = partition ? partition->row_count : table.info->row_count;
     info.rows_per_chunk =
         m_dumper->m_options.bytes_per_chunk() / average_row_length;
+    info.average_row_length = average_row_length;
     info.accuracy = std::max(info.rows_per_chunk / 10, UINT64_C(10));
     info.explain_rows_idx = m_dumper->m_cache.explain_rows_idx;
     info.partition = std::move(partition_clause);
@@ -1574,6 +1996,17 @@ class Dumper::Table_worker final {
             return c->quoted_name + " DESC";
           });
       info.index_column = 0;
+
+      const auto &column = table.index.info->columns()[info.index_column];
+
+      // ranges of integer columns can be split while dumping, indexes with
+      // nullable columns are excluded, as NULL values go to the first chunk
+      if (m_dumper->m_options.adaptive_chunking() && info.boundary.empty() &&
+          (mysqlshdk::db::Type::Integer == column->type ||
+           mysqlshdk::db::Type::UInteger == column->type)) {
+        info.adaptive = std::make_shared<Adaptive_chunking>(
+            column->quoted_name, mysqlshdk::db::Type::UInteger == column->type);
+      }
     }
 
     log_info("%sChunking %s, rows: %" PRIu64 ", average row length: %" PRIu64
@@ -1761,9 +2194,9 @@ Dumper::Dumper(const Dump_options &options)
     }
 
     using mysqlshdk::storage::make_file;
-    m_output_file =
-        make_file(make_file(m_options.output_url(), m_options.storage_config()),
-                  m_options.compression(), m_options.compression_options());
+    m_output_file = make_pipelined_file(
+        make_file(m_options.output_url(), m_options.storage_config()),
+        m_options.compression_options());
     m_output_dir = m_output_file->parent();
 
     if (m_output_dir->is_local() && !m_output_dir->exists()) {
@@ -2912,7 +3345,10 @@ void Dumper::create_worker_threads() {
 }
 
 void Dumper::maybe_push_shutdown_tasks() {
-  if (all_tasks_produced()) {
+  // data tasks which are split while being dumped produce new data tasks,
+  // workers need to wait until all of them are finished
+  if (all_tasks_produced() && m_data_tasks_completed == m_data_tasks_total &&
+      !m_shutdown_tasks_pushed.exchange(true)) {
     m_worker_tasks.shutdown(m_workers.size());
   }
 }
@@ -2929,6 +3365,8 @@ void Dumper::data_task_finished() {
       m_data_tasks_completed == m_data_tasks_total) {
     m_data_dump_stage->finish(false);
   }
+
+  maybe_push_shutdown_tasks();
 }
 
 void Dumper::checksum_task_started() {
@@ -3178,6 +3616,7 @@ void Dumper::create_table_tasks() {
   m_checksum_tasks_completed = 0;
 
   m_main_thread_finished_producing_chunking_tasks = false;
+  m_shutdown_tasks_pushed = false;
 
   m_all_table_metadata_tasks_scheduled = false;
 
@@ -3354,10 +3793,10 @@ void Dumper::push_table_task(Table_task &&task) {
   }
 }
 
-void Dumper::push_table_data_task(Table_data_task &&task) {
+void Dumper::push_table_data_task(Table_data_task &&task, bool checksum) {
   ++m_data_tasks_total;
 
-  if (m_checksum) {
+  if (m_checksum && checksum) {
     push_checksum_task(create_checksum_task(task));
   }
 
@@ -3457,9 +3896,8 @@ std::unique_ptr<Dumper::Dump_writer_controller> Dumper::table_dump_controller(
     return std::make_unique<Default_writer_controller>(
         m_writer_creator(),
         [this](const std::string &name) {
-          return mysqlshdk::storage::make_file(make_file(name, true),
-                                               m_options.compression(),
-                                               m_options.compression_options());
+          return make_pipelined_file(make_file(name, true),
+                                     data_file_compression_options());
         },
         m_options.write_index_files()
             ? [this](const std::string &name) { return make_file(name); }
@@ -3473,6 +3911,23 @@ std::unique_ptr<Dumper::Dump_writer_controller> Dumper::table_dump_controller(
   }
 }
 
+mysqlshdk::storage::Compression_options
+Dumper::data_file_compression_options() const {
+  auto options = m_options.compression_options();
+
+  if (const auto threads = options.find("threads");
+      options.end() != threads) {
+    // when just a few tables are left, e.g. one table dominates the dump, the
+    // remaining threads get a bigger share of the compression threads
+    const auto budget = std::stoull(threads->second);
+    const auto dumping = std::max<uint64_t>(1, m_num_threads_dumping);
+
+    threads->second = std::to_string(budget / dumping);
+  }
+
+  return options;
+}
+
 std::unique_ptr<Dumper::Dump_writer_controller>
 Dumper::table_dump_multi_file_controller(const std::string &basename) const {
   return std::make_unique<Multi_file_writer_controller>(
@@ -4148,6 +4603,22 @@ std::unique_ptr<mysqlshdk::storage::IFile> Dumper::make_file(
   return directory()->file(filename, options);
 }
 
+std::unique_ptr<mysqlshdk::storage::IFile> Dumper::make_pipelined_file(
+    std::unique_ptr<mysqlshdk::storage::IFile> file,
+    const mysqlshdk::storage::Compression_options &options) const {
+  using mysqlshdk::storage::Pipelined_file;
+
+  if (compressed() && !file->is_local()) {
+    // compression of the next block overlaps with upload of the previous one,
+    // local files are not wrapped, as compressors write them using mmap()
+    file = std::make_unique<Pipelined_file>(std::move(file));
+  }
+
+  // fetching and encoding of the next rows overlaps with compression/writing
+  return std::make_unique<Pipelined_file>(mysqlshdk::storage::make_file(
+      std::move(file), m_options.compression(), options));
+}
+
 std::string Dumper::get_basename(const std::string &basename) {
   // 255 characters total:
   // - 225 - base name
@@ -4477,8 +4948,7 @@ void Dumper::validate_dump_consistency(
         const auto set =
             Gtid_set::from_normalized_string(gtid_executed)
                 .subtract(
-                    Gtid_set::from_normalized_string(m_cache.gtid_executed),
-                    instance);
+                    Gtid_set::from_normalized_string(m_cache.gtid_executed));
 
         consistent = check_if_transactions_are_ddl_safe(
             instance, m_cache.binlog, dumper->binlog(true), set);
@@ -163,11 +163,17 @@ class Dumper {
     Index_info index;
   };
 
+  class Adaptive_chunking;
+
   struct Table_data_task : Table_task {
     std::unique_ptr<Dump_writer_controller> controller;
     std::string id;
     int64_t chunk;
     std::string boundary;
+    // if set, range of this chunk can be split while it's being dumped
+    std::shared_ptr<Adaptive_chunking> adaptive;
+    std::string range_begin;
+    std::string range_end;
   };
 
   struct Checksum_task {
@@ -313,7 +319,7 @@ class Dumper {
 
   void push_table_chunking_task(Table_task &&task);
 
-  void push_table_data_task(Table_data_task &&task);
+  void push_table_data_task(Table_data_task &&task, bool checksum = true);
 
   Checksum_task create_checksum_task(const Table_data_task &table);
 
@@ -329,6 +335,14 @@ class Dumper {
   std::unique_ptr<Dump_writer_controller> table_dump_multi_file_controller(
       const std::string &basename) const;
 
+  /**
+   * Compression options of a data file which is about to be created. If the
+   * "threads" option is set, it's treated as a budget shared among all
+   * threads which are currently dumping data.
+   */
+  mysqlshdk::storage::Compression_options data_file_compression_options()
+      const;
+
   void finish_writing(const std::string &schema, const std::string &table,
                       const Dump_writer_controller *controller);
 
@@ -375,6 +389,15 @@ class Dumper {
   std::unique_ptr<mysqlshdk::storage::IFile> make_file(
       const std::string &filename, bool use_mmap = false) const;
 
+  /**
+   * Wraps a file which is going to hold the table data, so that encoding of
+   * the rows, compression and writing to the storage are performed by
+   * separate threads.
+   */
+  std::unique_ptr<mysqlshdk::storage::IFile> make_pipelined_file(
+      std::unique_ptr<mysqlshdk::storage::IFile> file,
+      const mysqlshdk::storage::Compression_options &options) const;
+
   std::string get_basename(const std::string &basename);
 
   bool compressed() const;
@@ -458,6 +481,7 @@ class Dumper {
   std::atomic<uint64_t> m_num_threads_chunking;
   std::atomic<uint64_t> m_num_threads_checksumming;
   std::atomic<uint64_t> m_num_threads_dumping;
+  std::atomic<uint64_t> m_num_threads_idle = 0;
   std::atomic<uint64_t> m_ddl_written;
 
   std::atomic<uint64_t> m_schema_metadata_written;
@@ -493,6 +517,7 @@ class Dumper {
   std::atomic<uint64_t> m_checksum_tasks_completed;
   Progress_thread::Duration m_checksum_duration;
   std::atomic<bool> m_main_thread_finished_producing_chunking_tasks;
+  std::atomic<bool> m_shutdown_tasks_pushed = false;
   std::function<std::unique_ptr<Dump_writer>()> m_writer_creator;
   volatile bool m_worker_interrupt = false;
 
@@ -64,16 +64,19 @@ void Export_table_options::on_unpacked_options() {
   m_s3_bucket_options.throw_on_conflict(m_blob_storage_options);
   m_blob_storage_options.throw_on_conflict(m_oci_bucket_options);
 
+  // a single file is written, its parts are uploaded in parallel
+  constexpr std::size_t k_parts_in_flight = 4;
+
   if (m_oci_bucket_options) {
-    set_storage_config(m_oci_bucket_options.config());
+    set_storage_config(m_oci_bucket_options.config(), k_parts_in_flight);
   }
 
   if (m_s3_bucket_options) {
-    set_storage_config(m_s3_bucket_options.config());
+    set_storage_config(m_s3_bucket_options.config(), k_parts_in_flight);
   }
 
   if (m_blob_storage_options) {
-    set_storage_config(m_blob_storage_options.config());
+    set_storage_config(m_blob_storage_options.config(), k_parts_in_flight);
   }
 }
 
@@ -67,6 +67,8 @@ class Export_table_options : public Dump_options {
 
   uint64_t bytes_per_chunk() const override { return 0; }
 
+  bool adaptive_chunking() const override { return false; }
+
   std::size_t threads() const override { return 1; }
 
   bool dump_ddl() const override { return false; }
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MODULES_UTIL_IMPORT_TABLE_DELIMITER_FINDER_H_
+#define MODULES_UTIL_IMPORT_TABLE_DELIMITER_FINDER_H_
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+#ifdef _WIN32
+#include <intrin.h>
+#endif
+
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+#define DELIMITER_FINDER_SIMD
+#endif
+
+namespace mysqlsh {
+namespace import_table {
+
+/**
+ * Finds the first (or the last) occurrence of any of the given characters
+ * (i.e. terminators, escape and quote characters of a dialect) in a block of
+ * data.
+ *
+ * Data is classified 64 bytes at a time, using AVX2 (if enabled at compile
+ * time) or SSE2 instructions, other platforms use a scalar loop.
+ */
+class Delimiter_finder final {
+ public:
+  static constexpr std::size_t k_max_chars = 4;
+
+  Delimiter_finder() = default;
+
+  /**
+   * Creates the finder.
+   *
+   * @param chars Characters to look for, values which are not in range of the
+   *        char type are ignored.
+   */
+  explicit Delimiter_finder(std::initializer_list<int> chars) noexcept {
+    for (const auto c : chars) {
+      if (c < CHAR_MIN || c > CHAR_MAX || m_count == k_max_chars) {
+        continue;
+      }
+
+      m_chars[m_count++] = static_cast<char>(c);
+    }
+
+    // unused slots repeat the first character, so they can be compared as well
+    for (auto i = m_count; i < k_max_chars; ++i) {
+      m_chars[i] = m_chars[0];
+    }
+  }
+
+  Delimiter_finder(const Delimiter_finder &) = default;
+  Delimiter_finder(Delimiter_finder &&) = default;
+
+  Delimiter_finder &operator=(const Delimiter_finder &) = default;
+  Delimiter_finder &operator=(Delimiter_finder &&) = default;
+
+  ~Delimiter_finder() = default;
+
+  /**
+   * Finds the first matching character in the given range.
+   *
+   * @returns pointer to the character, or end if not found
+   */
+  const char *find_first(const char *p, const char *end) const noexcept {
+    if (0 == m_count) {
+      return end;
+    }
+
+#ifdef DELIMITER_FINDER_SIMD
+    for (; end - p >= 64; p += 64) {
+      if (const auto mask = match_64(p)) {
+        return p + first_set_bit(mask);
+      }
+    }
+
+    for (; end - p >= 16; p += 16) {
+      if (const auto mask = match_16(p)) {
+        return p + first_set_bit(mask);
+      }
+    }
+#endif  // DELIMITER_FINDER_SIMD
+
+    for (; p != end; ++p) {
+      if (matches(*p)) {
+        return p;
+      }
+    }
+
+    return end;
+  }
+
+  /**
+   * Finds the last matching character in the given range.
+   *
+   * @returns pointer to the character, or end if not found
+   */
+  const char *find_last(const char *begin, const char *end) const noexcept {
+    if (0 == m_count) {
+      return end;
+    }
+
+    auto p = end;
+
+#ifdef DELIMITER_FINDER_SIMD
+    while (p - begin >= 64) {
+      p -= 64;
+
+      if (const auto mask = match_64(p)) {
+        return p + last_set_bit(mask);
+      }
+    }
+
+    while (p - begin >= 16) {
+      p -= 16;
+
+      if (const auto mask = match_16(p)) {
+        return p + last_set_bit(mask);
+      }
+    }
+#endif  // DELIMITER_FINDER_SIMD
+
+    while (p != begin) {
+      if (matches(*--p)) {
+        return p;
+      }
+    }
+
+    return end;
+  }
+
+ private:
+  inline bool matches(char c) const noexcept {
+    return c == m_chars[0] || c == m_chars[1] || c == m_chars[2] ||
+           c == m_chars[3];
+  }
+
+#ifdef DELIMITER_FINDER_SIMD
+  inline uint32_t match_16(const char *p) const noexcept {
+    const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    auto m = _mm_cmpeq_epi8(v, _mm_set1_epi8(m_chars[0]));
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8(m_chars[1])));
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8(m_chars[2])));
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8(m_chars[3])));
+    return static_cast<uint32_t>(_mm_movemask_epi8(m));
+  }
+
+#if defined(__AVX2__)
+  inline uint32_t match_32(const char *p) const noexcept {
+    const auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+    auto m = _mm256_cmpeq_epi8(v, _mm256_set1_epi8(m_chars[0]));
+    m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(m_chars[1])));
+    m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(m_chars[2])));
+    m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(m_chars[3])));
+    return static_cast<uint32_t>(_mm256_movemask_epi8(m));
+  }
+
+  inline uint64_t match_64(const char *p) const noexcept {
+    return static_cast<uint64_t>(match_32(p)) |
+           static_cast<uint64_t>(match_32(p + 32)) << 32;
+  }
+#else   // !__AVX2__
+  inline uint64_t match_64(const char *p) const noexcept {
+    return static_cast<uint64_t>(match_16(p)) |
+           static_cast<uint64_t>(match_16(p + 16)) << 16 |
+           static_cast<uint64_t>(match_16(p + 32)) << 32 |
+           static_cast<uint64_t>(match_16(p + 48)) << 48;
+  }
+#endif  // !__AVX2__
+
+  static inline int first_set_bit(uint64_t mask) noexcept {
+#ifdef _WIN32
+    unsigned long x = 0;
+    (void)_BitScanForward64(&x, mask);
+    return static_cast<int>(x);
+#else
+    return __builtin_ctzll(mask);
+#endif
+  }
+
+  static inline int last_set_bit(uint64_t mask) noexcept {
+#ifdef _WIN32
+    unsigned long x = 0;
+    (void)_BitScanReverse64(&x, mask);
+    return static_cast<int>(x);
+#else
+    return 63 - __builtin_clzll(mask);
+#endif
+  }
+#endif  // DELIMITER_FINDER_SIMD
+
+  char m_chars[k_max_chars] = {};
+  std::size_t m_count = 0;
+};
+
+}  // namespace import_table
+}  // namespace mysqlsh
+
+#undef DELIMITER_FINDER_SIMD
+
+#endif  // MODULES_UTIL_IMPORT_TABLE_DELIMITER_FINDER_H_
@@ -273,7 +273,8 @@ bool Import_table_option_pack::is_compressed(const std::string &path) {
   const auto extension = std::get<1>(shcore::path::split_extension(path));
 
   return extension == get_extension(Compression::GZIP) ||
-         extension == get_extension(Compression::ZSTD);
+         extension == get_extension(Compression::ZSTD) ||
+         extension == get_extension(Compression::LZ4);
 }
 
 void Import_table_option_pack::set_replace_duplicates(bool flag) {
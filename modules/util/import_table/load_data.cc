@@ -81,8 +81,136 @@ int local_infile_error_nop(void * /* userdata */, char * /* error_msg */,
   return CR_LOAD_DATA_LOCAL_INFILE_REJECTED;
 }
 
+void skip(mysqlshdk::storage::IFile *file, uint64_t bytes) {
+  try {
+    file->seek(bytes);
+  } catch (const std::logic_error &) {
+    static constexpr std::size_t length = 1024;
+    char buffer[length];
+
+    // seek() failed (i.e. it's not implemented), read beginning of the file
+    while (bytes > 0) {
+      const auto read =
+          file->read(buffer, std::min<std::size_t>(bytes, length));
+
+      if (read <= 0) {
+        break;
+      }
+
+      bytes -= read;
+    }
+  }
+}
+
 }  // namespace
 
+uint64_t File_range::position() const {
+  std::lock_guard lock{m_mutex};
+  return m_reserved;
+}
+
+uint64_t File_range::end() const {
+  std::lock_guard lock{m_mutex};
+  return m_end;
+}
+
+std::size_t File_range::reserve(std::size_t length) {
+  std::lock_guard lock{m_mutex};
+  assert(m_position == m_reserved);
+
+  if (m_position >= m_end) {
+    return 0;
+  }
+
+  length = std::min<uint64_t>(length, m_end - m_position);
+  m_reserved = m_position + length;
+
+  return length;
+}
+
+void File_range::commit(std::size_t bytes) {
+  std::lock_guard lock{m_mutex};
+  assert(m_position + bytes <= m_reserved);
+
+  m_position += bytes;
+  m_reserved = m_position;
+}
+
+std::shared_ptr<File_range> File_range::split(uint64_t offset) {
+  std::lock_guard lock{m_mutex};
+
+  // reserved bytes may be read at any moment, range can only be split after
+  // them
+  if (offset < m_reserved || offset >= m_end) {
+    return {};
+  }
+
+  auto range = std::make_shared<File_range>(offset, m_end);
+  m_end = offset;
+
+  return range;
+}
+
+bool has_row_boundaries(const Dialect &dialect) {
+  return !dialect.lines_terminated_by.empty() &&
+         dialect.fields_terminated_by != dialect.lines_terminated_by;
+}
+
+std::optional<uint64_t> find_row_start(const Dialect &dialect,
+                                       mysqlshdk::storage::IFile *file,
+                                       uint64_t offset) {
+  assert(has_row_boundaries(dialect));
+  assert(file->is_open());
+
+  // default dialect uses the same rules as the sub-chunking: escape character
+  // is not checked
+  const auto &needle = dialect == Dialect::default_()
+                           ? dialect.lines_terminated_by.substr(0, 1)
+                           : dialect.lines_terminated_by;
+  const auto escape = dialect == Dialect::default_() ||
+                              dialect.fields_escaped_by.empty()
+                          ? std::optional<char>{}
+                          : dialect.fields_escaped_by[0];
+
+  // read one byte before the offset, to check if terminator is escaped; data
+  // before that is not read, file has to support seeking
+  const auto start = offset > 0 ? offset - 1 : 0;
+  file->seek(start);
+
+  static constexpr std::size_t k_block_size = 64 * 1024;
+  std::string data;
+  std::size_t from = offset - start;
+
+  while (true) {
+    auto p = data.find(needle, from);
+
+    while (p != std::string::npos) {
+      if (!escape.has_value() || 0 == p || data[p - 1] != *escape) {
+        return start + p + needle.size();
+      }
+
+      p += needle.size();
+      from = p;
+      p = data.find(needle, p);
+    }
+
+    // terminator may span the blocks
+    if (data.size() >= needle.size()) {
+      from = std::max(from, data.size() - needle.size() + 1);
+    }
+
+    const auto size = data.size();
+    data.resize(size + k_block_size);
+    const auto bytes = file->read(&data[size], k_block_size);
+
+    if (bytes <= 0) {
+      return {};
+    }
+
+    data.resize(size + bytes);
+  }
+}
+
 Transaction_buffer::Transaction_buffer(const Dialect &dialect,
                                        mysqlshdk::storage::IFile *file,
                                        uint64_t max_transaction_size,
@@ -91,8 +219,7 @@ Transaction_buffer::Transaction_buffer(const Dialect &dialect,
   m_options.max_trx_size = max_transaction_size;
   m_options.skip_bytes = skip_bytes;
 
-  if (m_dialect.lines_terminated_by.empty() ||
-      m_dialect.fields_terminated_by == m_dialect.lines_terminated_by) {
+  if (!has_row_boundaries(m_dialect)) {
     // we're unable to sub-chunk properly in this case
     m_options.max_trx_size = 0;
   } else if (m_dialect == Dialect::default_()) {
@@ -112,31 +239,18 @@ Transaction_buffer::Transaction_buffer(const Dialect &dialect,
         &Transaction_buffer::find_last_row_boundary_before_impl_escape;
   }
 
+  if (has_row_boundaries(m_dialect)) {
+    m_line_terminator = Delimiter_finder{m_dialect.lines_terminated_by[0]};
+  }
+
   if (!m_file->is_open()) {
     m_file->open(mysqlshdk::storage::Mode::READ);
   }
 
   // always skip bytes if requested to
   if (m_options.skip_bytes > 0) {
-    try {
-      m_file->seek(m_options.skip_bytes);
-      m_options.skip_bytes = 0;
-    } catch (const std::logic_error &) {
-      static constexpr std::size_t length = 1024;
-      char buffer[length];
-
-      // seek() failed (i.e. it's not implemented), read beginning of the file
-      while (m_options.skip_bytes > 0) {
-        const auto bytes = m_file->read(
-            buffer, std::min<std::size_t>(m_options.skip_bytes, length));
-
-        if (bytes <= 0) {
-          break;
-        }
-
-        m_options.skip_bytes -= bytes;
-      }
-    }
+    skip(m_file, m_options.skip_bytes);
+    m_options.skip_bytes = 0;
   }
 }
 
@@ -203,10 +317,27 @@ int Transaction_buffer::consume(char *buffer, unsigned int length) {
   return length;
 }
 
+ssize_t Transaction_buffer::read_file(void *buffer, std::size_t length) {
+  if (!m_options.range) {
+    return m_file->read(buffer, length);
+  }
+
+  length = m_options.range->reserve(length);
+
+  if (0 == length) {
+    return 0;
+  }
+
+  const auto bytes = m_file->read(buffer, length);
+  m_options.range->commit(bytes > 0 ? bytes : 0);
+
+  return bytes;
+}
+
 int Transaction_buffer::read(char *buffer, unsigned int length) {
   if (m_options.max_trx_size == 0) {
     // regular read if truncation is not enabled
-    return m_file->read(buffer, length);
+    return read_file(buffer, length);
   }
 
   if (m_options.fast_sub_chunking) {
@@ -219,7 +350,7 @@ int Transaction_buffer::read(char *buffer, unsigned int length) {
     if (!m_eof) {
       auto end = m_data.size();
       m_data.resize(end + count);
-      bytes = m_file->read(&m_data[end], count);
+      bytes = read_file(&m_data[end], count);
       if (bytes <= 0) {
         m_data.resize(end);
         if (bytes == 0) m_eof = true;
@@ -356,13 +487,13 @@ uint64_t Transaction_buffer::find_last_row_boundary_before_impl_default(
     uint64_t limit) {
   assert(m_dialect == Dialect::default_());
 
-  const char needle = m_dialect.lines_terminated_by[0];
+  const auto needle = m_dialect.lines_terminated_by.substr(0, 1);
   auto p = limit < m_data.length() ? static_cast<size_t>(limit - 1)
                                    : m_data.length();
 
   if (p == 0) return 0;
 
-  p = m_data.rfind(needle, p);
+  p = rfind_terminator(needle, p);
 
   if (p >= m_data.length()) return 0;
 
@@ -393,7 +524,7 @@ uint64_t Transaction_buffer::find_last_row_boundary_before_impl_no_escape(
 
   if (p < needle.size()) return 0;
 
-  p = m_data.rfind(needle, p);
+  p = rfind_terminator(needle, p);
 
   if (p >= m_data.length()) return 0;
 
@@ -431,7 +562,7 @@ uint64_t Transaction_buffer::find_last_row_boundary_before_impl_escape(
 
   if (p < needle.size()) return 0;
 
-  p = m_data.rfind(needle, p);
+  p = rfind_terminator(needle, p);
 
   while (p != std::string::npos) {
     if (!(p > 0 && m_data[p - 1] == m_dialect.fields_escaped_by[0])) {
@@ -444,12 +575,36 @@ uint64_t Transaction_buffer::find_last_row_boundary_before_impl_escape(
     }
 
     p -= needle.size();
-    p = m_data.rfind(needle, p);
+    p = rfind_terminator(needle, p);
   }
 
   return 0;
 }
 
+std::size_t Transaction_buffer::rfind_terminator(const std::string &needle,
+                                                 std::size_t pos) const {
+  assert(!needle.empty());
+  assert(needle[0] == m_dialect.lines_terminated_by[0]);
+
+  if (needle.size() > m_data.size()) return std::string::npos;
+
+  const auto begin = m_data.data();
+  // one past the last position where the needle can start
+  auto end = begin + std::min(pos, m_data.size() - needle.size()) + 1;
+
+  while (true) {
+    const auto p = m_line_terminator.find_last(begin, end);
+
+    if (p == end) return std::string::npos;
+
+    const auto offset = static_cast<std::size_t>(p - begin);
+
+    if (0 == m_data.compare(offset, needle.size(), needle)) return offset;
+
+    end = p;
+  }
+}
+
 int Transaction_buffer::fast_sub_chunking(char *buffer, unsigned int length) {
   if (!m_data.empty()) {
     // if data is stored locally, then a row didn't fit into an empty buffer,
@@ -755,6 +910,9 @@ std::string Load_data_worker::load_data_body(
 
       case Compression::GZIP:
         throw std::logic_error("Unsupported LOAD DATA compression: gzip");
+
+      case Compression::LZ4:
+        throw std::logic_error("Unsupported LOAD DATA compression: lz4");
     }
 
     throw std::logic_error("Unhandled Compression value.");
@@ -28,13 +28,17 @@
 
 #include <atomic>
 #include <exception>
+#include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <vector>
 
 #include "modules/util/import_table/chunk_file.h"
+#include "modules/util/import_table/delimiter_finder.h"
 #include "modules/util/import_table/import_table.h"
 #include "modules/util/import_table/import_table_options.h"
 #include "mysqlshdk/include/shellcore/shell_options.h"
@@ -48,14 +52,101 @@
 namespace mysqlsh {
 namespace import_table {
 
+/**
+ * Range of (uncompressed) bytes of a file which is being loaded by a single
+ * worker. The range can be split while the file is being read, the remaining
+ * data can then be loaded by another worker.
+ */
+class File_range final {
+ public:
+  static constexpr uint64_t k_unbounded = std::numeric_limits<uint64_t>::max();
+
+  explicit File_range(uint64_t begin, uint64_t end = k_unbounded)
+      : m_begin(begin), m_position(begin), m_reserved(begin), m_end(end) {}
+
+  File_range(const File_range &) = delete;
+  File_range(File_range &&) = delete;
+
+  File_range &operator=(const File_range &) = delete;
+  File_range &operator=(File_range &&) = delete;
+
+  ~File_range() = default;
+
+  uint64_t begin() const noexcept { return m_begin; }
+
+  /**
+   * Offset up to which the data was (or is being) read.
+   */
+  uint64_t position() const;
+
+  uint64_t end() const;
+
+  /**
+   * Reserves the given number of bytes, before they are read from the file.
+   *
+   * @param length Number of bytes to be read.
+   *
+   * @returns Number of bytes which can be read, 0 if end of range was reached.
+   */
+  std::size_t reserve(std::size_t length);
+
+  /**
+   * Marks the reserved bytes as read.
+   *
+   * @param bytes Number of bytes which were actually read.
+   */
+  void commit(std::size_t bytes);
+
+  /**
+   * Splits this range at the given offset. This range is going to end at that
+   * offset, the returned range covers the rest of the data.
+   *
+   * @param offset Offset where the new range begins.
+   *
+   * @returns New range, or nullptr if data past the given offset was already
+   *          read.
+   */
+  std::shared_ptr<File_range> split(uint64_t offset);
+
+ private:
+  mutable std::mutex m_mutex;
+  const uint64_t m_begin;
+  uint64_t m_position;
+  uint64_t m_reserved;
+  uint64_t m_end;
+};
+
 struct Transaction_options {
   uint64_t max_trx_size = 0;  //< 0 disables the sub-chunking
   uint64_t skip_bytes = 0;    //< start transaction at this offset
   std::function<void()> transaction_started;
   std::function<void(uint64_t)> transaction_finished;
   bool fast_sub_chunking = false;
+  std::shared_ptr<File_range> range;  //< if set, only this range is read
 };
 
+/**
+ * Checks if rows of a file written using the given dialect can be safely
+ * located without parsing the whole file.
+ */
+bool has_row_boundaries(const Dialect &dialect);
+
+/**
+ * Finds the offset of the first row which begins after the given offset, using
+ * the same rules as the sub-chunking does.
+ *
+ * @param dialect Dialect of the file, has_row_boundaries() has to be true.
+ * @param file File to be searched, has to be open.
+ * @param offset Offset where the search starts.
+ *
+ * @returns Offset of the row, or std::nullopt if there are no more rows.
+ *
+ * @throws std::logic_error if file does not support seeking
+ */
+std::optional<uint64_t> find_row_start(const Dialect &dialect,
+                                       mysqlshdk::storage::IFile *file,
+                                       uint64_t offset);
+
 class Transaction_buffer {
  public:
   Transaction_buffer() = default;
@@ -88,6 +179,8 @@ class Transaction_buffer {
 
   int consume(char *buffer, unsigned int length);
 
+  ssize_t read_file(void *buffer, std::size_t length);
+
   int64_t trx_bytes_left() const { return m_options.max_trx_size - m_trx_size; }
 
   uint64_t (Transaction_buffer::*find_first_row_boundary_after)() const;
@@ -102,6 +195,13 @@ class Transaction_buffer {
   uint64_t find_first_row_boundary_after_impl_escape() const;
   uint64_t find_last_row_boundary_before_impl_escape(uint64_t limit);
 
+  /**
+   * Same as m_data.rfind(needle, pos), needle has to begin with the first
+   * character of LINES TERMINATED BY.
+   */
+  std::size_t rfind_terminator(const std::string &needle,
+                               std::size_t pos) const;
+
   void set_trx_end_offset(uint64_t end) { m_trx_end_offset = m_trx_size + end; }
 
   Dialect m_dialect;
@@ -116,6 +216,9 @@ class Transaction_buffer {
 
   std::string m_data;
 
+  // finds the first character of LINES TERMINATED BY
+  Delimiter_finder m_line_terminator;
+
   uint64_t m_oversized_rows = 0;
 
   std::function<void(uint64_t)> m_on_oversized_row;
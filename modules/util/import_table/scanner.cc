@@ -66,7 +66,12 @@ Scanner::Scanner(const Dialect &dialect, uint64_t skip_rows)
       m_lines_starting_by(dialect.lines_starting_by),
       m_lines_terminated_by(dialect.lines_terminated_by),
       m_enclosed_char(first_char(dialect.fields_enclosed_by)),
-      m_escaped_char(first_char(dialect.fields_escaped_by)) {
+      m_escaped_char(first_char(dialect.fields_escaped_by)),
+      m_row_delimiters({m_escaped_char, m_lines_terminated_by.first}),
+      m_line_start_delimiters({m_lines_starting_by.first}),
+      m_field_delimiters({m_escaped_char, m_lines_terminated_by.first,
+                          m_fields_terminated_by.first}),
+      m_enclosed_field_delimiters({m_escaped_char, m_enclosed_char}) {
   if (dialect.lines_terminated_by.empty() ||
       dialect.lines_terminated_by == dialect.fields_terminated_by) {
     throw std::invalid_argument("Scanner: unsupported LINES TERMINATED BY: '" +
@@ -203,10 +208,21 @@ bool Scanner::contains(const Sequence &s) noexcept {
   return false;
 }
 
+bool Scanner::skip_to(const Delimiter_finder &finder) noexcept {
+  // characters which were pushed back are always processed one by one
+  if (m_stack_position == m_stack_bottom) {
+    const auto next = finder.find_first(m_data, m_data + m_length);
+    m_length -= next - m_data;
+    m_data = next;
+  }
+
+  return m_length > 0;
+}
+
 bool Scanner::skip_row() noexcept {
   int chr;
 
-  while (m_length) {
+  while (skip_to(m_row_delimiters)) {
     chr = get();
 
     // check for escaped LINES TERMINATED BY sequences
@@ -241,7 +257,7 @@ bool Scanner::skip_line_start() noexcept {
 
   int chr;
 
-  while (m_length) {
+  while (skip_to(m_line_start_delimiters)) {
     chr = get();
 
     if (chr == m_lines_starting_by.first && contains(m_lines_starting_by)) {
@@ -271,7 +287,12 @@ Scanner::Field_status Scanner::scan_field() noexcept {
     }                                 \
   } while (false)
 
-  while (m_length) {
+  // characters which are not delimiters don't need to be processed
+  const auto &delimiters = used(m_found_enclosed_char)
+                               ? m_enclosed_field_delimiters
+                               : m_field_delimiters;
+
+  while (skip_to(delimiters)) {
     chr = get();
 
     if (chr == m_escaped_char) {
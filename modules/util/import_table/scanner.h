@@ -29,6 +29,7 @@
 #include <cstdint>
 #include <string>
 
+#include "modules/util/import_table/delimiter_finder.h"
 #include "modules/util/import_table/dialect.h"
 
 namespace mysqlsh {
@@ -121,6 +122,14 @@ class Scanner {
    */
   bool contains(const Sequence &s) noexcept;
 
+  /**
+   * Skips characters which are not found by the given finder, if there are no
+   * characters which were pushed back.
+   *
+   * @returns true if there is more data in the block
+   */
+  bool skip_to(const Delimiter_finder &finder) noexcept;
+
   /**
    * Skips characters, looks only for LINES TERMINATED BY sequence, first
    * character of this sequence cannot be escaped.
@@ -153,6 +162,15 @@ class Scanner {
   int m_enclosed_char;
   int m_escaped_char;
 
+  // characters which need to be processed when skipping a row
+  Delimiter_finder m_row_delimiters;
+  // characters which need to be processed when looking for LINES STARTING BY
+  Delimiter_finder m_line_start_delimiters;
+  // characters which need to be processed in a field which is not enclosed
+  Delimiter_finder m_field_delimiters;
+  // characters which need to be processed in an enclosed field
+  Delimiter_finder m_enclosed_field_delimiters;
+
   std::string m_stack;
   char *m_stack_bottom;
   char *m_stack_position;
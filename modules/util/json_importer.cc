@@ -29,17 +29,27 @@
 #else
 #include <poll.h>
 #endif
+#include <algorithm>
+#include <atomic>
 #include <deque>
+#include <exception>
+#include <fstream>
 #include <istream>
+#include <mutex>
+#include <thread>
 #include <utility>
+#include <vector>
 #include "mysqlshdk/libs/db/mysqlx/session.h"
 #include "mysqlshdk/libs/db/mysqlx/util/setter_any.h"
+#include "mysqlshdk/libs/utils/synchronized_queue.h"
 #include "mysqlshdk/libs/utils/utils_buffered_input.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
 #include "scripting/shexcept.h"
 #include "shellcore/interrupt_handler.h"
+#include "shellcore/scoped_contexts.h"
 
 namespace mysqlsh {
 
@@ -186,6 +196,27 @@ Json_importer Prepare_json_import::build() {
  */
 static constexpr const int k_inserts_per_transaction = 8;
 
+namespace {
+
+// limits of the size of the file chunks processed by a single thread
+constexpr std::size_t k_min_chunk_size = 1024 * 1024;
+constexpr std::size_t k_max_chunk_size = 64 * 1024 * 1024;
+
+// size of the buffer used to find the boundaries of the documents
+constexpr std::size_t k_read_buffer_size = 1024 * 1024;
+
+// number of inserts which are sent by a single thread before a response is
+// received when importing in parallel
+constexpr int k_max_pending_responses = 4;
+
+struct File_chunk {
+  std::size_t offset = 0;
+  // zero means that there are no more chunks
+  std::size_t length = 0;
+};
+
+}  // namespace
+
 Json_importer::Json_importer(
     const std::shared_ptr<mysqlshdk::db::mysqlx::Session> &session)
     : m_session(session) {
@@ -195,7 +226,7 @@ Json_importer::Json_importer(
   auto row = result->fetch_one();
   if (!row)
     throw std::logic_error("Query result returned fewer rows than expected");
-  m_packet_size_tracker.max_packet = row->get_uint(0);
+  m_max_packet = row->get_uint(0);
 }
 
 void Json_importer::set_target_table(const std::string &schema,
@@ -253,6 +284,15 @@ void Json_importer::load_from(const shcore::Document_reader_options &options) {
 
   if (!m_file_path.empty()) {
     auto full_path = shcore::path::expand_user(m_file_path);
+
+    // only regular files can be split into chunks, there's no point in
+    // splitting small files
+    if (m_threads > 1 && m_session_factory && !shcore::is_fifo(full_path) &&
+        shcore::file_size(full_path) > k_min_chunk_size) {
+      load_from_parallel(full_path, options);
+      return;
+    }
+
     input.open(full_path);
   }
 
@@ -263,14 +303,10 @@ void Json_importer::load_from(shcore::Buffered_input *input,
                               const shcore::Document_reader_options &options) {
   m_stats.items_processed = 0;
   m_stats.bytes_processed = 0;
-  m_packet_size_tracker.inserts_in_this_transaction = 0;
 
-  // schema and collection target are already set here, so we can cache
-  // mysqlx::crud::insert header size here
-  m_packet_size_tracker.crud_insert_overhead_bytes =
-      m_batch_insert.ByteSizeLong();
-
-  m_session->execute("START TRANSACTION");
+  Inserter inserter{m_session, m_batch_insert, m_max_packet, 1,
+                    [this](uint64_t documents) { on_imported(documents); }};
+  inserter.start();
 
   bool cancel = false;
   shcore::Interrupt_handler intr_handler([&cancel]() -> bool {
@@ -285,19 +321,206 @@ void Json_importer::load_from(shcore::Buffered_input *input,
     std::string jd = reader.next();
 
     if (!jd.empty()) {
+      m_stats.bytes_processed += jd.size();
+      m_stats.items_processed++;
       // todo(kg): move jd string all the way to protobuf's
       // Scalar_String::set_value
-      put(std::move(jd));
+      inserter.put(std::move(jd));
     }
   }
 
-  flush();
-  commit(true);
+  inserter.finish();
+
+  if (cancel) throw shcore::cancelled("JSON documents import cancelled.");
+}
+
+/**
+ * The main thread splits the file into chunks at the boundaries of the
+ * documents, each chunk is then parsed and inserted by one of the threads.
+ * Each thread uses its own session and transaction.
+ */
+void Json_importer::load_from_parallel(
+    const std::string &path, const shcore::Document_reader_options &options) {
+  m_stats.items_processed = 0;
+  m_stats.bytes_processed = 0;
+
+  const auto threads = static_cast<std::size_t>(m_threads);
+  const auto chunk_size =
+      std::clamp(shcore::file_size(path) / (threads * 4), k_min_chunk_size,
+                 k_max_chunk_size);
+
+  std::vector<std::shared_ptr<mysqlshdk::db::mysqlx::Session>> sessions;
+  sessions.emplace_back(m_session);
+
+  while (sessions.size() < threads) {
+    auto session = m_session_factory();
+    session->execute("set session session_track_gtids=OFF");
+    sessions.emplace_back(std::move(session));
+  }
+
+  std::atomic<bool> cancel = false;
+  shcore::Interrupt_handler intr_handler([&cancel]() -> bool {
+    cancel = true;
+    return false;
+  });
+
+  std::mutex mutex;
+  std::exception_ptr error;
+  const auto handle_error = [&mutex, &error, &cancel]() {
+    std::lock_guard lock{mutex};
+
+    if (!error) {
+      error = std::current_exception();
+    }
+
+    cancel = true;
+  };
+
+  shcore::Synchronized_queue<File_chunk> chunks;
+  std::vector<std::thread> workers;
+
+  for (const auto &session : sessions) {
+    workers.emplace_back(mysqlsh::spawn_scoped_thread([&, session]() {
+      try {
+        Inserter inserter{session, m_batch_insert, m_max_packet,
+                          k_max_pending_responses,
+                          [this, &mutex](uint64_t documents) {
+                            std::lock_guard lock{mutex};
+                            on_imported(documents);
+                          }};
+        inserter.start();
+
+        while (true) {
+          const auto chunk = chunks.pop();
+
+          if (0 == chunk.length) {
+            break;
+          }
+
+          if (cancel) {
+            continue;
+          }
+
+          shcore::Buffered_input input;
+          input.open(path, chunk.offset, chunk.length);
+
+          shcore::Json_reader reader(&input, options);
+
+          if (0 == chunk.offset) {
+            reader.parse_bom();
+          }
+
+          uint64_t items = 0;
+          uint64_t bytes = 0;
+
+          while (!reader.eof() && !cancel) {
+            std::string jd = reader.next();
+
+            if (!jd.empty()) {
+              bytes += jd.size();
+              ++items;
+              inserter.put(std::move(jd));
+            }
+          }
+
+          std::lock_guard lock{mutex};
+          m_stats.items_processed += items;
+          m_stats.bytes_processed += bytes;
+        }
+
+        inserter.finish();
+      } catch (...) {
+        handle_error();
+      }
+    }));
+  }
+
+  try {
+#ifdef _WIN32
+    std::ifstream file{shcore::utf8_to_wide(path), std::ios::binary};
+#else
+    std::ifstream file{path, std::ios::binary};
+#endif
+
+    if (!file.good()) {
+      throw std::runtime_error("Cannot open file: " + path + ".");
+    }
+
+    std::vector<char> buffer(k_read_buffer_size);
+    shcore::Json_document_splitter splitter;
+    std::size_t chunk_begin = 0;
+    std::size_t offset = 0;
+
+    while (!cancel && file) {
+      file.read(buffer.data(), buffer.size());
+      const auto bytes = static_cast<std::size_t>(file.gcount());
+
+      if (0 == bytes) {
+        break;
+      }
+
+      const auto end = splitter.scan(buffer.data(), bytes);
+
+      if (std::string::npos != end && offset + end - chunk_begin >= chunk_size) {
+        chunks.push(File_chunk{chunk_begin, offset + end - chunk_begin});
+        chunk_begin = offset + end;
+      }
+
+      offset += bytes;
+    }
+
+    if (!cancel && offset > chunk_begin) {
+      chunks.push(File_chunk{chunk_begin, offset - chunk_begin});
+    }
+  } catch (...) {
+    handle_error();
+  }
+
+  chunks.shutdown(workers.size());
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  if (error) std::rethrow_exception(error);
 
   if (cancel) throw shcore::cancelled("JSON documents import cancelled.");
 }
 
-void Json_importer::put(const std::string &item) {
+void Json_importer::on_imported(uint64_t documents) {
+  m_stats.documents_successfully_imported += documents;
+
+  if (m_print) {
+    m_print(".. " + std::to_string(m_stats.documents_successfully_imported));
+  }
+}
+
+Json_importer::Inserter::Inserter(
+    std::shared_ptr<mysqlshdk::db::mysqlx::Session> session,
+    const ::Mysqlx::Crud::Insert &insert, size_t max_packet,
+    int max_pending_responses, std::function<void(uint64_t)> on_imported)
+    : m_session(std::move(session)),
+      m_batch_insert(insert),
+      m_max_pending_responses(max_pending_responses),
+      m_on_imported(std::move(on_imported)) {
+  m_packet_size_tracker.max_packet = max_packet;
+  // schema and collection target are already set here, so we can cache
+  // mysqlx::crud::insert header size here
+  m_packet_size_tracker.crud_insert_overhead_bytes =
+      m_batch_insert.ByteSizeLong();
+}
+
+void Json_importer::Inserter::start() {
+  m_packet_size_tracker.inserts_in_this_transaction = 0;
+  m_session->execute("START TRANSACTION");
+}
+
+void Json_importer::Inserter::finish() {
+  flush();
+  commit(true);
+}
+
+void Json_importer::Inserter::put(const std::string &item) {
   if (m_packet_size_tracker.will_overflow(item.size())) {
     flush();
     if (m_packet_size_tracker.inserts_in_this_transaction >=
@@ -306,25 +529,21 @@ void Json_importer::put(const std::string &item) {
     }
   }
 
-  m_stats.bytes_processed += item.size();
-  m_stats.items_processed++;
   add_to_request(item);
 }
 
-void Json_importer::update_statistics(xcl::XQuery_result *xquery_result) {
+void Json_importer::Inserter::update_statistics(
+    xcl::XQuery_result *xquery_result) {
   if (xquery_result == nullptr) return;
 
   uint64_t affected_rows = 0;
   bool ret = xquery_result->try_get_affected_rows(&affected_rows);
-  if (ret) {
-    m_stats.documents_successfully_imported += affected_rows;
-    if (m_print) {
-      m_print(".. " + std::to_string(m_stats.documents_successfully_imported));
-    }
+  if (ret && m_on_imported) {
+    m_on_imported(affected_rows);
   }
 }
 
-void Json_importer::recv_response(bool block) {
+void Json_importer::Inserter::recv_response(bool block) {
   if (m_pending_response > 0) {
     bool should_receive = false;
 
@@ -358,11 +577,13 @@ void Json_importer::recv_response(bool block) {
   }
 }
 
-void Json_importer::flush() {
+void Json_importer::Inserter::flush() {
   if (m_packet_size_tracker.rows_in_insert > 0) {
     xcl::XError error;
     if (m_proto_interleaved) {
-      recv_response(true);
+      // receive the responses which are already available, block only if
+      // there are too many requests in flight
+      recv_response(m_pending_response >= m_max_pending_responses);
       error = m_session->get_driver_obj()->get_protocol().send(m_batch_insert);
       m_pending_response++;
     } else {
@@ -378,10 +599,10 @@ void Json_importer::flush() {
   }
 }
 
-void Json_importer::commit(bool final_commit) {
+void Json_importer::Inserter::commit(bool final_commit) {
   if (m_proto_interleaved) {
     xcl::XError error;
-    recv_response(true);
+    recv_response(m_pending_response >= m_max_pending_responses);
 
     ::Mysqlx::Sql::StmtExecute stmt;
     stmt.set_stmt(!final_commit ? "COMMIT AND CHAIN" : "COMMIT");
@@ -399,7 +620,7 @@ void Json_importer::commit(bool final_commit) {
   m_packet_size_tracker.inserts_in_this_transaction = 0;
 }
 
-void Json_importer::add_to_request(const std::string &doc) {
+void Json_importer::Inserter::add_to_request(const std::string &doc) {
   auto fields = m_batch_insert.mutable_row()->Add()->mutable_field();
   mysqlshdk::db::mysqlx::util::set_scalar(*fields->Add(), doc);
 
@@ -26,6 +26,8 @@
 #ifndef MODULES_UTIL_JSON_IMPORTER_H_
 #define MODULES_UTIL_JSON_IMPORTER_H_
 
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
@@ -185,6 +187,9 @@ class Prepare_json_import {
 
 class Json_importer {
  public:
+  using Session_factory =
+      std::function<std::shared_ptr<mysqlshdk::db::mysqlx::Session>()>;
+
   explicit Json_importer(
       const std::shared_ptr<mysqlshdk::db::mysqlx::Session> &session);
   ~Json_importer() {}
@@ -196,6 +201,17 @@ class Json_importer {
   void set_print_callback(
       const std::function<void(const std::string &)> &callback);
 
+  /**
+   * Enables the parallel import.
+   *
+   * @param threads Number of threads used to parse and insert the documents.
+   * @param factory Creates the additional sessions used by the threads.
+   */
+  void set_threads(int64_t threads, const Session_factory &factory) {
+    m_threads = threads;
+    m_session_factory = factory;
+  }
+
   /**
    * Set path to JSON document.
    * @param path Path to JSON document. Empty path enables read from stdin.
@@ -206,18 +222,6 @@ class Json_importer {
   void print_stats();
 
  private:
-  void load_from(shcore::Buffered_input *input,
-                 const shcore::Document_reader_options &options);
-  void put(const std::string &item);
-  void recv_response(bool block = false);
-  void flush();
-  void commit(bool final_commit = false);
-  void add_to_request(const std::string &doc);
-  void update_statistics(xcl::XQuery_result *xquery_result);
-
-  ::Mysqlx::Crud::Insert m_batch_insert;
-  std::shared_ptr<mysqlshdk::db::mysqlx::Session> m_session;
-
   struct Packet_size_tracker {
     /**
      * Returns protobuf crud insert packet size after new document append with
@@ -275,17 +279,75 @@ class Json_importer {
     int inserts_in_this_transaction = 0;
 
     size_t crud_insert_overhead_bytes = 0;
-  } m_packet_size_tracker;
+  };
+
+  /**
+   * Inserts documents in batches using a single session.
+   */
+  class Inserter final {
+   public:
+    /**
+     * @param session Session used to insert the documents.
+     * @param insert Insert message which specifies the target.
+     * @param max_packet Value of mysqlx_max_allowed_packet.
+     * @param max_pending_responses Number of the requests which can be sent
+     *        before waiting for a response.
+     * @param on_imported Called with the number of inserted documents.
+     */
+    Inserter(std::shared_ptr<mysqlshdk::db::mysqlx::Session> session,
+             const ::Mysqlx::Crud::Insert &insert, size_t max_packet,
+             int max_pending_responses,
+             std::function<void(uint64_t)> on_imported);
+
+    Inserter(const Inserter &other) = delete;
+    Inserter(Inserter &&other) = delete;
+
+    Inserter &operator=(const Inserter &other) = delete;
+    Inserter &operator=(Inserter &&other) = delete;
+
+    ~Inserter() = default;
+
+    void start();
+    void put(const std::string &item);
+    void finish();
+
+   private:
+    void recv_response(bool block = false);
+    void flush();
+    void commit(bool final_commit = false);
+    void add_to_request(const std::string &doc);
+    void update_statistics(xcl::XQuery_result *xquery_result);
+
+    std::shared_ptr<mysqlshdk::db::mysqlx::Session> m_session;
+    ::Mysqlx::Crud::Insert m_batch_insert;
+    Packet_size_tracker m_packet_size_tracker;
 
 // todo(kg): JSON import to MySQL Server for Windows stuck on vio_ssl_write when
 // MySQL Shell for Windows has SSL and interleave mode enabled. Therefore we
 // disable interleave mode until we fix that problem.
 #ifdef _WIN32
-  const bool m_proto_interleaved = false;
+    const bool m_proto_interleaved = false;
 #else
-  const bool m_proto_interleaved = true;
+    const bool m_proto_interleaved = true;
 #endif
-  int m_pending_response = 0;
+    int m_pending_response = 0;
+    int m_max_pending_responses = 1;
+    std::function<void(uint64_t)> m_on_imported;
+  };
+
+  void load_from(shcore::Buffered_input *input,
+                 const shcore::Document_reader_options &options);
+  void load_from_parallel(const std::string &path,
+                          const shcore::Document_reader_options &options);
+  void on_imported(uint64_t documents);
+
+  ::Mysqlx::Crud::Insert m_batch_insert;
+  std::shared_ptr<mysqlshdk::db::mysqlx::Session> m_session;
+  size_t m_max_packet = 0;
+
+  int64_t m_threads = 1;
+  Session_factory m_session_factory;
+
   std::function<void(const std::string &)> m_print = nullptr;
 
   struct {
@@ -34,6 +34,7 @@
 #include <iterator>
 #include <list>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <thread>
@@ -97,6 +98,10 @@ static constexpr const int k_supported_dump_version_minor = 0;
 // before we enable sub-chunking for it.
 static constexpr const auto k_chunk_size_overshoot_tolerance = 1.5;
 
+// Minimum number of bytes which have to be left to load in a chunk file, before
+// it's split and its remaining part is handed over to an idle worker.
+static constexpr const uint64_t k_min_chunk_split_size = 64 * 1024 * 1024;
+
 namespace {
 
 using Session_ptr = std::shared_ptr<mysqlshdk::db::mysql::Session>;
@@ -1176,14 +1181,17 @@ void Dump_loader::Worker::Load_data_task::load(Dump_loader *loader,
   loader->m_num_threads_loading++;
 
   shcore::on_leave_scope cleanup([this, loader]() {
-    std::lock_guard<std::mutex> lock(loader->m_tables_being_loaded_mutex);
-    auto it = loader->m_tables_being_loaded.find(key());
-    while (it != loader->m_tables_being_loaded.end() && it->first == key()) {
-      if (it->second == chunk().file_size) {
-        loader->m_tables_being_loaded.erase(it);
-        break;
+    // split chunks are not tracked, the original task removes the entry
+    if (!is_split()) {
+      std::lock_guard<std::mutex> lock(loader->m_tables_being_loaded_mutex);
+      auto it = loader->m_tables_being_loaded.find(key());
+      while (it != loader->m_tables_being_loaded.end() && it->first == key()) {
+        if (it->second == chunk().file_size) {
+          loader->m_tables_being_loaded.erase(it);
+          break;
+        }
+        ++it;
       }
-      ++it;
     }
 
     loader->m_num_threads_loading--;
@@ -1205,6 +1213,63 @@ void Dump_loader::Worker::Load_data_task::load(Dump_loader *loader,
   loader->m_stats.total_files_processed += stats.total_files_processed;
 }
 
+Dump_loader::Worker::Load_chunk_task::Load_chunk_task(
+    Dump_reader::Table_chunk chunk, bool resume, uint64_t bytes_to_skip,
+    bool splittable)
+    : Load_data_task(std::move(chunk), resume),
+      m_bytes_to_skip(bytes_to_skip),
+      m_file_name(this->chunk().file->filename()) {
+  if (splittable) {
+    m_range = std::make_shared<import_table::File_range>(m_bytes_to_skip);
+  }
+}
+
+Dump_loader::Worker::Load_chunk_task::Load_chunk_task(
+    Dump_reader::Table_chunk chunk, std::shared_ptr<Split_chunk> split,
+    std::shared_ptr<import_table::File_range> parent_range, uint64_t offset)
+    : Load_data_task(std::move(chunk), false),
+      m_bytes_to_skip(offset),
+      m_file_name(this->chunk().file->filename()),
+      m_parent_range(std::move(parent_range)),
+      m_split(std::move(split)) {}
+
+void Dump_loader::Worker::Load_chunk_task::claim_range() {
+  assert(is_split());
+
+  const auto &file = chunk().file;
+  const auto dialect =
+      import_table::Import_table_options::unpack(chunk().options).dialect();
+
+  std::optional<uint64_t> row;
+
+  file->open(mysqlshdk::storage::Mode::READ);
+
+  try {
+    row = import_table::find_row_start(dialect, file.get(), m_bytes_to_skip);
+  } catch (const std::logic_error &) {
+    // e.g. zstd file written without frameSize, beginning of the file would
+    // have to be decompressed again, original task is going to load it faster
+    m_seekable = false;
+  }
+
+  file->close();
+
+  if (row.has_value()) {
+    // this fails if the other task has already read the data past this row
+    m_range = m_parent_range->split(*row);
+  }
+
+  if (m_range) {
+    m_bytes_to_skip = m_range->begin();
+
+    log_debug("%sloading %s starting at offset %" PRIu64, log_id(),
+              key().c_str(), m_bytes_to_skip);
+  } else {
+    log_debug("%sunable to split %s at offset %" PRIu64, log_id(),
+              key().c_str(), m_bytes_to_skip);
+  }
+}
+
 void Dump_loader::Worker::Load_chunk_task::on_load_start(Worker *worker,
                                                          Dump_loader *loader) {
   FI_TRIGGER_TRAP(dump_loader, mysqlshdk::utils::FI::Trigger_options(
@@ -1213,6 +1278,12 @@ void Dump_loader::Worker::Load_chunk_task::on_load_start(Worker *worker,
                                     {"table", table()},
                                     {"chunk", std::to_string(chunk().index)}}));
 
+  if (is_split()) {
+    // this needs to be done before the LOAD_START event is posted, so that the
+    // range of this task is known when the event is handled
+    claim_range();
+  }
+
   loader->post_worker_event(worker, Worker_event::LOAD_START);
 
   FI_TRIGGER_TRAP(dump_loader, mysqlshdk::utils::FI::Trigger_options(
@@ -1224,6 +1295,11 @@ void Dump_loader::Worker::Load_chunk_task::on_load_start(Worker *worker,
 
 void Dump_loader::Worker::Load_chunk_task::do_load(Worker *worker,
                                                    Dump_loader *loader) {
+  if (is_split() && !m_range) {
+    // the chunk could not be split, nothing to do
+    return;
+  }
+
   auto import_options =
       import_table::Import_table_options::unpack(chunk().options);
 
@@ -1315,6 +1391,21 @@ void Dump_loader::Worker::Load_chunk_task::do_load(Worker *worker,
 
     uint64_t subchunk = 0;
 
+    options.range = m_range;
+
+    if (is_split()) {
+      // progress of the sub-chunks is tracked only for the beginning of the
+      // file, the remaining part is going to be reloaded in case of resume
+      options.skip_bytes = m_bytes_to_skip;
+
+      op.execute(worker->session(), extract_file(), options);
+
+      // the file was already counted by the original task
+      stats.total_files_processed = 0;
+
+      return;
+    }
+
     options.transaction_started = [this, &loader, &worker, &subchunk]() {
       log_debug("Transaction for '%s'.'%s'/%zi subchunk %" PRIu64
                 " has started",
@@ -1572,6 +1663,48 @@ bool Dump_loader::Worker::Analyze_table_task::execute(Worker *worker,
   return true;
 }
 
+bool Dump_loader::Worker::Triggers_ddl_task::execute(Worker *worker,
+                                                     Dump_loader *loader) {
+  log_debug("%swill execute triggers DDL for table %s", log_id(),
+            key().c_str());
+
+  loader->post_worker_event(worker, Worker_event::TRIGGERS_DDL_START);
+
+  try {
+    log_info("Executing triggers SQL for `%s`.`%s`", schema().c_str(),
+             table().c_str());
+
+    m_file->open(mysqlshdk::storage::Mode::READ);
+    const auto script = mysqlshdk::storage::read_file(m_file.get());
+    m_file->close();
+
+    if (!loader->m_options.dry_run()) {
+      auto transforms = loader->m_default_sql_transforms;
+
+      transforms.add_execute_conditionally(
+          [this, loader](std::string_view type, const std::string &name) {
+            if (!shcore::str_caseeq(type, "TRIGGER")) return true;
+            return loader->m_dump->include_trigger(schema(), table(), name);
+          });
+
+      execute_script(worker->reconnect_callback(), worker->session(),
+                     use_schema(schema(), script),
+                     "While executing triggers SQL", transforms);
+    }
+  } catch (const std::exception &e) {
+    handle_current_exception(
+        worker, loader,
+        shcore::str_format("While executing triggers DDL for table %s: %s",
+                           key().c_str(), e.what()));
+    return false;
+  }
+
+  log_debug("%sdone", log_id());
+  loader->post_worker_event(worker, Worker_event::TRIGGERS_DDL_END);
+
+  return true;
+}
+
 bool Dump_loader::Worker::Index_recreation_task::execute(Worker *worker,
                                                          Dump_loader *loader) {
   log_debug("%swill recreate %zu indexes for table %s", log_id(),
@@ -2046,6 +2179,21 @@ void Dump_loader::on_dump_begin() {
 void Dump_loader::on_dump_end() {
   std::string post_script = m_dump->end_script();
 
+  // foreign keys need to exist before triggers are created
+  for (const std::string &schema : m_dump->schemas()) {
+    recreate_deferred_foreign_keys(schema);
+  }
+
+  // triggers of different tables are independent of each other, execute them
+  // in parallel
+  if (m_options.load_ddl()) {
+    execute_triggers_ddl_tasks();
+
+    if (m_worker_interrupt) {
+      return;
+    }
+  }
+
   // Execute schema end scripts
   for (const std::string &schema : m_dump->schemas()) {
     on_schema_end(schema);
@@ -2124,7 +2272,7 @@ void Dump_loader::on_dump_end() {
   }
 }
 
-void Dump_loader::on_schema_end(const std::string &schema) {
+void Dump_loader::recreate_deferred_foreign_keys(const std::string &schema) {
   if (m_options.load_deferred_indexes()) {
     const auto &fks = m_dump->deferred_schema_fks(schema);
     if (!fks.empty()) {
@@ -2145,68 +2293,25 @@ void Dump_loader::on_schema_end(const std::string &schema) {
       }
     }
   }
+}
 
-  std::list<Dump_reader::Name_and_file> triggers;
-
-  m_dump->schema_table_triggers(schema, &triggers);
-
-  for (const auto &it : triggers) {
-    const auto &table = it.first;
-    const auto status =
-        m_load_log->status(progress::Triggers_ddl{schema, table});
-
-    log_debug("Triggers DDL for `%s`.`%s` (%s)", schema.c_str(), table.c_str(),
-              to_string(status).c_str());
-
-    if (m_options.load_ddl()) {
-      m_load_log->log(progress::start::Triggers_ddl{schema, table});
-
-      if (status != Load_progress_log::DONE) {
-        log_info("Executing triggers SQL for `%s`.`%s`", schema.c_str(),
-                 table.c_str());
-
-        it.second->open(mysqlshdk::storage::Mode::READ);
-        const auto script = mysqlshdk::storage::read_file(it.second.get());
-        it.second->close();
-
-        if (!m_options.dry_run()) {
-          auto transforms = m_default_sql_transforms;
-
-          transforms.add_execute_conditionally(
-              [this, &schema, &table](std::string_view type,
-                                      const std::string &name) {
-                if (!shcore::str_caseeq(type, "TRIGGER")) return true;
-                return m_dump->include_trigger(schema, table, name);
-              });
-
-          execute_script(m_reconnect_callback, m_session,
-                         use_schema(schema, script),
-                         "While executing triggers SQL", transforms);
-        }
-      }
-
-      m_load_log->log(progress::end::Triggers_ddl{schema, table});
-    }
-  }
-
-  {
-    const auto &queries = m_dump->queries_on_schema_end(schema);
+void Dump_loader::on_schema_end(const std::string &schema) {
+  const auto &queries = m_dump->queries_on_schema_end(schema);
 
-    if (!queries.empty()) {
-      log_info("Executing finalization queries for schema %s",
-               shcore::quote_identifier(schema).c_str());
+  if (!queries.empty()) {
+    log_info("Executing finalization queries for schema %s",
+             shcore::quote_identifier(schema).c_str());
 
-      if (!m_options.dry_run()) {
-        for (const auto &q : queries) {
-          try {
-            // statement is not idempotent - do not reconnect
-            sql::execute(m_session, q);
-          } catch (const std::exception &e) {
-            current_console()->print_error(
-                "Error while executing finalization queries for schema `" +
-                schema + "` with query: " + q);
-            throw;
-          }
+    if (!m_options.dry_run()) {
+      for (const auto &q : queries) {
+        try {
+          // statement is not idempotent - do not reconnect
+          sql::execute(m_session, q);
+        } catch (const std::exception &e) {
+          current_console()->print_error(
+              "Error while executing finalization queries for schema `" +
+              schema + "` with query: " + q);
+          throw;
         }
       }
     }
@@ -2354,6 +2459,10 @@ size_t Dump_loader::handle_worker_events(
         return "BULK_LOAD_PROGRESS";
       case Worker_event::Event::BULK_LOAD_END:
         return "BULK_LOAD_END";
+      case Worker_event::Event::TRIGGERS_DDL_START:
+        return "TRIGGERS_DDL_START";
+      case Worker_event::Event::TRIGGERS_DDL_END:
+        return "TRIGGERS_DDL_END";
     }
     return "";
   };
@@ -2378,15 +2487,24 @@ size_t Dump_loader::handle_worker_events(
                event.worker->id());
 
     switch (event.event) {
-      case Worker_event::LOAD_START:
-        on_chunk_load_start(event.worker->id(),
-                            static_cast<const Worker::Load_chunk_task *>(
-                                event.worker->current_task()));
+      case Worker_event::LOAD_START: {
+        const auto task = static_cast<Worker::Load_chunk_task *>(
+            event.worker->current_task());
+
+        on_chunk_load_start(event.worker->id(), task);
+
+        if (task->is_split() && task->range() && !idle_workers.empty()) {
+          // chunk was split, there may be more data which can be split between
+          // the idle workers
+          m_worker_events.push({Worker_event::READY, idle_workers.front(), {}});
+          idle_workers.pop_front();
+        }
         break;
+      }
 
       case Worker_event::LOAD_END:
         on_chunk_load_end(event.worker->id(),
-                          static_cast<const Worker::Load_chunk_task *>(
+                          static_cast<Worker::Load_chunk_task *>(
                               event.worker->current_task()));
         break;
 
@@ -2452,6 +2570,18 @@ size_t Dump_loader::handle_worker_events(
                              event.worker->current_task()));
         break;
 
+      case Worker_event::TRIGGERS_DDL_START:
+        on_triggers_ddl_start(event.worker->id(),
+                              static_cast<const Worker::Triggers_ddl_task *>(
+                                  event.worker->current_task()));
+        break;
+
+      case Worker_event::TRIGGERS_DDL_END:
+        on_triggers_ddl_end(event.worker->id(),
+                            static_cast<const Worker::Triggers_ddl_task *>(
+                                event.worker->current_task()));
+        break;
+
       case Worker_event::INDEX_START:
         on_index_start(event.worker->id(),
                        static_cast<const Worker::Index_recreation_task *>(
@@ -2627,12 +2757,79 @@ bool Dump_loader::schedule_next_task() {
       } while (true);
     }
 
-    return false;
+    // nothing else to do, help with the chunks which are still being loaded
+    return schedule_chunk_split();
   } else {
     return true;
   }
 }
 
+bool Dump_loader::schedule_chunk_split() {
+  Worker::Load_chunk_task *largest = nullptr;
+  uint64_t largest_remaining = 0;
+
+  for (const auto task : m_splittable_tasks) {
+    const auto &range = task->range();
+
+    if (m_ranges_being_split.count(range.get())) {
+      continue;
+    }
+
+    // end of the last range is not known, use the size of the file
+    const auto end = std::min<uint64_t>(range->end(), task->chunk().data_size);
+    const auto position = range->position();
+
+    if (end > position && end - position > largest_remaining) {
+      largest = task;
+      largest_remaining = end - position;
+    }
+  }
+
+  if (!largest || largest_remaining < k_min_chunk_split_size) {
+    return false;
+  }
+
+  const auto &source = largest->chunk();
+  Dump_reader::Table_chunk chunk;
+
+  chunk.schema = source.schema;
+  chunk.table = source.table;
+  chunk.partition = source.partition;
+  chunk.chunked = source.chunked;
+  chunk.file = m_dump->chunk_file(largest->file_name(), source.compression);
+  chunk.index = source.index;
+  chunk.file_size = source.file_size;
+  chunk.data_size = source.data_size;
+  chunk.chunks_total = source.chunks_total;
+  chunk.options = source.options;
+  chunk.dump_complete = source.dump_complete;
+  chunk.basename = source.basename;
+  chunk.extension = source.extension;
+  chunk.compression = source.compression;
+
+  auto &split = largest->split();
+
+  if (!split) {
+    split = std::make_shared<Split_chunk>();
+  }
+
+  ++split->tasks;
+
+  const auto &range = largest->range();
+  // split the remaining data in half
+  const auto offset = range->position() + largest_remaining / 2;
+
+  log_debug("Splitting %s at offset %" PRIu64 ", %" PRIu64
+            " bytes left to load",
+            format_table(chunk).c_str(), offset, largest_remaining);
+
+  m_ranges_being_split.emplace(range.get());
+  push_pending_task(std::make_unique<Worker::Load_chunk_task>(
+      std::move(chunk), split, range, offset));
+
+  return true;
+}
+
 void Dump_loader::interrupt() {
   // 1st ^C does a soft interrupt (stop new tasks but let current work finish)
   // 2nd ^C sends kill to all workers
@@ -3812,6 +4009,53 @@ void Dump_loader::execute_view_ddl_tasks() {
   log_debug("End loading view DDL");
 }
 
+void Dump_loader::execute_triggers_ddl_tasks() {
+  std::list<Task_ptr> tasks;
+
+  for (const auto &schema : m_dump->schemas()) {
+    std::list<Dump_reader::Name_and_file> triggers;
+
+    m_dump->schema_table_triggers(schema, &triggers);
+
+    for (auto &it : triggers) {
+      const auto &table = it.first;
+      const auto status =
+          m_load_log->status(progress::Triggers_ddl{schema, table});
+
+      log_debug("Triggers DDL for `%s`.`%s` (%s)", schema.c_str(),
+                table.c_str(), to_string(status).c_str());
+
+      if (status == Load_progress_log::DONE) {
+        m_load_log->log(progress::start::Triggers_ddl{schema, table});
+        m_load_log->log(progress::end::Triggers_ddl{schema, table});
+      } else {
+        // all triggers of a table are executed by a single worker, in order
+        tasks.emplace_back(std::make_unique<Worker::Triggers_ddl_task>(
+            schema, table, std::move(it.second)));
+      }
+    }
+  }
+
+  if (tasks.empty()) {
+    return;
+  }
+
+  log_debug("Begin loading triggers DDL");
+
+  execute_threaded([this, &tasks]() {
+    if (m_worker_interrupt || tasks.empty()) {
+      return false;
+    }
+
+    push_pending_task(std::move(tasks.front()));
+    tasks.pop_front();
+
+    return true;
+  });
+
+  log_debug("End loading triggers DDL");
+}
+
 void Dump_loader::execute_tasks(bool testing) {
   auto console = current_console();
 
@@ -3903,6 +4147,9 @@ void Dump_loader::execute_tasks(bool testing) {
 
   if (!m_worker_interrupt) {
     on_dump_end();
+  }
+
+  if (!m_worker_interrupt) {
     m_load_log->cleanup();
   }
 
@@ -4092,9 +4339,29 @@ void Dump_loader::on_table_ddl_end(std::size_t, Worker::Table_ddl_task *task) {
 }
 
 void Dump_loader::on_chunk_load_start(std::size_t worker_id,
-                                      const Worker::Load_chunk_task *task) {
+                                      Worker::Load_chunk_task *task) {
   const auto &chunk = task->chunk();
 
+  if (task->range()) {
+    m_splittable_tasks.emplace(task);
+  }
+
+  if (task->is_split()) {
+    const auto &parent = task->parent_range();
+
+    m_ranges_being_split.erase(parent.get());
+
+    if (!task->seekable()) {
+      // other parts of this file cannot be split either
+      std::erase_if(m_splittable_tasks, [&parent](const auto t) {
+        return t->range() == parent;
+      });
+    }
+
+    // progress of the chunk was already logged by the original task
+    return;
+  }
+
   m_load_log->log(progress::start::Table_chunk{chunk.schema,
                                                chunk.table,
                                                chunk.partition,
@@ -4103,15 +4370,33 @@ void Dump_loader::on_chunk_load_start(std::size_t worker_id,
 }
 
 void Dump_loader::on_chunk_load_end(std::size_t,
-                                    const Worker::Load_chunk_task *task) {
+                                    Worker::Load_chunk_task *task) {
+  m_splittable_tasks.erase(task);
+
   const auto &chunk = task->chunk();
   const auto &stats = task->stats;
-  const size_t data_bytes_loaded = stats.total_data_bytes;
-  const size_t file_bytes_loaded = stats.total_file_bytes;
+  size_t data_bytes_loaded = stats.total_data_bytes;
+  size_t file_bytes_loaded = stats.total_file_bytes;
+  size_t records_loaded = stats.total_records;
+
+  if (const auto &split = task->split()) {
+    split->data_bytes += data_bytes_loaded;
+    split->file_bytes += file_bytes_loaded;
+    split->records += records_loaded;
+
+    if (--split->tasks > 0) {
+      // other parts of this chunk are still being loaded
+      return;
+    }
+
+    data_bytes_loaded = split->data_bytes;
+    file_bytes_loaded = split->file_bytes;
+    records_loaded = split->records;
+  }
 
   m_load_log->log(progress::end::Table_chunk{
       chunk.schema, chunk.table, chunk.partition, chunk.index,
-      data_bytes_loaded, file_bytes_loaded, stats.total_records});
+      data_bytes_loaded, file_bytes_loaded, records_loaded});
 
   m_dump->on_chunk_loaded(chunk);
 
@@ -4204,6 +4489,17 @@ void Dump_loader::on_index_end(std::size_t,
   m_load_log->log(progress::end::Table_indexes{schema, table});
 }
 
+void Dump_loader::on_triggers_ddl_start(std::size_t,
+                                        const Worker::Triggers_ddl_task *task) {
+  m_load_log->log(
+      progress::start::Triggers_ddl{task->schema(), task->table()});
+}
+
+void Dump_loader::on_triggers_ddl_end(std::size_t,
+                                      const Worker::Triggers_ddl_task *task) {
+  m_load_log->log(progress::end::Triggers_ddl{task->schema(), task->table()});
+}
+
 void Dump_loader::on_analyze_start(std::size_t worker_id,
                                    const Worker::Analyze_table_task *task) {
   assert(m_analyze_tables_stage);
@@ -4654,8 +4950,20 @@ Dump_loader::Task_ptr Dump_loader::load_chunk_file(
   // for the chunk loading order. But we need to be able to dynamically
   // schedule chunks based on the current conditions at the time each new
   // chunk needs to be scheduled.
+  // Chunks which are resumed are not split, as their tables may be truncated
+  // once loading starts. Fast sub-chunking reads the data directly from the
+  // source instance, so it's not possible to open the chunk file again. Only
+  // uncompressed and zstd files can be read starting at the split point,
+  // otherwise beginning of the file would have to be decompressed again.
+  const auto splittable =
+      !resuming && !m_options.fast_sub_chunking() && !m_options.dry_run() &&
+      (mysqlshdk::storage::Compression::NONE == chunk.compression ||
+       mysqlshdk::storage::Compression::ZSTD == chunk.compression) &&
+      import_table::has_row_boundaries(
+          import_table::Import_table_options::unpack(chunk.options).dialect());
+
   return std::make_unique<Worker::Load_chunk_task>(std::move(chunk), resuming,
-                                                   bytes_to_skip);
+                                                   bytes_to_skip, splittable);
 }
 
 Dump_loader::Task_ptr Dump_loader::bulk_load_table(
@@ -51,6 +51,7 @@
 #include "modules/util/load/load_progress_log.h"
 
 #include "modules/util/import_table/import_stats.h"
+#include "modules/util/import_table/load_data.h"
 
 #include "mysqlshdk/libs/db/mysql/session.h"
 #include "mysqlshdk/libs/storage/ifile.h"
@@ -87,6 +88,19 @@ class Dump_loader {
   dump::Progress_thread *progress() { return &m_progress_thread; }
 
  private:
+  /**
+   * Chunk file which is loaded by multiple tasks, each one loading a different
+   * part of the file.
+   */
+  struct Split_chunk {
+    // number of tasks which did not finish loading their part
+    std::size_t tasks = 1;
+    // stats of the tasks which have finished
+    uint64_t data_bytes = 0;
+    uint64_t file_bytes = 0;
+    uint64_t records = 0;
+  };
+
   class Worker {
    public:
     class Task {
@@ -220,6 +234,12 @@ class Dump_loader {
 
       const Dump_reader::Table_chunk &chunk() const { return m_chunk; }
 
+      /**
+       * Whether this task loads a part of a chunk file which is loaded by
+       * another task.
+       */
+      virtual bool is_split() const { return false; }
+
      protected:
       bool resume() const { return m_resume; }
 
@@ -243,9 +263,42 @@ class Dump_loader {
     class Load_chunk_task : public Load_data_task {
      public:
       Load_chunk_task(Dump_reader::Table_chunk chunk, bool resume,
-                      uint64_t bytes_to_skip)
-          : Load_data_task(std::move(chunk), resume),
-            m_bytes_to_skip(bytes_to_skip) {}
+                      uint64_t bytes_to_skip, bool splittable);
+
+      /**
+       * Creates a task which loads the remaining part of a chunk file which is
+       * being loaded by another task. This part begins with the first row
+       * after the given offset.
+       */
+      Load_chunk_task(Dump_reader::Table_chunk chunk,
+                      std::shared_ptr<Split_chunk> split,
+                      std::shared_ptr<import_table::File_range> parent_range,
+                      uint64_t offset);
+
+      bool is_split() const override { return !!m_parent_range; }
+
+      const std::string &file_name() const { return m_file_name; }
+
+      /**
+       * Part of the chunk file loaded by this task, null if it cannot be split.
+       */
+      const std::shared_ptr<import_table::File_range> &range() const {
+        return m_range;
+      }
+
+      const std::shared_ptr<import_table::File_range> &parent_range() const {
+        return m_parent_range;
+      }
+
+      std::shared_ptr<Split_chunk> &split() { return m_split; }
+
+      const std::shared_ptr<Split_chunk> &split() const { return m_split; }
+
+      /**
+       * False if this task was unable to claim its range, because chunk file
+       * does not support seeking.
+       */
+      bool seekable() const { return m_seekable; }
 
      private:
       void on_load_start(Worker *, Dump_loader *) override;
@@ -254,7 +307,14 @@ class Dump_loader {
 
       void on_load_end(Worker *, Dump_loader *) override;
 
+      void claim_range();
+
       uint64_t m_bytes_to_skip = 0;
+      std::string m_file_name;
+      std::shared_ptr<import_table::File_range> m_range;
+      std::shared_ptr<import_table::File_range> m_parent_range;
+      std::shared_ptr<Split_chunk> m_split;
+      bool m_seekable = true;
     };
 
     class Bulk_load_task : public Load_data_task {
@@ -292,6 +352,18 @@ class Dump_loader {
       std::vector<Dump_reader::Histogram> m_histograms;
     };
 
+    class Triggers_ddl_task : public Task {
+     public:
+      Triggers_ddl_task(std::string_view schema, std::string_view table,
+                        std::unique_ptr<mysqlshdk::storage::IFile> file)
+          : Task(schema, table), m_file(std::move(file)) {}
+
+      bool execute(Worker *, Dump_loader *) override;
+
+     private:
+      std::unique_ptr<mysqlshdk::storage::IFile> m_file;
+    };
+
     class Index_recreation_task : public Task {
      public:
       Index_recreation_task(
@@ -412,6 +484,8 @@ class Dump_loader {
       BULK_LOAD_START,
       BULK_LOAD_PROGRESS,
       BULK_LOAD_END,
+      TRIGGERS_DDL_START,
+      TRIGGERS_DDL_END,
     };
     Event event;
     Worker *worker = nullptr;
@@ -424,6 +498,7 @@ class Dump_loader {
   void execute_tasks(bool testing = false);
   void execute_table_ddl_tasks();
   void execute_view_ddl_tasks();
+  void execute_triggers_ddl_tasks();
 
   void wait_for_metadata();
   bool scan_for_more_data(bool wait = true);
@@ -444,6 +519,7 @@ class Dump_loader {
   bool schedule_table_chunk(Dump_reader::Table_chunk chunk);
 
   bool schedule_next_task();
+  bool schedule_chunk_split();
   size_t handle_worker_events(const std::function<bool()> &schedule_next);
 
   void execute_threaded(const std::function<bool()> &schedule_next);
@@ -464,6 +540,8 @@ class Dump_loader {
   void post_worker_event(Worker *worker, Worker_event::Event event,
                          shcore::Dictionary_t &&details = {});
 
+  void recreate_deferred_foreign_keys(const std::string &schema);
+
   void on_schema_end(const std::string &schema);
 
   void on_schema_ddl_start(std::size_t worker_id,
@@ -475,6 +553,11 @@ class Dump_loader {
                           const Worker::Table_ddl_task *task);
   void on_table_ddl_end(std::size_t worker_id, Worker::Table_ddl_task *task);
 
+  void on_triggers_ddl_start(std::size_t worker_id,
+                             const Worker::Triggers_ddl_task *task);
+  void on_triggers_ddl_end(std::size_t worker_id,
+                           const Worker::Triggers_ddl_task *task);
+
   void on_index_start(std::size_t worker_id,
                       const Worker::Index_recreation_task *task);
   void on_index_end(std::size_t worker_id,
@@ -486,9 +569,8 @@ class Dump_loader {
                       const Worker::Analyze_table_task *task);
 
   void on_chunk_load_start(std::size_t worker_id,
-                           const Worker::Load_chunk_task *task);
-  void on_chunk_load_end(std::size_t worker_id,
-                         const Worker::Load_chunk_task *task);
+                           Worker::Load_chunk_task *task);
+  void on_chunk_load_end(std::size_t worker_id, Worker::Load_chunk_task *task);
 
   void on_subchunk_load_start(std::size_t worker_id,
                               const shcore::Dictionary_t &event,
@@ -686,6 +768,10 @@ class Dump_loader {
 
   std::mutex m_tables_being_loaded_mutex;
   std::unordered_multimap<std::string, size_t> m_tables_being_loaded;
+  // chunks which are being loaded and can be split
+  std::unordered_set<Worker::Load_chunk_task *> m_splittable_tasks;
+  // ranges which are going to be split by a task which did not start yet
+  std::unordered_set<const import_table::File_range *> m_ranges_being_split;
   std::atomic<size_t> m_num_threads_loading;
   std::atomic<size_t> m_num_threads_recreating_indexes;
   std::atomic<size_t> m_num_threads_checksumming{0};
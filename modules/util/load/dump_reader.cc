@@ -598,8 +598,7 @@ bool Dump_reader::next_table_chunk(
     }
 
     out_chunk->compression = (*iter)->owner->compression;
-    out_chunk->file = mysqlshdk::storage::make_file(m_dir->file(info->name()),
-                                                    out_chunk->compression);
+    out_chunk->file = chunk_file(info->name(), out_chunk->compression);
     out_chunk->file_size = info->size();
     out_chunk->data_size = data_size_in_file(info->name());
     out_chunk->options = (*iter)->owner->options;
@@ -616,6 +615,12 @@ bool Dump_reader::next_table_chunk(
   return false;
 }
 
+std::unique_ptr<mysqlshdk::storage::IFile> Dump_reader::chunk_file(
+    const std::string &name,
+    mysqlshdk::storage::Compression compression) const {
+  return mysqlshdk::storage::make_file(m_dir->file(name), compression);
+}
+
 bool Dump_reader::next_deferred_index(
     std::string *out_schema, std::string *out_table,
     compatibility::Deferred_statements::Index_info **out_indexes) {
@@ -785,7 +790,7 @@ void Dump_reader::rescan(dump::Progress_thread *progress_thread) {
       }
     }
 
-    files = m_dir->list_files();
+    files = list_files();
   }
 
   log_debug("Finished listing files, starting rescan");
@@ -804,6 +809,35 @@ void Dump_reader::rescan(dump::Progress_thread *progress_thread) {
   compute_filtered_data_size();
 }
 
+Dump_reader::Files Dump_reader::list_files() {
+  // while dump is still in progress, new files are mostly fetched
+  // incrementally, all files are listed periodically, as new files do not have
+  // to follow the previous ones
+  constexpr uint64_t k_full_listing_interval = 10;
+  // checking if "@.done.json" exists is an additional (HEAD) request
+  constexpr uint64_t k_done_check_interval = 3;
+
+  const auto rescan = m_rescans++;
+
+  if (0 == rescan % k_full_listing_interval) {
+    return m_dir->list_files();
+  }
+
+  auto files = m_dir->list_files_incremental();
+
+  // incremental listing reports only the files which follow the last known
+  // one, "@.done.json" sorts before most of the dump files, so it has to be
+  // checked explicitly
+  if (files.find({"@.done.json"}) != files.end() ||
+      (0 == rescan % k_done_check_interval &&
+       m_dir->file("@.done.json")->exists())) {
+    // dump is complete, make sure we know about all of its files
+    files = m_dir->list_files();
+  }
+
+  return files;
+}
+
 uint64_t Dump_reader::add_deferred_statements(
     const std::string &schema, const std::string &table,
     compatibility::Deferred_statements &&stmts) {
@@ -1469,23 +1503,47 @@ bool Dump_reader::Dump_info::ready() const {
 void Dump_reader::Dump_info::rescan(mysqlshdk::storage::IDirectory *dir,
                                     const Files &files, Dump_reader *reader,
                                     dump::Progress_thread *progress_thread) {
-  if (!sql && files.find({"@.sql"}) != files.end()) {
-    sql = std::make_unique<std::string>(fetch_file(dir, "@.sql"));
-  }
-  if (!post_sql && files.find({"@.post.sql"}) != files.end()) {
-    post_sql = std::make_unique<std::string>(fetch_file(dir, "@.post.sql"));
-  }
-  if (has_users && !users_sql && files.find({"@.users.sql"}) != files.end()) {
-    users_sql = std::make_unique<std::string>(fetch_file(dir, "@.users.sql"));
-  }
-
   if (!md_done) {
+    // scripts are fetched together with the metadata files
     rescan_metadata(dir, files, reader, progress_thread);
+  } else {
+    fetch_scripts(dir, files);
   }
 
   rescan_data(files, reader);
 }
 
+void Dump_reader::Dump_info::fetch_scripts(mysqlshdk::storage::IDirectory *dir,
+                                           const Files &files,
+                                           shcore::Thread_pool *pool) {
+  const auto fetch = [dir, &files, pool](const char *name,
+                                         std::unique_ptr<std::string> *script) {
+    if (*script || files.find({name}) == files.end()) {
+      return;
+    }
+
+    if (!pool) {
+      *script = std::make_unique<std::string>(fetch_file(dir, name));
+      return;
+    }
+
+    // these scripts are needed before anything else is loaded, fetch them
+    // first
+    pool->add_task([dir, name]() { return fetch_file(dir, name); },
+                   [script](std::string &&data) {
+                     *script = std::make_unique<std::string>(std::move(data));
+                   },
+                   shcore::Thread_pool::Priority::HIGH);
+  };
+
+  fetch("@.sql", &sql);
+  fetch("@.post.sql", &post_sql);
+
+  if (has_users) {
+    fetch("@.users.sql", &users_sql);
+  }
+}
+
 void Dump_reader::Dump_info::rescan_metadata(
     mysqlshdk::storage::IDirectory *dir, const Files &files,
     Dump_reader *reader, dump::Progress_thread *progress_thread) {
@@ -1521,6 +1579,8 @@ void Dump_reader::Dump_info::rescan_metadata(
 
   pool->start_threads();
 
+  fetch_scripts(dir, files, pool);
+
   for (const auto &s : schemas) {
     if (!s.second->ready()) {
       if (s.second->should_fetch_metadata_file(files)) {
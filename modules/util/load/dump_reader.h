@@ -178,6 +178,10 @@ class Dump_reader {
       const std::unordered_multimap<std::string, size_t> &tables_being_loaded,
       Table_chunk *out_chunk);
 
+  std::unique_ptr<mysqlshdk::storage::IFile> chunk_file(
+      const std::string &name,
+      mysqlshdk::storage::Compression compression) const;
+
   struct Histogram {
     std::string column;
     size_t buckets;
@@ -560,6 +564,9 @@ class Dump_reader {
                          const Files &files, Dump_reader *reader,
                          dump::Progress_thread *progress_thread);
 
+    void fetch_scripts(mysqlshdk::storage::IDirectory *dir, const Files &files,
+                       shcore::Thread_pool *pool = nullptr);
+
     void rescan_data(const Files &files, Dump_reader *reader);
   };
 
@@ -590,11 +597,14 @@ class Dump_reader {
 
   uint64_t data_size_in_file(const std::string &filename) const;
 
+  Files list_files();
+
   std::unique_ptr<mysqlshdk::storage::IDirectory> m_dir;
 
   const Load_dump_options &m_options;
 
   Status m_dump_status = Status::INVALID;
+  uint64_t m_rescans = 0;
   Dump_info m_contents;
   size_t m_filtered_data_size = 0;
 
@@ -625,6 +635,7 @@ class Dump_reader {
 
 #ifdef FRIEND_TEST
   FRIEND_TEST(Dump_scheduler, load_scheduler);
+  FRIEND_TEST(Dump_reader_test, list_files_incremental);
 #endif
 };
 
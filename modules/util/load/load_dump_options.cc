@@ -57,6 +57,19 @@ using Version = mysqlshdk::utils::Version;
 
 constexpr auto k_minimum_max_bytes_per_transaction = 4096;
 
+// Files are read sequentially, next block is fetched while the current one is
+// being loaded. Memory used by each file being read from an object storage is
+// bounded by k_read_ahead_blocks * k_read_ahead_block_size.
+constexpr std::size_t k_read_ahead_block_size = 8 * 1024 * 1024;
+constexpr std::size_t k_read_ahead_blocks = 2;
+
+template <typename Config>
+std::shared_ptr<Config> enable_read_ahead(std::shared_ptr<Config> config) {
+  config->set_read_ahead_block_size(k_read_ahead_block_size);
+  config->set_read_ahead_blocks(k_read_ahead_blocks);
+  return config;
+}
+
 std::string bulk_load_s3_prefix(
     const std::shared_ptr<mysqlshdk::aws::S3_bucket_config> &config) {
   // 's3-region://bucket-name/file-name-or-prefix'
@@ -421,11 +434,11 @@ void Load_dump_options::on_unpacked_options() {
   m_blob_storage_options.throw_on_conflict(m_oci_bucket_options);
 
   if (m_oci_bucket_options) {
-    set_storage_config(m_oci_bucket_options.config());
+    set_storage_config(enable_read_ahead(m_oci_bucket_options.config()));
   }
 
   if (m_s3_bucket_options) {
-    auto config = m_s3_bucket_options.s3_config();
+    auto config = enable_read_ahead(m_s3_bucket_options.s3_config());
 
     if (config->valid() && m_s3_bucket_options.endpoint_override().empty()) {
       // S3 is supported by the bulk loader
@@ -437,7 +450,7 @@ void Load_dump_options::on_unpacked_options() {
   }
 
   if (m_blob_storage_options) {
-    set_storage_config(m_blob_storage_options.config());
+    set_storage_config(enable_read_ahead(m_blob_storage_options.config()));
   }
 
   if (!m_load_data && !m_load_ddl && !m_load_users &&
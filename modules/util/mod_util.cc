@@ -122,6 +122,9 @@ identifiers to be included in the operation.
 identifiers to be excluded from the operation.
 @li <b>list</b> - bool value to indicate the operation should only 
 list the checks.
+@li <b>threads</b> - number of threads used to execute the checks. Each
+thread other than the first one opens an additional session to the server.
+Default: 4.
 
 If <b>targetVersion</b> is not specified, the current shell version
 will be used as target version.
@@ -202,6 +205,10 @@ void Util::check_for_server_upgrade(
     }
 
     config.set_session(session);
+    config.set_session_factory(
+        [co = session->get_connection_options()]() {
+          return establish_session(co, false);
+        });
     config.set_user_privileges(privileges.get());
   }
 
@@ -237,61 +244,71 @@ REGISTER_HELP(UTIL_IMPORTJSON_DETAIL5,
               "@li tableColumn: string (default: \"doc\") - name of column in "
               "target table where the imported JSON documents will be stored.");
 REGISTER_HELP(UTIL_IMPORTJSON_DETAIL6,
+              "@li threads: int (default: 1) - use N threads to parse and "
+              "insert the documents.");
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL7,
               "@li convertBsonTypes: bool (default: false) - enables the BSON "
               "data type conversion.");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL7,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL8,
               "@li convertBsonOid: bool (default: the value of "
               "convertBsonTypes) - enables conversion of the BSON ObjectId "
               "values.");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL8,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL9,
               "@li extractOidTime: string (default: empty) - creates a new "
               "field based on the ObjectID timestamp. Only valid if "
               "convertBsonOid is enabled.");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL9,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL10,
               "The following options are valid only when convertBsonTypes is "
               "enabled. They are all boolean flags. ignoreRegexOptions is "
               "enabled by default, rest are disabled by default.");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL10,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL11,
               "@li ignoreDate: disables conversion of BSON Date values");
 REGISTER_HELP(
-    UTIL_IMPORTJSON_DETAIL11,
+    UTIL_IMPORTJSON_DETAIL12,
     "@li ignoreTimestamp: disables conversion of BSON Timestamp values");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL12,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL13,
               "@li ignoreRegex: disables conversion of BSON Regex values.");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL15,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL16,
               "@li ignoreRegexOptions: causes regex options to be ignored when "
               "processing a Regex BSON value. This option is only valid if "
               "ignoreRegex is disabled.");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL13,
-              "@li ignoreBinary: disables conversion of BSON BinData values.");
 REGISTER_HELP(UTIL_IMPORTJSON_DETAIL14,
+              "@li ignoreBinary: disables conversion of BSON BinData values.");
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL15,
               "@li decimalAsDouble: causes BSON Decimal values to be imported "
               "as double values.");
 
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL16,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL17,
               "If the schema is not provided, an active schema on the global "
               "session, if set, will be used.");
 
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL17,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL18,
               "The collection and the table options cannot be combined. If "
               "they are not provided, the basename of the file without "
               "extension will be used as target collection name.");
 
 REGISTER_HELP(
-    UTIL_IMPORTJSON_DETAIL18,
+    UTIL_IMPORTJSON_DETAIL19,
     "If the target collection or table does not exist, they are created, "
     "otherwise the data is inserted into the existing collection or table.");
 
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL19,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL20,
               "The tableColumn implies the use of the table option and cannot "
               "be combined "
               "with the collection option.");
 
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL20, "<b>BSON Data Type Processing.</b>");
 REGISTER_HELP(UTIL_IMPORTJSON_DETAIL21,
+              "If threads is greater than 1 and the data is read from a file, "
+              "the file is split into chunks at the boundaries of the JSON "
+              "documents and the chunks are imported in parallel, each thread "
+              "using its own session. In this case, the documents are not "
+              "imported in the order in which they appear in the file.");
+
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL22, "<b>BSON Data Type Processing.</b>");
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL23,
               "If only convertBsonOid is enabled, no conversion will be done "
               "on the rest of the BSON Data Types.");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL22,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL24,
               "To use extractOidTime, it should be set to a name which will "
               "be used to insert an additional field into the main document. "
               "The value of the new field will be the timestamp obtained from "
@@ -299,12 +316,12 @@ REGISTER_HELP(UTIL_IMPORTJSON_DETAIL22,
               "ObjectID value associated to the '_id' field of the main "
               "document.");
 REGISTER_HELP(
-    UTIL_IMPORTJSON_DETAIL23,
+    UTIL_IMPORTJSON_DETAIL25,
     "NumberLong and NumberInt values will be converted to integer values.");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL24,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL26,
               "NumberDecimal values are imported as strings, unless "
               "decimalAsDouble is enabled.");
-REGISTER_HELP(UTIL_IMPORTJSON_DETAIL25,
+REGISTER_HELP(UTIL_IMPORTJSON_DETAIL27,
               "Regex values will be converted to strings containing the "
               "regular expression. The regular expression options are ignored "
               "unless ignoreRegexOptions is disabled. When ignoreRegexOptions "
@@ -342,6 +359,7 @@ const shcore::Option_pack_def<Import_json_options>
           .optional("collection", &Import_json_options::collection)
           .optional("table", &Import_json_options::table)
           .optional("tableColumn", &Import_json_options::table_column)
+          .optional("threads", &Import_json_options::threads)
           .include(&Import_json_options::doc_reader);
 
   return opts;
@@ -365,15 +383,14 @@ const shcore::Option_pack_def<Import_json_options>
  * $(UTIL_IMPORTJSON_DETAIL6)
  * $(UTIL_IMPORTJSON_DETAIL7)
  * $(UTIL_IMPORTJSON_DETAIL8)
- *
  * $(UTIL_IMPORTJSON_DETAIL9)
+ *
  * $(UTIL_IMPORTJSON_DETAIL10)
  * $(UTIL_IMPORTJSON_DETAIL11)
  * $(UTIL_IMPORTJSON_DETAIL12)
  * $(UTIL_IMPORTJSON_DETAIL13)
  * $(UTIL_IMPORTJSON_DETAIL14)
  * $(UTIL_IMPORTJSON_DETAIL15)
- *
  * $(UTIL_IMPORTJSON_DETAIL16)
  *
  * $(UTIL_IMPORTJSON_DETAIL17)
@@ -394,6 +411,10 @@ const shcore::Option_pack_def<Import_json_options>
  *
  * $(UTIL_IMPORTJSON_DETAIL25)
  *
+ * $(UTIL_IMPORTJSON_DETAIL26)
+ *
+ * $(UTIL_IMPORTJSON_DETAIL27)
+ *
  * $(UTIL_IMPORTJSON_THROWS)
  * $(UTIL_IMPORTJSON_THROWS1)
  * $(UTIL_IMPORTJSON_THROWS2)
@@ -474,9 +495,25 @@ void Util::import_json(
     prepare.collection(options->collection);
   }
 
+  if (options->threads < 1) {
+    throw std::invalid_argument(
+        "The value of the 'threads' option must be greater than 0.");
+  }
+
   // Validate provided parameters and build Json_importer object.
   auto importer = prepare.build();
 
+  importer.set_threads(options->threads, [&connection_options]() {
+    auto session = mysqlshdk::db::mysqlx::Session::create();
+
+    if (current_shell_options()->get().trace_protocol) {
+      session->enable_protocol_trace(true);
+    }
+
+    session->connect(connection_options);
+    return session;
+  });
+
   auto console = mysqlsh::current_console();
   console->print_info(
       prepare.to_string() + " in MySQL Server at " +
@@ -663,6 +700,11 @@ credential provider, it is selected as the credential provider.
 credential provider, an exception is thrown.
 @li If the session token is missing in the selected credential provider, or if
 it is set to an empty string, it is not used to authenticate the user.
+
+If the <b>payload_signing_enabled</b> setting from the <b>config</b> file for
+the specified profile is set to <b>false</b> and the AWS S3 API endpoint uses
+HTTPS, the uploaded data is not included in the request signatures, its
+integrity is protected by TLS.
 )*");
 
 REGISTER_HELP_DETAIL_TEXT(TOPIC_UTIL_DUMP_AWS_COMMON_OPTION_DETAILS, R"*(
@@ -1526,14 +1568,25 @@ compatibility issues with MySQL HeatWave Service.
 @li <b>chunking</b>: bool (default: true) - Enable chunking of the tables.
 @li <b>bytesPerChunk</b>: string (default: "64M") - Sets average estimated
 number of bytes to be written to each chunk file, enables <b>chunking</b>.
+@li <b>adaptiveChunking</b>: bool (default: false) - Allows chunks of tables
+which are chunked using an integer column to be split while they are being
+dumped, if some of the threads are idle. As the number of chunks of such tables
+is not known up front, their last chunk file is always empty. Cannot be used if
+<b>chunking</b> is disabled.
 @li <b>threads</b>: int (default: 4) - Use N threads to dump data chunks from
 the server.
 )*");
 
 REGISTER_HELP_DETAIL_TEXT(TOPIC_UTIL_DUMP_DDL_COMPRESSION, R"*(
 @li <b>compression</b>: string (default: "zstd;level=1") - Compression used when writing
-the data dump files, one of: "none", "gzip", "zstd". Compression level may be
-specified as "gzip;level=8" or "zstd;level=8".
+the data dump files, one of: "none", "gzip", "zstd", "lz4". Compression level
+may be specified as "gzip;level=8", "zstd;level=8" or "lz4;level=8". If the
+maximum uncompressed size of a zstd frame is given, e.g. "zstd;frameSize=8M",
+files are written in the seekable format, which lets the loader resume an
+interrupted chunk without decompressing it from the start. The zstd and gzip
+compressions accept the number of additional compression threads, e.g.
+"gzip;threads=4"; this number is split among the threads which are dumping the
+data.
 )*");
 
 REGISTER_HELP_DETAIL_TEXT(TOPIC_UTIL_DUMP_MDS_COMMON_OPTIONS, R"*(
@@ -1788,8 +1841,13 @@ partition names used to limit the data export to just the specified partitions.
 
 ${TOPIC_UTIL_DUMP_EXPORT_COMMON_OPTIONS}
 @li <b>compression</b>: string (default: "none") - Compression used when writing
-the data dump files, one of: "none", "gzip", "zstd". Compression level may be
-specified as "gzip;level=8" or "zstd;level=8".
+the data dump files, one of: "none", "gzip", "zstd", "lz4". Compression level
+may be specified as "gzip;level=8", "zstd;level=8" or "lz4;level=8". If the
+maximum uncompressed size of a zstd frame is given, e.g. "zstd;frameSize=8M",
+files are written in the seekable format, which lets the loader resume an
+interrupted chunk without decompressing it from the start. The zstd and gzip
+compressions accept the number of additional compression threads, e.g.
+"zstd;threads=8", all of them are used to compress the single output file.
 
 ${TOPIC_UTIL_DUMP_OCI_COMMON_OPTIONS}
 
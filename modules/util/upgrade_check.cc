@@ -26,12 +26,22 @@
 #include "modules/util/upgrade_check.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <exception>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "modules/util/upgrade_checker/common.h"
 #include "modules/util/upgrade_checker/manual_check.h"
 #include "modules/util/upgrade_checker/upgrade_check_registry.h"
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/include/shellcore/shell_init.h"
+#include "mysqlshdk/libs/utils/logger.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 #include "mysqlshdk/libs/utils/version.h"
 
@@ -103,6 +113,162 @@ std::string check_for_version_suggestion(const Version &serverVersion,
       serverVersion, targetVersion, suggested_target_version);
 }
 
+namespace {
+
+struct Check_result {
+  std::vector<Upgrade_issue> issues;
+  std::exception_ptr error;
+  // in seconds
+  double execution_time = 0.0;
+};
+
+/**
+ * Executes the runnable checks using a pool of sessions. Checks are
+ * independent of each other, they only share the cache, which is thread-safe.
+ * Results are fetched in the order of the checklist.
+ */
+class Check_runner final {
+ public:
+  Check_runner(const Upgrade_check_config &config,
+               const Upgrade_check_registry::Upgrade_check_vec &checklist,
+               Checker_cache *cache)
+      : m_config(config),
+        m_checklist(checklist),
+        m_cache(cache),
+        m_results(checklist.size()) {
+    for (std::size_t i = 0; i < m_checklist.size(); ++i) {
+      if (m_checklist[i]->is_runnable()) {
+        m_runnable.emplace_back(i);
+      }
+    }
+
+    start_threads();
+  }
+
+  Check_runner(const Check_runner &) = delete;
+  Check_runner(Check_runner &&) = delete;
+
+  Check_runner &operator=(const Check_runner &) = delete;
+  Check_runner &operator=(Check_runner &&) = delete;
+
+  ~Check_runner() {
+    m_interrupted = true;
+
+    for (auto &t : m_threads) {
+      t.join();
+    }
+  }
+
+  Check_result result(std::size_t idx) {
+    if (m_threads.empty()) {
+      return run(idx, m_config.session());
+    }
+
+    std::unique_lock lock{m_mutex};
+    m_result_ready.wait(lock, [this, idx]() {
+      return m_results[idx].has_value();
+    });
+
+    return std::move(*m_results[idx]);
+  }
+
+ private:
+  void start_threads() {
+    const auto &factory = m_config.session_factory();
+    const auto threads = std::min<std::size_t>(
+        factory ? m_config.threads() : 1, m_runnable.size());
+
+    if (threads <= 1) {
+      return;
+    }
+
+    std::vector<std::shared_ptr<mysqlshdk::db::ISession>> sessions;
+    sessions.emplace_back(m_config.session());
+
+    while (sessions.size() < threads) {
+      try {
+        auto session = factory();
+        // see the workaround in run_checks_for_upgrade()
+        session->execute("USE mysql;");
+        sessions.emplace_back(std::move(session));
+      } catch (const std::exception &e) {
+        log_warning(
+            "Failed to open a session for the upgrade checks, continuing "
+            "with %zu thread(s): %s",
+            sessions.size(), e.what());
+        break;
+      }
+    }
+
+    log_info("Executing %zu upgrade checks using %zu thread(s)",
+             m_runnable.size(), sessions.size());
+
+    for (auto &session : sessions) {
+      m_threads.emplace_back(mysqlsh::spawn_scoped_thread(
+          [this, session = std::move(session)]() {
+            mysqlsh::Mysql_thread mysql_thread;
+
+            while (!m_interrupted) {
+              const auto next = m_next++;
+
+              if (next >= m_runnable.size()) {
+                break;
+              }
+
+              const auto idx = m_runnable[next];
+              auto result = run(idx, session);
+
+              {
+                std::lock_guard lock{m_mutex};
+                m_results[idx] = std::move(result);
+              }
+
+              m_result_ready.notify_all();
+            }
+          }));
+    }
+  }
+
+  Check_result run(std::size_t idx,
+                   const std::shared_ptr<mysqlshdk::db::ISession> &session) {
+    const auto &check = m_checklist[idx];
+    Check_result result;
+    const auto start = std::chrono::steady_clock::now();
+
+    try {
+      result.issues = m_config.filter_issues(
+          check->run(session, m_config.upgrade_info(), m_cache));
+    } catch (...) {
+      result.error = std::current_exception();
+    }
+
+    result.execution_time = std::chrono::duration<double>(
+                                std::chrono::steady_clock::now() - start)
+                                .count();
+
+    log_debug("Check %s finished in %.3f seconds", check->get_name().c_str(),
+              result.execution_time);
+
+    return result;
+  }
+
+  const Upgrade_check_config &m_config;
+  const Upgrade_check_registry::Upgrade_check_vec &m_checklist;
+  Checker_cache *m_cache;
+
+  std::vector<std::size_t> m_runnable;
+  std::atomic<std::size_t> m_next = 0;
+  std::atomic<bool> m_interrupted = false;
+
+  std::mutex m_mutex;
+  std::condition_variable m_result_ready;
+  std::vector<std::optional<Check_result>> m_results;
+
+  std::vector<std::thread> m_threads;
+};
+
+}  // namespace
+
 bool run_checks_for_upgrade(const Upgrade_check_config &config,
                             Upgrade_check_output_formatter &print) {
   assert(config.session());
@@ -142,24 +308,33 @@ bool run_checks_for_upgrade(const Upgrade_check_config &config,
   // up to 5.7.39
   config.session()->execute("USE mysql;");
 
-  for (const auto &check : checklist)
+  Check_runner runner{config, checklist, &cache};
+
+  for (std::size_t i = 0; i < checklist.size(); ++i) {
+    const auto &check = checklist[i];
+
     if (check->is_runnable()) {
+      print.check_title(*check);
+
+      auto result = runner.result(i);
+
       try {
-        print.check_title(*check);
+        if (result.error) {
+          std::rethrow_exception(result.error);
+        }
 
-        const auto issues = config.filter_issues(
-            check->run(config.session(), config.upgrade_info(), &cache));
-        for (const auto &issue : issues) update_counts(issue.level);
-        print.check_results(*check, issues);
+        for (const auto &issue : result.issues) update_counts(issue.level);
+        print.check_results(*check, result.issues, result.execution_time);
       } catch (const Check_configuration_error &e) {
-        print.check_error(*check, e.what(), false);
+        print.check_error(*check, e.what(), result.execution_time, false);
       } catch (const std::exception &e) {
-        print.check_error(*check, e.what());
+        print.check_error(*check, e.what(), result.execution_time);
       }
     } else {
       update_counts(dynamic_cast<Manual_check *>(check.get())->get_level());
       print.manual_check(*check);
     }
+  }
 
   std::string summary;
   if (errors > 0) {
@@ -232,6 +232,8 @@ Checker_cache::Checker_cache(Filtering_options *db_filters)
 
 const Checker_cache::Table_info *Checker_cache::get_table(
     const std::string &schema_table, bool case_sensitive) const {
+  std::lock_guard lock{m_mutex};
+
   decltype(m_tables)::const_iterator t;
   if (case_sensitive) {
     t = m_tables.find(schema_table);
@@ -247,6 +249,8 @@ const Checker_cache::Table_info *Checker_cache::get_table(
 }
 
 void Checker_cache::cache_tables(mysqlshdk::db::ISession *session) {
+  std::lock_guard lock{m_mutex};
+
   if (!m_tables.empty()) return;
 
   std::string query =
@@ -267,6 +271,8 @@ void Checker_cache::cache_tables(mysqlshdk::db::ISession *session) {
 
 const Checker_cache::Sysvar_info *Checker_cache::get_sysvar(
     const std::string &name) const {
+  std::lock_guard lock{m_mutex};
+
   auto t = m_sysvars.find(name);
   if (t != m_sysvars.end()) return &t->second;
   return nullptr;
@@ -274,6 +280,8 @@ const Checker_cache::Sysvar_info *Checker_cache::get_sysvar(
 
 void Checker_cache::cache_sysvars(mysqlshdk::db::ISession *session,
                                   const Upgrade_info &server_info) {
+  std::lock_guard lock{m_mutex};
+
   // Cache is already loaded...
   if (!m_sysvars.empty()) return;
 
@@ -26,6 +26,7 @@
 #ifndef MODULES_UTIL_UPGRADE_CHECKER_COMMON_H_
 #define MODULES_UTIL_UPGRADE_CHECKER_COMMON_H_
 
+#include <mutex>
 #include <optional>
 #include <set>
 #include <stdexcept>
@@ -228,6 +229,9 @@ class Checker_cache {
                               bool case_sensitive = true) const;
   const Sysvar_info *get_sysvar(const std::string &name) const;
 
+  // these are safe to be called by checks executed in parallel, data is
+  // fetched only once, returned pointers remain valid for the lifetime of the
+  // cache
   void cache_tables(mysqlshdk::db::ISession *session);
   void cache_sysvars(mysqlshdk::db::ISession *session,
                      const Upgrade_info &server_info);
@@ -241,6 +245,7 @@ class Checker_cache {
   mysqlshdk::db::Query_helper m_query_helper;
   std::unordered_map<std::string, Table_info> m_tables;
   std::unordered_map<std::string, Sysvar_info> m_sysvars;
+  mutable std::mutex m_mutex;
 };
 
 const std::string &get_translation(const char *item);
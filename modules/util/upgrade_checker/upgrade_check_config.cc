@@ -34,7 +34,8 @@ namespace mysqlsh {
 namespace upgrade_checker {
 
 Upgrade_check_config::Upgrade_check_config(const Upgrade_check_options &options)
-    : m_output_format(options.output_format),
+    : m_threads(options.threads),
+      m_output_format(options.output_format),
       m_include(options.include_list),
       m_exclude(options.exclude_list),
       m_list_checks(options.list_checks) {
@@ -44,6 +44,8 @@ namespace upgrade_checker {
 class Upgrade_check_config final {
  public:
   using Include_issue = std::function<bool(const Upgrade_issue &)>;
+  using Session_factory =
+      std::function<std::shared_ptr<mysqlshdk::db::ISession>()>;
 
   explicit Upgrade_check_config(const Upgrade_check_options &options);
 
@@ -55,6 +57,18 @@ class Upgrade_check_config final {
     return m_session;
   }
 
+  /**
+   * Sets the callback used to create additional sessions, checks are executed
+   * in parallel only if it's set.
+   */
+  void set_session_factory(const Session_factory &factory) {
+    m_session_factory = factory;
+  }
+
+  const Session_factory &session_factory() const { return m_session_factory; }
+
+  uint64_t threads() const noexcept { return m_threads; }
+
   std::unique_ptr<Upgrade_check_output_formatter> formatter() const;
 
   void set_user_privileges(
@@ -93,6 +107,8 @@ class Upgrade_check_config final {
 
   Upgrade_info m_upgrade_info;
   std::shared_ptr<mysqlshdk::db::ISession> m_session;
+  Session_factory m_session_factory;
+  uint64_t m_threads = 1;
   std::string m_output_format;
   const mysqlshdk::mysql::User_privileges *m_privileges = nullptr;
   Include_issue m_filter;
@@ -101,7 +101,8 @@ class Text_upgrade_checker_output : public Upgrade_check_output_formatter {
   }
 
   void check_results(const Upgrade_check &check,
-                     const std::vector<Upgrade_issue> &results) override {
+                     const std::vector<Upgrade_issue> &results,
+                     double) override {
     std::function<std::string(const Upgrade_issue &)> issue_formater(
         upgrade_issue_to_string);
     if (results.empty()) {
@@ -132,7 +133,7 @@ class Text_upgrade_checker_output : public Upgrade_check_output_formatter {
   }
 
   void check_error(const Upgrade_check &check, const char *description,
-                   bool runtime_error = true) override {
+                   double, bool runtime_error = true) override {
     m_console->print("  ");
     if (runtime_error) m_console->print_diag("Check failed: ");
     m_console->println(description);
@@ -312,7 +313,8 @@ class JSON_upgrade_checker_output : public Upgrade_check_output_formatter {
   void check_title(const Upgrade_check &) override {}
 
   void check_results(const Upgrade_check &check,
-                     const std::vector<Upgrade_issue> &results) override {
+                     const std::vector<Upgrade_issue> &results,
+                     double execution_time) override {
     rapidjson::Value check_object(rapidjson::kObjectType);
     rapidjson::Value id;
     check_object.AddMember("id", rapidjson::StringRef(check.get_name().c_str()),
@@ -366,11 +368,12 @@ class JSON_upgrade_checker_output : public Upgrade_check_output_formatter {
     }
 
     check_object.AddMember("detectedProblems", issues, m_allocator);
+    check_object.AddMember("executionTime", execution_time, m_allocator);
     m_checks.PushBack(check_object, m_allocator);
   }
 
   void check_error(const Upgrade_check &check, const char *description,
-                   bool runtime_error = true) override {
+                   double execution_time, bool runtime_error = true) override {
     rapidjson::Value check_object(rapidjson::kObjectType);
 
     check_object.AddMember("id", rapidjson::StringRef(check.get_name().c_str()),
@@ -392,6 +395,8 @@ class JSON_upgrade_checker_output : public Upgrade_check_output_formatter {
                              rapidjson::StringRef(check.get_doc_link().c_str()),
                              m_allocator);
 
+    check_object.AddMember("executionTime", execution_time, m_allocator);
+
     rapidjson::Value issues(rapidjson::kArrayType);
     m_checks.PushBack(check_object, m_allocator);
   }
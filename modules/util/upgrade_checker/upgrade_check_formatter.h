@@ -49,9 +49,12 @@ class Upgrade_check_output_formatter {
                           bool explicit_target_version,
                           const std::string &warning) = 0;
   virtual void check_title(const Upgrade_check &check) = 0;
+  // execution_time is given in seconds
   virtual void check_results(const Upgrade_check &check,
-                             const std::vector<Upgrade_issue> &results) = 0;
+                             const std::vector<Upgrade_issue> &results,
+                             double execution_time) = 0;
   virtual void check_error(const Upgrade_check &check, const char *description,
+                           double execution_time,
                            bool runtime_error = true) = 0;
   virtual void manual_check(const Upgrade_check &check) = 0;
   virtual void summarize(
@@ -60,6 +60,7 @@ const shcore::Option_pack_def<Upgrade_check_options>
           .optional("include", &Upgrade_check_options::include)
           .optional("exclude", &Upgrade_check_options::exclude)
           .optional("list", &Upgrade_check_options::list_checks)
+          .optional("threads", &Upgrade_check_options::threads)
           .on_done(&Upgrade_check_options::verify_options);
   return opts;
 }
@@ -91,6 +92,11 @@ void Upgrade_check_options::verify_options() {
           include_list, exclude_list, "check", "", "")) {
     throw std::invalid_argument("Conflicting filtering options");
   }
+
+  if (0 == threads) {
+    throw std::invalid_argument(
+        "The value of the 'threads' option must be greater than 0.");
+  }
 }
 
 }  // namespace upgrade_checker
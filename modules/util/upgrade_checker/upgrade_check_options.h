@@ -26,6 +26,7 @@
 #ifndef MODULES_UTIL_UPGRADE_CHECKER_UPGRADE_CHECK_OPTIONS_H_
 #define MODULES_UTIL_UPGRADE_CHECKER_UPGRADE_CHECK_OPTIONS_H_
 
+#include <cstdint>
 #include <optional>
 #include <string>
 
@@ -49,6 +50,7 @@ struct Upgrade_check_options {
   Check_id_set include_list;
   Check_id_set exclude_list;
   bool list_checks = false;
+  uint64_t threads = 4;
 
   mysqlshdk::utils::Version get_target_version() const;
 
@@ -43,6 +43,7 @@
 #define SHCORE_DBA_LOG_SQL "dba.logSql"
 #define SHCORE_DBA_CONNECTIVITY_CHECKS "dba.connectivityChecks"
 #define SHCORE_LOG_FILE_NAME "logFile"
+#define SHCORE_LOG_ASYNC "logAsync"
 #define SHCORE_LOG_SQL "logSql"
 #define SHCORE_LOG_SQL_IGNORE "logSql.ignorePattern"
 #define SHCORE_LOG_SQL_IGNORE_UNSAFE "logSql.ignorePatternUnsafe"
@@ -147,6 +148,7 @@ class Shell_options final : public shcore::Options {
     std::string log_sql_ignore_unsafe;
     shcore::Logger::LOG_LEVEL log_level = shcore::Logger::LOG_INFO;
     std::string log_file;
+    bool log_async = false;
     int verbose_level = 0;
     bool wizards = true;
     bool admin_mode = false;
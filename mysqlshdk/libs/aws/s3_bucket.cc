@@ -99,7 +99,8 @@ S3_bucket::S3_bucket(const S3_bucket_config_ptr &config)
 
 rest::Signed_request S3_bucket::list_objects_request(
     const std::string &prefix, size_t limit, bool recursive,
-    const Object_details::Fields_mask &, const std::string &start_from) {
+    const Object_details::Fields_mask &, const std::string &start_from,
+    const std::string &start_after) {
   // ListObjectsV2
   rest::Query query = {{"list-type", "2"}};
 
@@ -122,6 +123,10 @@ rest::Signed_request S3_bucket::list_objects_request(
     query.emplace("continuation-token", encode_query(start_from));
   }
 
+  if (!start_after.empty()) {
+    query.emplace("start-after", encode_query(start_after));
+  }
+
   return create_bucket_request(query);
 }
 
@@ -74,11 +74,17 @@ class S3_bucket : public storage::backend::object_storage::Container {
 
   void delete_objects(const std::vector<std::string> &list);
 
+  bool uses_body_sha256() const override {
+    return !m_config->unsigned_payload();
+  }
+
+  bool has_list_objects_start_after() const override { return true; }
+
  private:
   rest::Signed_request list_objects_request(
       const std::string &prefix, size_t limit, bool recursive,
-      const Object_details::Fields_mask &fields,
-      const std::string &start_from) override;
+      const Object_details::Fields_mask &fields, const std::string &start_from,
+      const std::string &start_after) override;
 
   std::vector<Object_details> parse_list_objects(
       const rest::Base_response_buffer &buffer, std::string *next_start_from,
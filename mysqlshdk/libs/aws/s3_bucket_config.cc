@@ -36,6 +36,7 @@
 #include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_path.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
 
 #include "mysqlshdk/libs/aws/aws_signer.h"
 #include "mysqlshdk/libs/aws/config_credentials_provider.h"
@@ -392,6 +393,8 @@ S3_bucket_config::S3_bucket_config(const S3_bucket_options &options)
 
   setup_endpoint_uri();
 
+  setup_payload_signing();
+
   setup_credentials_provider();
 }
 
@@ -399,10 +402,12 @@ std::unique_ptr<rest::Signer> S3_bucket_config::signer() const {
   return std::make_unique<Aws_signer>(*this);
 }
 
-std::unique_ptr<rest::IRetry_strategy> S3_bucket_config::retry_strategy()
-    const {
-  return Aws_retry_strategy::create(
-      Signed_rest_service_config::retry_strategy());
+rest::Signed_rest_service_config::Retry_strategy_factory
+S3_bucket_config::retry_strategy_factory() const {
+  return [base = Signed_rest_service_config::retry_strategy_factory()]()
+             -> std::unique_ptr<rest::IRetry_strategy> {
+    return Aws_retry_strategy::create(base());
+  };
 }
 
 std::unique_ptr<storage::backend::object_storage::Container>
@@ -440,6 +445,8 @@ const std::string &S3_bucket_config::hash() const {
                                  .count());
     m_hash += '-';
     m_hash += m_region;
+    m_hash += '-';
+    m_hash += m_unsigned_payload ? "unsigned" : "signed";
   }
 
   return m_hash;
@@ -563,6 +570,31 @@ void S3_bucket_config::setup_endpoint_uri() {
   }
 }
 
+void S3_bucket_config::setup_payload_signing() {
+  if (!m_profile_from_config_file.has_value()) {
+    return;
+  }
+
+  const auto &settings = m_profile_from_config_file->settings;
+  const auto setting = settings.find("payload_signing_enabled");
+
+  if (settings.end() == setting ||
+      !shcore::str_caseeq(setting->second, "false")) {
+    return;
+  }
+
+  // payload can be left unsigned only if it's protected by TLS
+  if (storage::utils::scheme_matches(storage::utils::get_scheme(m_endpoint),
+                                     "https")) {
+    m_unsigned_payload = true;
+  } else {
+    log_warning(
+        "The 'payload_signing_enabled' setting is ignored, endpoint '%s' does "
+        "not use HTTPS.",
+        m_endpoint.c_str());
+  }
+}
+
 void S3_bucket_config::setup_credentials_provider() {
   std::vector<std::unique_ptr<Aws_credentials_provider>> providers;
 
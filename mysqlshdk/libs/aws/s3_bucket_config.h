@@ -65,7 +65,7 @@ class S3_bucket_config
 
   std::unique_ptr<rest::Signer> signer() const override;
 
-  std::unique_ptr<rest::IRetry_strategy> retry_strategy() const override;
+  Retry_strategy_factory retry_strategy_factory() const override;
 
   std::unique_ptr<storage::backend::object_storage::Container> container()
       const override;
@@ -84,6 +84,11 @@ class S3_bucket_config
 
   const std::string &region() const { return m_region; }
 
+  /**
+   * Whether the payload is excluded from the request signatures.
+   */
+  bool unsigned_payload() const { return m_unsigned_payload; }
+
   Aws_credentials_provider *credentials_provider() const {
     return m_credentials_provider.get();
   }
@@ -109,6 +114,8 @@ class S3_bucket_config
 
   void setup_endpoint_uri();
 
+  void setup_payload_signing();
+
   void setup_credentials_provider();
 
   std::string m_label = "AWS-S3-OS";
@@ -120,6 +127,7 @@ class S3_bucket_config
 
   std::string m_host;
   bool m_path_style_access = false;
+  bool m_unsigned_payload = false;
 
   std::optional<Aws_config_file::Profile> m_profile_from_credentials_file;
   std::optional<Aws_config_file::Profile> m_profile_from_config_file;
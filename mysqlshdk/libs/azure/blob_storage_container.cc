@@ -224,7 +224,9 @@ void Blob_container::delete_() {
 
 Signed_request Blob_container::list_objects_request(
     const std::string &prefix, size_t limit, bool recursive,
-    const Object_details::Fields_mask &, const std::string &start_from) {
+    const Object_details::Fields_mask &, const std::string &start_from,
+    const std::string &) {
+  // Azure does not support listing blobs starting after the given one
   return create_blob_container_request(
       {},
       list_objects_request_query(prefix, limit, recursive, start_from, false));
@@ -98,7 +98,8 @@ class Blob_container : public Container {
   Signed_request list_objects_request(const std::string &prefix, size_t limit,
                                       bool recursive,
                                       const Object_details::Fields_mask &fields,
-                                      const std::string &start_from) override;
+                                      const std::string &start_from,
+                                      const std::string &start_after) override;
 
   std::vector<Object_details> parse_list_objects(
       const Base_response_buffer &buffer, std::string *next_start_from,
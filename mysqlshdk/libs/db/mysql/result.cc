@@ -187,7 +187,7 @@ const IRow *Result::fetch_one() {
     if (!_persistent_pre_fetch) {
       if (!_pre_fetched_rows.empty()) {
         if (_fetched_row_count > 0)  // free the previously fetched row
-          _pre_fetched_rows.pop_front();
+          pop_pre_fetched_row();
         if (!_pre_fetched_rows.empty()) {
           // return the next row, but don't pop it yet otherwise it'll be freed
           const IRow *row = &_pre_fetched_rows.front();
@@ -208,7 +208,7 @@ const IRow *Result::fetch_one() {
     // clear state if we exited a pre_fetch scenario
     if (_pre_fetched_clear_at_end) {
       assert(_pre_fetched_rows.size() == 1);
-      _pre_fetched_rows.clear();
+      clear_pre_fetched_rows();
       _pre_fetched_clear_at_end = false;
     }
 
@@ -328,7 +328,7 @@ void Result::reset(std::shared_ptr<MYSQL_RES> res) {
   _pre_fetched = false;
   _pre_fetched_clear_at_end = false;
   _fetched_row_count = 0;
-  _pre_fetched_rows.clear();
+  clear_pre_fetched_rows();
   _result = std::move(res);
 
   if (res) {
@@ -350,13 +350,52 @@ void Result::buffer() {
   pre_fetch_rows(true);
 }
 
+void Result::push_pre_fetched_row(const IRow &row) {
+  // size of memory after which a new segment is started
+  constexpr std::size_t k_segment_size = 16 * Row_arena::k_default_block_size;
+
+  if (m_pre_fetch_segments.empty() ||
+      m_pre_fetch_segments.back().arena.capacity() >= k_segment_size) {
+    m_pre_fetch_segments.emplace_back();
+  }
+
+  auto &segment = m_pre_fetch_segments.back();
+  _pre_fetched_rows.emplace_back(row, &segment.arena);
+  ++segment.rows;
+}
+
+void Result::pop_pre_fetched_row() {
+  _pre_fetched_rows.pop_front();
+
+  auto &segment = m_pre_fetch_segments.front();
+
+  if (0 == --segment.rows) {
+    if (m_pre_fetch_segments.size() > 1) {
+      m_pre_fetch_segments.pop_front();
+    } else {
+      // keep the last segment, so that its memory can be reused
+      segment.arena.clear();
+    }
+  }
+}
+
+void Result::clear_pre_fetched_rows() {
+  _pre_fetched_rows.clear();
+
+  if (!m_pre_fetch_segments.empty()) {
+    m_pre_fetch_segments.resize(1);
+    m_pre_fetch_segments.front().arena.clear();
+    m_pre_fetch_segments.front().rows = 0;
+  }
+}
+
 bool Result::pre_fetch_row() {
   if (auto result = _result.lock(); result) {
     _persistent_pre_fetch = false;
 
     if (!has_resultset()) return false;
 
-    _pre_fetched_rows.emplace_back(*fetch_one());
+    push_pre_fetched_row(*fetch_one());
     _fetched_row_count = 0;
     _pre_fetched = true;
     _pre_fetched_clear_at_end = true;
@@ -372,7 +411,7 @@ bool Result::pre_fetch_rows(bool persistent) {
     if (!has_resultset()) return false;
     while (auto row = fetch_one()) {
       if (_stop_pre_fetch) return true;
-      _pre_fetched_rows.emplace_back(*row);
+      push_pre_fetched_row(*row);
     }
     _fetched_row_count = 0;
 
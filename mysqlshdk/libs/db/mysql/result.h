@@ -82,7 +82,15 @@ class SHCORE_PUBLIC Result : public mysqlshdk::db::IResult,
          bool buffered);
   void reset(std::shared_ptr<MYSQL_RES> res);
 
-  std::deque<mysqlshdk::db::Row_copy> _pre_fetched_rows;
+  // memory of pre-fetched rows is allocated in segments, a segment is released
+  // once all of its rows are consumed
+  struct Pre_fetch_segment {
+    mysqlshdk::db::Row_arena arena;
+    std::size_t rows = 0;
+  };
+
+  std::deque<Pre_fetch_segment> m_pre_fetch_segments;
+  std::deque<mysqlshdk::db::Flat_row> _pre_fetched_rows;
   // size_t _fetched_row_count = 0;
   // size_t _fetched_warning_count = 0;
   bool _stop_pre_fetch = false;
@@ -90,6 +98,10 @@ class SHCORE_PUBLIC Result : public mysqlshdk::db::IResult,
   bool _persistent_pre_fetch = false;
   bool _pre_fetched_clear_at_end = false;
 
+  void push_pre_fetched_row(const IRow &row);
+  void pop_pre_fetched_row();
+  void clear_pre_fetched_rows();
+
   bool pre_fetch_row();
   bool pre_fetch_rows(bool persistent);
   void stop_pre_fetch();
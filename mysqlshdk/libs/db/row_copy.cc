@@ -28,8 +28,11 @@
 #include <cassert>
 #include <climits>  // C limit constants
 #include <cmath>    // HUGE_VAL
+#include <cstdint>
+#include <cstring>
 #include <limits>   // std::numeric_limits
 #include <memory>
+#include <new>
 #include <stdexcept>
 #include <utility>
 #include "mysqlshdk/libs/utils/utils_string.h"
@@ -53,8 +56,7 @@ namespace db {
 
 #define GET_VALIDATE_TYPE(index, TYPE_CHECK)                                  \
   if (index >= num_fields()) throw FIELD_ERROR(index, "index out of bounds"); \
-  if (_data->fields[index] == nullptr)                                        \
-    throw FIELD_ERROR(index, "field is NULL");                                \
+  if (is_null(index)) throw FIELD_ERROR(index, "field is NULL");             \
   ftype = get_type(index);                                                    \
   if (!(TYPE_CHECK))                                                          \
     throw FIELD_ERROR1(index, "field type is %s", to_string(ftype).c_str());
@@ -314,5 +316,318 @@ void Mem_row::add_field(Type type) {
   _data->fields.push_back(nullptr);
 }
 
+Row_arena::Row_arena(Row_arena &&other) noexcept
+    : m_block_size(other.m_block_size),
+      m_capacity(std::exchange(other.m_capacity, 0)),
+      m_blocks(std::exchange(other.m_blocks, {})),
+      m_large_blocks(std::exchange(other.m_large_blocks, {})),
+      m_current(std::exchange(other.m_current, nullptr)),
+      m_end(std::exchange(other.m_end, nullptr)) {}
+
+Row_arena &Row_arena::operator=(Row_arena &&other) noexcept {
+  if (this != &other) {
+    m_block_size = other.m_block_size;
+    m_capacity = std::exchange(other.m_capacity, 0);
+    m_blocks = std::exchange(other.m_blocks, {});
+    m_large_blocks = std::exchange(other.m_large_blocks, {});
+    m_current = std::exchange(other.m_current, nullptr);
+    m_end = std::exchange(other.m_end, nullptr);
+  }
+
+  return *this;
+}
+
+void *Row_arena::allocate(std::size_t size, std::size_t alignment) {
+  assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+  assert(alignment <= alignof(std::max_align_t));
+
+  if (size > m_block_size / 2) {
+    // memory returned by new[] is suitably aligned
+    m_large_blocks.emplace_back(std::make_unique<char[]>(size));
+    m_capacity += size;
+    return m_large_blocks.back().get();
+  }
+
+  const auto align = [alignment](char *p) {
+    const auto misalignment = reinterpret_cast<std::uintptr_t>(p) &
+                              static_cast<std::uintptr_t>(alignment - 1);
+    return misalignment ? p + (alignment - misalignment) : p;
+  };
+
+  auto ptr = align(m_current);
+
+  if (!m_current || size > static_cast<std::size_t>(m_end - ptr)) {
+    m_blocks.emplace_back(std::make_unique<char[]>(m_block_size));
+    m_capacity += m_block_size;
+    m_current = m_blocks.back().get();
+    m_end = m_current + m_block_size;
+    ptr = m_current;
+  }
+
+  m_current = ptr + size;
+
+  return ptr;
+}
+
+void Row_arena::clear() {
+  m_large_blocks.clear();
+
+  if (!m_blocks.empty()) {
+    m_blocks.resize(1);
+    m_capacity = m_block_size;
+    m_current = m_blocks.front().get();
+    m_end = m_current + m_block_size;
+  } else {
+    m_capacity = 0;
+  }
+}
+
+Flat_row::Flat_row(const IRow &row, Row_arena *arena)
+    : m_num_fields(row.num_fields()) {
+  assert(arena);
+
+  const auto fields = static_cast<Field *>(
+      arena->allocate(sizeof(Field) * m_num_fields, alignof(Field)));
+
+  const auto copy = [arena](const char *data, std::size_t size, Field *f) {
+    const auto ptr = static_cast<char *>(arena->allocate(size));
+    if (size) ::memcpy(ptr, data, size);
+
+    f->data = ptr;
+    f->size = size;
+  };
+
+  const auto copy_string = [&copy](const std::string &s, Field *f) {
+    copy(s.data(), s.size(), f);
+  };
+
+  for (uint32_t i = 0; i < m_num_fields; ++i) {
+    const auto f = new (fields + i) Field();
+
+    f->type = row.get_type(i);
+    f->null = row.is_null(i);
+
+    if (f->null) continue;
+
+    switch (f->type) {
+      case Type::Null:
+        f->null = true;
+        break;
+
+      case Type::Decimal:
+      case Type::Bit:
+        copy_string(row.get_as_string(i), f);
+        break;
+
+      case Type::Date:
+      case Type::DateTime:
+      case Type::Time:
+      case Type::Geometry:
+      case Type::Json:
+      case Type::Enum:
+      case Type::Set:
+        copy_string(row.get_string(i), f);
+        break;
+
+      case Type::String:
+      case Type::Bytes: {
+        // avoid a temporary string
+        const auto data = row.get_string_data(i);
+        copy(data.first, data.second, f);
+        break;
+      }
+
+      case Type::Integer:
+        f->i = row.get_int(i);
+        break;
+
+      case Type::UInteger:
+        f->u = row.get_uint(i);
+        break;
+
+      case Type::Float:
+        f->f = row.get_float(i);
+        break;
+
+      case Type::Double:
+        f->d = row.get_double(i);
+        break;
+    }
+  }
+
+  m_fields = fields;
+}
+
+Type Flat_row::get_type(uint32_t index) const {
+  VALIDATE_INDEX(index);
+  return m_fields[index].type;
+}
+
+bool Flat_row::is_null(uint32_t index) const {
+  VALIDATE_INDEX(index);
+  return m_fields[index].null;
+}
+
+std::string Flat_row::get_as_string(uint32_t index) const {
+  if (is_null(index)) return "NULL";
+
+  switch (m_fields[index].type) {
+    case Type::Null:
+      return "NULL";
+
+    case Type::String:
+    case Type::Bytes:
+    case Type::Decimal:
+    case Type::Date:
+    case Type::DateTime:
+    case Type::Time:
+    case Type::Geometry:
+    case Type::Json:
+    case Type::Enum:
+    case Type::Set:
+    case Type::Bit:
+      return string_value(index);
+
+    case Type::Integer:
+      return std::to_string(m_fields[index].i);
+
+    case Type::UInteger:
+      return std::to_string(m_fields[index].u);
+
+    case Type::Float:
+      return std::to_string(m_fields[index].f);
+
+    case Type::Double:
+      return std::to_string(m_fields[index].d);
+  }
+  throw std::invalid_argument("Unknown type in field");
+}
+
+int64_t Flat_row::get_int(uint32_t index) const {
+  Type ftype;
+  std::string dec;
+  GET_VALIDATE_TYPE(index, (ftype == Type::Integer || ftype == Type::UInteger ||
+                            (ftype == Type::Decimal &&
+                             (dec = string_value(index)).find('.') ==
+                                 std::string::npos)));
+
+  if (ftype == Type::UInteger) {
+    const auto u = m_fields[index].u;
+    if (u > LLONG_MAX) {
+      throw FIELD_ERROR(index, "field value out of the allowed range");
+    }
+    return static_cast<int64_t>(u);
+  } else if (ftype == Type::Decimal) {
+    return std::stoll(dec);
+  }
+  return m_fields[index].i;
+}
+
+uint64_t Flat_row::get_uint(uint32_t index) const {
+  Type ftype;
+  std::string dec;
+  GET_VALIDATE_TYPE(index, (ftype == Type::Integer || ftype == Type::UInteger ||
+                            (ftype == Type::Decimal &&
+                             (dec = string_value(index)).find('.') ==
+                                 std::string::npos)));
+
+  if (ftype == Type::Integer) {
+    const auto i = m_fields[index].i;
+    if (i < 0) {
+      throw FIELD_ERROR(index, "field value out of the allowed range");
+    }
+    return static_cast<uint64_t>(i);
+  } else if (ftype == Type::Decimal) {
+    if (!dec.empty() && dec[0] == '-') {
+      throw FIELD_ERROR(index, "field value out of the allowed range");
+    }
+    return std::stoull(dec);
+  }
+  return m_fields[index].u;
+}
+
+std::string Flat_row::get_string(uint32_t index) const {
+  Type ftype;
+  GET_VALIDATE_TYPE(index, (is_string_type(ftype)));
+  return string_value(index);
+}
+
+std::pair<const char *, size_t> Flat_row::get_string_data(
+    uint32_t index) const {
+  Type ftype;
+  GET_VALIDATE_TYPE(index, (ftype == Type::String || ftype == Type::Bytes));
+  return {m_fields[index].data, m_fields[index].size};
+}
+
+void Flat_row::get_raw_data(uint32_t index, const char **out_data,
+                            size_t *out_size) const {
+  if (is_null(index)) {
+    *out_data = nullptr;
+    *out_size = 0;
+  } else {
+    switch (m_fields[index].type) {
+      case Type::Integer:
+      case Type::UInteger:
+      case Type::Float:
+      case Type::Double:
+        m_raw_data_cache = get_as_string(index);
+        *out_data = m_raw_data_cache.c_str();
+        *out_size = m_raw_data_cache.length();
+        break;
+
+      default:
+        *out_data = m_fields[index].data;
+        *out_size = m_fields[index].size;
+        break;
+    }
+  }
+}
+
+float Flat_row::get_float(uint32_t index) const {
+  Type ftype;
+  GET_VALIDATE_TYPE(index, (ftype == Type::Float || ftype == Type::Decimal ||
+                            ftype == Type::Double));
+  switch (ftype) {
+    case Type::Decimal:
+      try {
+        return std::stof(string_value(index));
+      } catch (...) {
+        throw FIELD_ERROR(index, "float value out of the allowed range");
+      }
+    case Type::Double:
+      return static_cast<float>(m_fields[index].d);
+    case Type::Float:
+      return m_fields[index].f;
+    default:
+      throw std::logic_error("internal error");
+  }
+}
+
+double Flat_row::get_double(uint32_t index) const {
+  Type ftype;
+  GET_VALIDATE_TYPE(index, (ftype == Type::Double || ftype == Type::Float ||
+                            ftype == Type::Decimal));
+  switch (ftype) {
+    case Type::Decimal:
+      try {
+        return std::stod(string_value(index));
+      } catch (const std::exception &) {
+        throw FIELD_ERROR(index, "double value out of the allowed range");
+      }
+    case Type::Float:
+      return static_cast<double>(m_fields[index].f);
+    case Type::Double:
+      return m_fields[index].d;
+    default:
+      throw std::logic_error("internal error");
+  }
+}
+
+std::tuple<uint64_t, int> Flat_row::get_bit(uint32_t index) const {
+  Type ftype;
+  GET_VALIDATE_TYPE(index, (ftype == Type::Bit));
+  return shcore::string_to_bits(string_value(index));
+}
+
 }  // namespace db
 }  // namespace mysqlshdk
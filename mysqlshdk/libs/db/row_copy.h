@@ -29,6 +29,7 @@
 #define MYSQLSHDK_LIBS_DB_ROW_COPY_H_
 
 #include <cassert>
+#include <cstddef>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -208,6 +209,119 @@ class SHCORE_PUBLIC Mutable_row : public Mem_row {
   virtual ~Mutable_row() = default;
 };
 
+/**
+ * Allocates memory for Flat_row objects. Memory is allocated in big blocks and
+ * released in bulk, when arena is cleared or destroyed.
+ */
+class SHCORE_PUBLIC Row_arena final {
+ public:
+  static constexpr std::size_t k_default_block_size = 64 * 1024;
+
+  explicit Row_arena(std::size_t block_size = k_default_block_size)
+      : m_block_size(block_size) {}
+
+  Row_arena(const Row_arena &) = delete;
+  Row_arena &operator=(const Row_arena &) = delete;
+  // the moved-from arena is left empty
+  Row_arena(Row_arena &&other) noexcept;
+  Row_arena &operator=(Row_arena &&other) noexcept;
+
+  ~Row_arena() = default;
+
+  /**
+   * Allocates a memory region, valid until arena is cleared or destroyed.
+   *
+   * @param size number of bytes to allocate
+   * @param alignment required alignment, must be a power of two not greater
+   *        than alignof(std::max_align_t)
+   */
+  void *allocate(std::size_t size, std::size_t alignment = 1);
+
+  /**
+   * Releases all the allocated memory. First block is kept, so that it can be
+   * reused.
+   */
+  void clear();
+
+  /**
+   * Total size of memory blocks allocated by this arena.
+   */
+  std::size_t capacity() const { return m_capacity; }
+
+ private:
+  std::size_t m_block_size;
+  std::size_t m_capacity = 0;
+  // regular blocks, the last one is the current one
+  std::vector<std::unique_ptr<char[]>> m_blocks;
+  // blocks holding allocations bigger than half of the block size
+  std::vector<std::unique_ptr<char[]>> m_large_blocks;
+  char *m_current = nullptr;
+  char *m_end = nullptr;
+};
+
+/**
+ * A Row object like Row_copy, but with a flat representation: all the fields
+ * are stored in a single table of fixed-size entries, values of numeric types
+ * are held by the entries, values of other types are copied to the arena, so
+ * copying a row does not allocate memory on the heap.
+ *
+ * The Row_arena used to create this row must outlive it.
+ */
+class SHCORE_PUBLIC Flat_row : public IRow {
+ public:
+  Flat_row() = default;
+  Flat_row(const IRow &row, Row_arena *arena);
+
+  Flat_row(const Flat_row &) = delete;
+  Flat_row &operator=(const Flat_row &) = delete;
+  Flat_row(Flat_row &&) = default;
+  Flat_row &operator=(Flat_row &&) = default;
+
+  ~Flat_row() override = default;
+
+  uint32_t num_fields() const override { return m_num_fields; }
+
+  Type get_type(uint32_t index) const override;
+  bool is_null(uint32_t index) const override;
+  std::string get_as_string(uint32_t index) const override;
+
+  std::string get_string(uint32_t index) const override;
+  int64_t get_int(uint32_t index) const override;
+  uint64_t get_uint(uint32_t index) const override;
+  float get_float(uint32_t index) const override;
+  double get_double(uint32_t index) const override;
+  std::pair<const char *, size_t> get_string_data(
+      uint32_t index) const override;
+  void get_raw_data(uint32_t index, const char **out_data,
+                    size_t *out_size) const override;
+  std::tuple<uint64_t, int> get_bit(uint32_t index) const override;
+
+ private:
+  struct Field {
+    // value of non-numeric types
+    const char *data;
+    std::size_t size;
+
+    union {
+      int64_t i;
+      uint64_t u;
+      float f;
+      double d;
+    };
+
+    Type type;
+    bool null;
+  };
+
+  std::string string_value(uint32_t index) const {
+    return std::string(m_fields[index].data, m_fields[index].size);
+  }
+
+  const Field *m_fields = nullptr;
+  uint32_t m_num_fields = 0;
+  mutable std::string m_raw_data_cache;
+};
+
 }  // namespace db
 }  // namespace mysqlshdk
 #endif  // MYSQLSHDK_LIBS_DB_ROW_COPY_H_
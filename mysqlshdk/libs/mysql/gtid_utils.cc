@@ -26,7 +26,10 @@
 #include "mysqlshdk/libs/mysql/gtid_utils.h"
 
 #include <algorithm>
+#include <map>
 #include <optional>
+#include <utility>
+#include <vector>
 
 #include "mysqlshdk/libs/mysql/instance.h"
 #include "mysqlshdk/libs/mysql/replication.h"
@@ -136,6 +139,181 @@ void iter_ranges(std::string_view gtids, auto &&cb) {
       },
       ",");
 }
+
+// sorted, disjoint and non-adjacent [begin, end] intervals
+using Intervals = std::vector<std::pair<uint64_t, uint64_t>>;
+// UUID -> tag -> intervals, untagged intervals use an empty tag
+using Gtid_intervals = std::map<std::string, std::map<std::string, Intervals>>;
+
+void coalesce(Intervals *intervals) {
+  if (intervals->empty()) return;
+
+  std::sort(intervals->begin(), intervals->end());
+
+  auto out = intervals->begin();
+
+  for (auto it = std::next(out); it != intervals->end(); ++it) {
+    if (it->first <= out->second + 1) {
+      out->second = std::max(out->second, it->second);
+    } else {
+      *++out = *it;
+    }
+  }
+
+  intervals->erase(std::next(out), intervals->end());
+}
+
+Gtid_intervals parse(std::string_view gtids) {
+  Gtid_intervals result;
+
+  iter_ranges(gtids, [&result](std::string_view uuid, std::string_view tag,
+                               uint64_t begin, uint64_t end) {
+    // server rejects such sets with ER_MALFORMED_GTID_SET_SPECIFICATION
+    if (0 == begin || begin > end) {
+      throw std::invalid_argument(shcore::str_format(
+          "Invalid GTID range: %.*s:%" PRIu64 "-%" PRIu64,
+          static_cast<int>(uuid.size()), uuid.data(), begin, end));
+    }
+
+    result[shcore::str_lower(uuid)][shcore::str_lower(tag)].emplace_back(begin,
+                                                                        end);
+  });
+
+  for (auto &uuid : result) {
+    for (auto &tag : uuid.second) {
+      coalesce(&tag.second);
+    }
+  }
+
+  return result;
+}
+
+std::string to_string(const Gtid_intervals &gtids) {
+  std::string result;
+
+  for (const auto &uuid : gtids) {
+    bool first_tag = true;
+
+    for (const auto &tag : uuid.second) {
+      if (tag.second.empty()) continue;
+
+      if (first_tag) {
+        if (!result.empty()) result.append(",\n");
+        result.append(uuid.first);
+        first_tag = false;
+      }
+
+      if (!tag.first.empty()) result.append(":").append(tag.first);
+
+      for (const auto &range : tag.second) {
+        result.append(":").append(std::to_string(range.first));
+
+        if (range.first != range.second) {
+          result.append("-").append(std::to_string(range.second));
+        }
+      }
+    }
+  }
+
+  return result;
+}
+
+Intervals subtract(const Intervals &a, const Intervals &b) {
+  Intervals result;
+  auto it = b.begin();
+
+  for (auto range : a) {
+    // skip intervals which end before the current one
+    while (it != b.end() && it->second < range.first) ++it;
+
+    auto sub = it;
+
+    while (sub != b.end() && sub->first <= range.second) {
+      if (sub->first > range.first) {
+        result.emplace_back(range.first, sub->first - 1);
+      }
+
+      if (sub->second >= range.second) {
+        range.first = range.second + 1;
+        break;
+      }
+
+      range.first = sub->second + 1;
+      ++sub;
+    }
+
+    if (range.first <= range.second) {
+      result.emplace_back(range);
+    }
+  }
+
+  return result;
+}
+
+Intervals intersect(const Intervals &a, const Intervals &b) {
+  Intervals result;
+  auto ia = a.begin();
+  auto ib = b.begin();
+
+  while (ia != a.end() && ib != b.end()) {
+    const auto begin = std::max(ia->first, ib->first);
+    const auto end = std::min(ia->second, ib->second);
+
+    if (begin <= end) {
+      result.emplace_back(begin, end);
+    }
+
+    if (ia->second < ib->second) {
+      ++ia;
+    } else {
+      ++ib;
+    }
+  }
+
+  return result;
+}
+
+bool contains(const Intervals &a, const Intervals &b) {
+  auto ia = a.begin();
+
+  for (const auto &range : b) {
+    while (ia != a.end() && ia->second < range.first) ++ia;
+
+    // intervals are coalesced, range has to fit into a single one of them
+    if (ia == a.end() || ia->first > range.first || ia->second < range.second) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+template <typename F>
+Gtid_intervals combine(const Gtid_intervals &a, const Gtid_intervals &b,
+                       F &&op) {
+  Gtid_intervals result;
+  static const std::map<std::string, Intervals> k_no_tags;
+  static const Intervals k_no_intervals;
+
+  for (const auto &uuid : a) {
+    const auto other_uuid = b.find(uuid.first);
+    const auto &other_tags =
+        b.end() == other_uuid ? k_no_tags : other_uuid->second;
+
+    for (const auto &tag : uuid.second) {
+      const auto other_tag = other_tags.find(tag.first);
+      auto intervals = op(
+          tag.second,
+          other_tags.end() == other_tag ? k_no_intervals : other_tag->second);
+
+      if (!intervals.empty()) {
+        result[uuid.first][tag.first] = std::move(intervals);
+      }
+    }
+  }
+
+  return result;
+}
 }  // namespace
 
 Gtid_range::Gtid_range(std::string_view range_uuid, std::string_view range_tag,
@@ -189,36 +367,35 @@ Gtid_set Gtid_set::from_received_transaction_set(
   return Gtid_set(get_received_gtid_set(server, channel), true);
 }
 
-Gtid_set &Gtid_set::normalize(const mysqlshdk::mysql::IInstance &server) {
+Gtid_set &Gtid_set::normalize() {
   if (!std::exchange(m_normalized, true)) {
-    m_gtid_set = server.queryf_one_string(0, "", "SELECT gtid_subtract(?, '')",
-                                          m_gtid_set);
+    m_gtid_set = to_string(parse(m_gtid_set));
   }
   return *this;
 }
 
-Gtid_set &Gtid_set::intersect(const Gtid_set &other,
-                              const mysqlshdk::mysql::IInstance &server) {
+Gtid_set &Gtid_set::intersect(const Gtid_set &other) {
+  m_normalized = true;
+
   if (m_gtid_set.empty() || other.m_gtid_set.empty()) {
     m_gtid_set.clear();
-    m_normalized = false;
     return *this;
   }
 
-  // a /\ b = a - (a - b)
-  m_normalized = true;
-  m_gtid_set = server.queryf_one_string(
-      0, "", "SELECT gtid_subtract(?, gtid_subtract(?, ?))", other.m_gtid_set,
-      other.m_gtid_set, m_gtid_set);
+  m_gtid_set = to_string(combine(parse(m_gtid_set), parse(other.m_gtid_set),
+                                 [](const Intervals &a, const Intervals &b) {
+                                   return mysql::intersect(a, b);
+                                 }));
 
   return *this;
 }
 
-Gtid_set &Gtid_set::subtract(const Gtid_set &other,
-                             const mysqlshdk::mysql::IInstance &server) {
+Gtid_set &Gtid_set::subtract(const Gtid_set &other) {
   m_normalized = true;
-  m_gtid_set = server.queryf_one_string(0, "", "SELECT gtid_subtract(?, ?)",
-                                        m_gtid_set, other.m_gtid_set);
+  m_gtid_set = to_string(combine(parse(m_gtid_set), parse(other.m_gtid_set),
+                                 [](const Intervals &a, const Intervals &b) {
+                                   return mysql::subtract(a, b);
+                                 }));
   return *this;
 }
 
@@ -304,10 +481,25 @@ Gtid_set Gtid_set::get_gtids_from(std::string_view uuid,
   return matches;
 }
 
-bool Gtid_set::contains(const Gtid_set &other,
-                        const mysqlshdk::mysql::IInstance &server) const {
-  return server.queryf_one_int(0, 0, "SELECT gtid_subtract(?, ?) = ''",
-                               other.m_gtid_set, m_gtid_set) != 0;
+bool Gtid_set::contains(const Gtid_set &other) const {
+  const auto gtids = parse(m_gtid_set);
+
+  for (const auto &uuid : parse(other.m_gtid_set)) {
+    const auto tags = gtids.find(uuid.first);
+
+    if (gtids.end() == tags) return false;
+
+    for (const auto &tag : uuid.second) {
+      const auto intervals = tags->second.find(tag.first);
+
+      if (tags->second.end() == intervals ||
+          !mysql::contains(intervals->second, tag.second)) {
+        return false;
+      }
+    }
+  }
+
+  return true;
 }
 
 uint64_t Gtid_set::count() const {
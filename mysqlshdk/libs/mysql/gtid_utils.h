@@ -67,6 +67,10 @@ struct Gtid_range {
  * This represents a GTID set in a form of a single string. It can store a
  * single GTID or multiple GTIDs from different servers (different UUIDs) with
  * multiple ranges.
+ *
+ * Set operations are computed locally, results are normalized in the same way
+ * as the server does it: UUIDs are sorted, untagged ranges are followed by the
+ * sorted tags, ranges are merged.
  */
 class Gtid_set {
  public:
@@ -86,24 +90,21 @@ class Gtid_set {
   static Gtid_set from_received_transaction_set(
       const mysqlshdk::mysql::IInstance &server, std::string_view channel);
 
-  Gtid_set &normalize(const mysqlshdk::mysql::IInstance &server);
+  Gtid_set &normalize();
 
-  Gtid_set &subtract(const Gtid_set &other,
-                     const mysqlshdk::mysql::IInstance &server);
+  Gtid_set &subtract(const Gtid_set &other);
 
   Gtid_set &add(const Gtid &gtid);
   Gtid_set &add(const Gtid_set &other);
   Gtid_set &add(const Gtid_range &gtids);
 
-  Gtid_set &intersect(const Gtid_set &other,
-                      const mysqlshdk::mysql::IInstance &server);
+  Gtid_set &intersect(const Gtid_set &other);
 
   Gtid_set get_gtids_tagged() const;
   Gtid_set get_gtids_from(std::string_view uuid) const;
   Gtid_set get_gtids_from(std::string_view uuid, std::string_view tag) const;
 
-  bool contains(const Gtid_set &other,
-                const mysqlshdk::mysql::IInstance &server) const;
+  bool contains(const Gtid_set &other) const;
 
   void enumerate(const std::function<void(Gtid)> &fn) const;
 
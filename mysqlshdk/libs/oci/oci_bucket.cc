@@ -93,7 +93,8 @@ Oci_bucket::Oci_bucket(const Oci_bucket_config_ptr &config)
 
 rest::Signed_request Oci_bucket::list_objects_request(
     const std::string &prefix, size_t limit, bool recursive,
-    const Object_details::Fields_mask &fields, const std::string &start_from) {
+    const Object_details::Fields_mask &fields, const std::string &start_from,
+    const std::string &start_after) {
   std::vector<std::string> parameters;
 
   if (!prefix.empty()) {
@@ -134,6 +135,10 @@ rest::Signed_request Oci_bucket::list_objects_request(
     parameters.emplace_back("start=" + pctencode_query_value(start_from));
   }
 
+  if (!start_after.empty()) {
+    parameters.emplace_back("startAfter=" + pctencode_query_value(start_after));
+  }
+
   auto path = kListObjectsPath;
 
   if (!parameters.empty()) {
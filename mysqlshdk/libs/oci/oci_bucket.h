@@ -86,14 +86,16 @@ class Oci_bucket : public storage::backend::object_storage::Container {
 
   void delete_();
 
+  bool has_list_objects_start_after() const override { return true; }
+
  private:
   rest::Signed_request create_request(const std::string &object_name,
                                       rest::Headers headers = {}) const;
 
   rest::Signed_request list_objects_request(
       const std::string &prefix, size_t limit, bool recursive,
-      const Object_details::Fields_mask &fields,
-      const std::string &start_from) override;
+      const Object_details::Fields_mask &fields, const std::string &start_from,
+      const std::string &start_after) override;
 
   std::vector<Object_details> parse_list_objects(
       const rest::Base_response_buffer &buffer, std::string *next_start_from,
@@ -26,7 +26,16 @@
 #include "mysqlshdk/libs/rest/rest_service.h"
 
 #include <curl/curl.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <map>
+#include <mutex>
 #include <optional>
+#include <thread>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -168,6 +177,7 @@ std::string format_exception(const std::exception &e) {
 }
 
 void log_failed_request(const std::string &base_url, const Request &request,
+                        const Headers &headers,
                         const std::string &context = {}) {
   std::string full_context;
 
@@ -178,7 +188,12 @@ void log_failed_request(const std::string &base_url, const Request &request,
   log_warning("Request failed: %s %s %s%s", base_url.c_str(),
               shcore::str_upper(type_name(request.type)).c_str(),
               request.full_path().masked().c_str(), full_context.c_str());
-  log_info("REQUEST HEADERS:\n%s", format_headers(request.headers()).c_str());
+  log_info("REQUEST HEADERS:\n%s", format_headers(headers).c_str());
+}
+
+void log_failed_request(const std::string &base_url, const Request &request,
+                        const std::string &context = {}) {
+  log_failed_request(base_url, request, request.headers(), context);
 }
 
 void log_failed_response(const Response &response) {
@@ -188,6 +203,270 @@ void log_failed_response(const Response &response) {
                                      : "<EMPTY>");
 }
 
+/**
+ * DNS cache and TLS sessions shared by all CURL handles, new connections to
+ * the same host (i.e. from another thread, or after a connection was reset)
+ * skip the name resolution and resume the TLS session.
+ *
+ * Connections themselves are not shared, a CURL connection cannot be used by
+ * multiple threads at the same time.
+ */
+class Shared_cache final {
+ public:
+  Shared_cache(const Shared_cache &) = delete;
+  Shared_cache(Shared_cache &&) = delete;
+
+  Shared_cache &operator=(const Shared_cache &) = delete;
+  Shared_cache &operator=(Shared_cache &&) = delete;
+
+  ~Shared_cache() = default;
+
+  static CURLSH *get() {
+    // intentionally leaked, CURL handles which use it may still exist when
+    // static objects are destroyed
+    static const auto s_cache = new Shared_cache();
+    return s_cache->m_share;
+  }
+
+ private:
+  Shared_cache() : m_share(curl_share_init()) {
+    curl_share_setopt(m_share, CURLSHOPT_LOCKFUNC, &Shared_cache::lock);
+    curl_share_setopt(m_share, CURLSHOPT_UNLOCKFUNC, &Shared_cache::unlock);
+    curl_share_setopt(m_share, CURLSHOPT_USERDATA, this);
+    curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+  }
+
+  static void lock(CURL *, curl_lock_data data, curl_lock_access,
+                   void *user) {
+    static_cast<Shared_cache *>(user)->m_mutexes[data].lock();
+  }
+
+  static void unlock(CURL *, curl_lock_data data, void *user) {
+    static_cast<Shared_cache *>(user)->m_mutexes[data].unlock();
+  }
+
+  CURLSH *m_share;
+  std::mutex m_mutexes[CURL_LOCK_DATA_LAST];
+};
+
+/**
+ * Executes asynchronous transfers of all REST services, using a single CURL
+ * multi handle driven by a background thread. The multi handle keeps a pool of
+ * connections which are reused by subsequent transfers, HTTP/2 transfers to
+ * the same host are multiplexed over a single connection.
+ *
+ * Engine is alive as long as there are REST services which use it.
+ */
+class Async_engine final {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * A single transfer, owned by the engine while it's being executed.
+   */
+  struct Transfer {
+    std::unique_ptr<CURL, void (*)(CURL *)> handle{nullptr, &curl_easy_cleanup};
+    std::unique_ptr<curl_slist, void (*)(curl_slist *)> headers{
+        nullptr, &curl_slist_free_all};
+    std::string header_data;
+    char error_buffer[CURL_ERROR_SIZE];
+
+    /**
+     * Called from the engine thread once transfer is finished. If a delay is
+     * returned, transfer is restarted once it passes, otherwise it's
+     * discarded.
+     */
+    std::function<std::optional<Clock::duration>(Transfer *, CURLcode)>
+        on_finished;
+  };
+
+  Async_engine() : m_multi(curl_multi_init(), &curl_multi_cleanup) {
+#if LIBCURL_VERSION_NUM >= 0x072b00
+    // CURLPIPE_MULTIPLEX was added in libcurl 7.43.0
+    curl_multi_setopt(m_multi.get(), CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+#endif
+
+    m_thread = mysqlsh::spawn_scoped_thread(&Async_engine::run, this);
+  }
+
+  Async_engine(const Async_engine &) = delete;
+  Async_engine(Async_engine &&) = delete;
+
+  Async_engine &operator=(const Async_engine &) = delete;
+  Async_engine &operator=(Async_engine &&) = delete;
+
+  ~Async_engine() {
+    {
+      std::lock_guard lock{m_mutex};
+      m_stop = true;
+    }
+
+    wake_up();
+    m_thread.join();
+
+    for (const auto &transfer : m_active) {
+      curl_multi_remove_handle(m_multi.get(), transfer.first);
+    }
+  }
+
+  static std::shared_ptr<Async_engine> instance() {
+    static std::mutex s_mutex;
+    static std::weak_ptr<Async_engine> s_instance;
+
+    std::lock_guard lock{s_mutex};
+    auto engine = s_instance.lock();
+
+    if (!engine) {
+      engine = std::make_shared<Async_engine>();
+      s_instance = engine;
+    }
+
+    return engine;
+  }
+
+  /**
+   * Schedules the given transfer.
+   *
+   * @param transfer Transfer to be executed.
+   * @param start Transfer is not started before this point in time.
+   */
+  void submit(std::unique_ptr<Transfer> transfer,
+              Clock::time_point start = {}) {
+    {
+      std::lock_guard lock{m_mutex};
+      m_pending.emplace(start, std::move(transfer));
+    }
+
+    wake_up();
+  }
+
+ private:
+#if LIBCURL_VERSION_NUM >= 0x074400
+  // curl_multi_wakeup() was added in libcurl 7.68.0, engine thread can sleep
+  // until there's some work to do
+  static constexpr std::chrono::milliseconds k_max_poll_time{1000};
+#else
+  // engine thread cannot be woken up, it needs to check for new transfers
+  static constexpr std::chrono::milliseconds k_max_poll_time{10};
+#endif
+
+  void wake_up() {
+#if LIBCURL_VERSION_NUM >= 0x074400
+    curl_multi_wakeup(m_multi.get());
+#endif
+  }
+
+  void poll(std::chrono::milliseconds timeout) {
+    const auto ms = static_cast<int>(timeout.count());
+
+#if LIBCURL_VERSION_NUM >= 0x074200
+    // curl_multi_poll() was added in libcurl 7.66.0, it waits for the timeout
+    // even if there are no transfers
+    curl_multi_poll(m_multi.get(), nullptr, 0, ms, nullptr);
+#else
+    if (m_active.empty()) {
+      std::this_thread::sleep_for(timeout);
+    } else {
+      curl_multi_wait(m_multi.get(), nullptr, 0, ms, nullptr);
+    }
+#endif
+  }
+
+  void start_pending() {
+    std::lock_guard lock{m_mutex};
+    const auto now = Clock::now();
+
+    while (!m_pending.empty() && m_pending.begin()->first <= now) {
+      auto transfer = std::move(m_pending.extract(m_pending.begin()).mapped());
+      const auto handle = transfer->handle.get();
+
+      curl_multi_add_handle(m_multi.get(), handle);
+      m_active.emplace(handle, std::move(transfer));
+    }
+  }
+
+  std::chrono::milliseconds poll_time() {
+    std::lock_guard lock{m_mutex};
+    auto timeout = k_max_poll_time;
+
+    if (!m_pending.empty()) {
+      // round up, so that transfer is ready once we wake up
+      timeout = std::min(
+          timeout, std::chrono::ceil<std::chrono::milliseconds>(std::max(
+                       m_pending.begin()->first - Clock::now(),
+                       Clock::duration::zero())));
+    }
+
+    return timeout;
+  }
+
+  void finish_transfers() {
+    int remaining = 0;
+
+    while (const auto msg = curl_multi_info_read(m_multi.get(), &remaining)) {
+      if (CURLMSG_DONE != msg->msg) {
+        continue;
+      }
+
+      // msg is no longer valid once handle is removed
+      const auto handle = msg->easy_handle;
+      const auto result = msg->data.result;
+
+      curl_multi_remove_handle(m_multi.get(), handle);
+
+      auto transfer = std::move(m_active.extract(handle).mapped());
+      std::optional<Clock::duration> delay;
+
+      try {
+        delay = transfer->on_finished(transfer.get(), result);
+      } catch (const std::exception &e) {
+        // engine thread has to keep running
+        log_error("Unexpected exception in an asynchronous transfer: %s",
+                  e.what());
+      }
+
+      if (delay.has_value()) {
+        // reuse the handle, it's already configured
+        submit(std::move(transfer), Clock::now() + *delay);
+      }
+    }
+  }
+
+  void run() {
+    int running = 0;
+
+    while (true) {
+      {
+        std::lock_guard lock{m_mutex};
+
+        if (m_stop) {
+          break;
+        }
+      }
+
+      start_pending();
+
+      curl_multi_perform(m_multi.get(), &running);
+
+      finish_transfers();
+
+      poll(poll_time());
+    }
+  }
+
+  std::unique_ptr<CURLM, CURLMcode (*)(CURLM *)> m_multi;
+
+  std::mutex m_mutex;
+  bool m_stop = false;
+  std::multimap<Clock::time_point, std::unique_ptr<Transfer>> m_pending;
+
+  // accessed only by the engine thread
+  std::unordered_map<CURL *, std::unique_ptr<Transfer>> m_active;
+
+  std::thread m_thread;
+};
+
 }  // namespace
 
 std::string type_name(Type method) {
@@ -242,6 +521,9 @@ class Rest_service::Impl {
     // called
     curl_easy_setopt(m_handle.get(), CURLOPT_ERRORBUFFER, m_error_buffer);
 
+    // DNS cache and TLS sessions are shared with all the other handles
+    curl_easy_setopt(m_handle.get(), CURLOPT_SHARE, Shared_cache::get());
+
     verify_ssl(verify);
 
     // Default timeout for HEAD/DELETE: 30000 milliseconds
@@ -272,7 +554,11 @@ class Rest_service::Impl {
         5, "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz1234567890");
   }
 
-  ~Impl() = default;
+  ~Impl() {
+    // asynchronous requests refer to this object, wait until they are finished
+    std::unique_lock lock{m_async_mutex};
+    m_async_finished.wait(lock, [this]() { return 0 == m_async_pending; });
+  }
 
   void log_request(const Request &request) {
     if (shcore::current_logger()->get_log_level() >=
@@ -313,33 +599,35 @@ class Rest_service::Impl {
 
     log_request(*request);
 
-    set_url(request->full_path().real());
+    const auto handle = m_handle.get();
+
+    set_url(handle, request->full_path().real());
     // body needs to be set before the type, because it implicitly sets type
     // to POST
     if (request->file == nullptr) {
-      set_body(request->body, request->size, synch);
+      set_body(handle, request->body, request->size, synch);
     }
 
-    set_type(request);
+    set_type(handle, request);
 
     const auto headers_deleter =
-        set_headers(request->headers(), request->size != 0);
+        set_headers(handle, request->headers(), request->size != 0);
 
     // set callbacks which will receive the response
     std::string header_data;
-    curl_easy_setopt(m_handle.get(), CURLOPT_HEADERDATA, &header_data);
-    curl_easy_setopt(m_handle.get(), CURLOPT_WRITEDATA,
+    curl_easy_setopt(handle, CURLOPT_HEADERDATA, &header_data);
+    curl_easy_setopt(handle, CURLOPT_WRITEDATA,
                      response ? response->body : nullptr);
 
     // execute the request
-    auto ret_val = curl_easy_perform(m_handle.get());
+    auto ret_val = curl_easy_perform(handle);
     if (ret_val != CURLE_OK) {
       log_error("%s-%d: %s (CURLcode = %i)", m_id.c_str(), m_request_sequence,
                 m_error_buffer, ret_val);
       throw Connection_error{m_error_buffer, ret_val};
     }
 
-    const auto status = get_status_code();
+    const auto status = get_status_code(handle);
 
     log_response(m_request_sequence, status, header_data);
 
@@ -351,13 +639,13 @@ class Rest_service::Impl {
     return status;
   }
 
-  void set_body(const char *body, size_t size, bool synch) {
-    curl_easy_setopt(m_handle.get(), CURLOPT_POSTFIELDSIZE, size);
+  void set_body(CURL *handle, const char *body, size_t size, bool synch) {
+    curl_easy_setopt(handle, CURLOPT_POSTFIELDSIZE, size);
     if (synch) {
-      curl_easy_setopt(m_handle.get(), CURLOPT_COPYPOSTFIELDS, NULL);
-      curl_easy_setopt(m_handle.get(), CURLOPT_POSTFIELDS, body);
+      curl_easy_setopt(handle, CURLOPT_COPYPOSTFIELDS, NULL);
+      curl_easy_setopt(handle, CURLOPT_POSTFIELDS, body);
     } else {
-      curl_easy_setopt(m_handle.get(), CURLOPT_COPYPOSTFIELDS, body);
+      curl_easy_setopt(handle, CURLOPT_COPYPOSTFIELDS, body);
     }
   }
 
@@ -389,6 +677,85 @@ class Rest_service::Impl {
 
   void reset_connection() {
     m_handle.reset(curl_easy_duphandle(m_handle.get()));
+    // share is not copied by curl_easy_duphandle()
+    curl_easy_setopt(m_handle.get(), CURLOPT_SHARE, Shared_cache::get());
+  }
+
+  void execute_async(Request *request, Response *response,
+                     Rest_service::Completion_callback callback) {
+    assert(request);
+
+    if (!m_engine) {
+      m_engine = Async_engine::instance();
+    }
+
+    m_request_sequence++;
+
+    log_request(*request);
+
+    // each transfer needs its own handle, copy all the settings of this service
+    auto transfer = std::make_unique<Async_engine::Transfer>();
+    transfer->handle.reset(curl_easy_duphandle(m_handle.get()));
+
+    const auto handle = transfer->handle.get();
+
+    curl_easy_setopt(handle, CURLOPT_SHARE, Shared_cache::get());
+    curl_easy_setopt(handle, CURLOPT_ERRORBUFFER, transfer->error_buffer);
+
+#if LIBCURL_VERSION_NUM >= 0x072f00
+    // CURL_HTTP_VERSION_2TLS was added in libcurl 7.47.0, if server supports
+    // it, HTTP/2 is used for HTTPS connections, which allows to multiplex them
+    curl_easy_setopt(handle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+#endif
+
+#if LIBCURL_VERSION_NUM >= 0x072b00
+    // CURLOPT_PIPEWAIT was added in libcurl 7.43.0, prefer waiting for a
+    // connection which can be multiplexed over opening a new one
+    curl_easy_setopt(handle, CURLOPT_PIPEWAIT, 1L);
+#endif
+
+    set_url(handle, request->full_path().real());
+    // body needs to be set before the type, because it implicitly sets type
+    // to POST
+    if (request->file == nullptr) {
+      set_body(handle, request->body, request->size, true);
+    }
+
+    set_type(handle, request);
+
+    Async_request async;
+    async.request = request;
+    async.response = response;
+    async.retry_strategy = request->retry_strategy;
+    // headers of the first attempt are computed in the calling thread, retries
+    // obtain them again (i.e. signed ones need a new signature)
+    async.headers = request->headers();
+    async.sequence = m_request_sequence;
+    async.callback = std::move(callback);
+
+    transfer->headers = set_headers(handle, async.headers, request->size != 0);
+
+    // set callbacks which will receive the response
+    curl_easy_setopt(handle, CURLOPT_HEADERDATA, &transfer->header_data);
+    curl_easy_setopt(handle, CURLOPT_WRITEDATA,
+                     response ? response->body : nullptr);
+
+    if (async.retry_strategy) {
+      async.retry_strategy->reset();
+    }
+
+    transfer->on_finished = [this, async = std::move(async)](
+                                Async_engine::Transfer *t,
+                                CURLcode result) mutable {
+      return on_async_finished(&async, t, result);
+    };
+
+    {
+      std::lock_guard lock{m_async_mutex};
+      ++m_async_pending;
+    }
+
+    m_engine->submit(std::move(transfer));
   }
 
  private:
@@ -397,65 +764,63 @@ class Rest_service::Impl {
     curl_easy_setopt(m_handle.get(), CURLOPT_SSL_VERIFYPEER, verify ? 1L : 0L);
   }
 
-  void set_type(Request *request) {
+  void set_type(CURL *handle, Request *request) {
     // custom request overwrites any other option, make sure it's set to
     // default
-    curl_easy_setopt(m_handle.get(), CURLOPT_CUSTOMREQUEST, nullptr);
-    curl_easy_setopt(m_handle.get(), CURLOPT_TIMEOUT_MS, 0);
+    curl_easy_setopt(handle, CURLOPT_CUSTOMREQUEST, nullptr);
+    curl_easy_setopt(handle, CURLOPT_TIMEOUT_MS, 0);
 
     switch (request->type) {
       case Type::GET:
-        curl_easy_setopt(m_handle.get(), CURLOPT_HTTPGET, 1L);
+        curl_easy_setopt(handle, CURLOPT_HTTPGET, 1L);
         break;
 
       case Type::HEAD:
-        curl_easy_setopt(m_handle.get(), CURLOPT_HTTPGET, 1L);
-        curl_easy_setopt(m_handle.get(), CURLOPT_NOBODY, 1L);
-        curl_easy_setopt(m_handle.get(), CURLOPT_TIMEOUT_MS, m_default_timeout);
+        curl_easy_setopt(handle, CURLOPT_HTTPGET, 1L);
+        curl_easy_setopt(handle, CURLOPT_NOBODY, 1L);
+        curl_easy_setopt(handle, CURLOPT_TIMEOUT_MS, m_default_timeout);
         break;
 
       case Type::POST:
-        curl_easy_setopt(m_handle.get(), CURLOPT_NOBODY, 0L);
-        curl_easy_setopt(m_handle.get(), CURLOPT_POST, 1L);
+        curl_easy_setopt(handle, CURLOPT_NOBODY, 0L);
+        curl_easy_setopt(handle, CURLOPT_POST, 1L);
         break;
 
       case Type::PUT:
         if (request->file) {
-          curl_easy_setopt(m_handle.get(), CURLOPT_UPLOAD, 1L);
+          curl_easy_setopt(handle, CURLOPT_UPLOAD, 1L);
           auto size = request->file->file_size();
-          curl_easy_setopt(m_handle.get(), CURLOPT_INFILESIZE_LARGE,
-                           (curl_off_t)size);
-          curl_easy_setopt(m_handle.get(), CURLOPT_READDATA, request->file);
+          curl_easy_setopt(handle, CURLOPT_INFILESIZE_LARGE, (curl_off_t)size);
+          curl_easy_setopt(handle, CURLOPT_READDATA, request->file);
         } else {
-          curl_easy_setopt(m_handle.get(), CURLOPT_NOBODY, 0L);
-          curl_easy_setopt(m_handle.get(), CURLOPT_CUSTOMREQUEST, "PUT");
+          curl_easy_setopt(handle, CURLOPT_NOBODY, 0L);
+          curl_easy_setopt(handle, CURLOPT_CUSTOMREQUEST, "PUT");
         }
         break;
 
       case Type::PATCH:
-        curl_easy_setopt(m_handle.get(), CURLOPT_NOBODY, 0L);
-        curl_easy_setopt(m_handle.get(), CURLOPT_CUSTOMREQUEST, "PATCH");
+        curl_easy_setopt(handle, CURLOPT_NOBODY, 0L);
+        curl_easy_setopt(handle, CURLOPT_CUSTOMREQUEST, "PATCH");
         break;
 
       case Type::DELETE:
-        curl_easy_setopt(m_handle.get(), CURLOPT_NOBODY, 0L);
-        curl_easy_setopt(m_handle.get(), CURLOPT_CUSTOMREQUEST, "DELETE");
-        curl_easy_setopt(m_handle.get(), CURLOPT_TIMEOUT_MS, m_default_timeout);
+        curl_easy_setopt(handle, CURLOPT_NOBODY, 0L);
+        curl_easy_setopt(handle, CURLOPT_CUSTOMREQUEST, "DELETE");
+        curl_easy_setopt(handle, CURLOPT_TIMEOUT_MS, m_default_timeout);
         break;
     }
   }
 
-  void set_url(const std::string &path) {
-    curl_easy_setopt(m_handle.get(), CURLOPT_URL,
-                     (m_base_url.real() + path).c_str());
+  void set_url(CURL *handle, const std::string &path) {
+    curl_easy_setopt(handle, CURLOPT_URL, (m_base_url.real() + path).c_str());
 
     if (m_port.has_value()) {
-      curl_easy_setopt(m_handle.get(), CURLOPT_PORT, *m_port);
+      curl_easy_setopt(handle, CURLOPT_PORT, *m_port);
     }
   }
 
   std::unique_ptr<curl_slist, void (*)(curl_slist *)> set_headers(
-      const Headers &headers, bool has_body) {
+      CURL *handle, const Headers &headers, bool has_body) {
     // create the headers list
     curl_slist *header_list = nullptr;
 
@@ -488,18 +853,130 @@ class Rest_service::Impl {
     }
 
     // set the headers
-    curl_easy_setopt(m_handle.get(), CURLOPT_HTTPHEADER, header_list);
+    curl_easy_setopt(handle, CURLOPT_HTTPHEADER, header_list);
     // automatically delete the headers when leaving the scope
     return std::unique_ptr<curl_slist, void (*)(curl_slist *)>{
         header_list, &curl_slist_free_all};
   }
 
-  Response::Status_code get_status_code() const {
+  Response::Status_code get_status_code(CURL *handle) const {
     long response_code = 0;
-    curl_easy_getinfo(m_handle.get(), CURLINFO_RESPONSE_CODE, &response_code);
+    curl_easy_getinfo(handle, CURLINFO_RESPONSE_CODE, &response_code);
     return static_cast<Response::Status_code>(response_code);
   }
 
+  struct Async_request {
+    Request *request;
+    Response *response;
+    IRetry_strategy *retry_strategy;
+    Headers headers;
+    int sequence;
+    Rest_service::Completion_callback callback;
+  };
+
+  /**
+   * Handles the result of an asynchronous transfer, this is executed by the
+   * engine thread. Follows the same logic as Rest_service::execute().
+   *
+   * @returns delay after which transfer should be retried, nothing if
+   *          transfer is finished
+   */
+  std::optional<Async_engine::Clock::duration> on_async_finished(
+      Async_request *async, Async_engine::Transfer *transfer,
+      CURLcode result) {
+    const auto &base_url = m_base_url.masked();
+    const auto request = async->request;
+    const auto response = async->response;
+    const auto retry_strategy = async->retry_strategy;
+
+    std::optional<std::string> retry;
+    Response::Status_code code{};
+    std::exception_ptr exception;
+
+    try {
+      if (CURLE_OK != result) {
+        log_error("%s-%d: %s (CURLcode = %i)", m_id.c_str(), async->sequence,
+                  transfer->error_buffer, result);
+        throw Connection_error{transfer->error_buffer, result};
+      }
+
+      code = get_status_code(transfer->handle.get());
+
+      log_response(async->sequence, code, transfer->header_data);
+
+      std::optional<Response_error> error;
+
+      if (response) {
+        response->status = code;
+        response->headers = parse_headers(transfer->header_data);
+        error = response->get_error();
+      }
+
+      if (!error.has_value()) {
+        error = Response_error{code};
+      }
+
+      if (retry_strategy && retry_strategy->should_retry(*error)) {
+        retry = shcore::str_format("%d-%s", static_cast<int>(code),
+                                   Response::status_code(code).c_str());
+      } else if (Response::is_error(code)) {
+        // response was an error, log it as well
+        log_failed_request(base_url, *request, async->headers,
+                           format_code(code));
+        if (response) log_failed_response(*response);
+      }
+    } catch (const rest::Connection_error &error) {
+      if (retry_strategy && retry_strategy->should_retry(error)) {
+        retry = error.what();
+      } else {
+        log_failed_request(base_url, *request, async->headers,
+                           format_exception(error));
+        exception = std::current_exception();
+      }
+    } catch (const std::exception &error) {
+      if (retry_strategy && retry_strategy->should_retry(Unknown_error{})) {
+        retry = error.what();
+      } else {
+        log_failed_request(base_url, *request, async->headers,
+                           format_exception(error));
+        if (response) log_failed_response(*response);
+        exception = std::current_exception();
+      }
+    }
+
+    if (retry.has_value()) {
+      transfer->header_data.clear();
+      if (response && response->body) response->body->clear();
+      // this log is to have visibility of the error
+      log_info("RETRYING %s-%d: %s", m_id.c_str(), async->sequence,
+               retry->c_str());
+
+      try {
+        // signature of the previous attempt may no longer be valid
+        async->headers = request->headers();
+        transfer->headers = set_headers(transfer->handle.get(), async->headers,
+                                        request->size != 0);
+        return retry_strategy->next_sleep_time();
+      } catch (const std::exception &error) {
+        log_failed_request(base_url, *request, async->headers,
+                           format_exception(error));
+        exception = std::current_exception();
+      }
+    }
+
+    // this object must not be accessed once the counter is decremented, this
+    // also needs to happen if callback throws
+    const auto finished = shcore::on_leave_scope([this]() {
+      std::lock_guard lock{m_async_mutex};
+      --m_async_pending;
+      m_async_finished.notify_all();
+    });
+
+    async->callback(code, exception);
+
+    return {};
+  }
+
   std::unique_ptr<CURL, void (*)(CURL *)> m_handle;
 
   char m_error_buffer[CURL_ERROR_SIZE];
@@ -515,6 +992,12 @@ class Rest_service::Impl {
   int m_request_sequence;
 
   long m_default_timeout;
+
+  std::shared_ptr<Async_engine> m_engine;
+
+  std::mutex m_async_mutex;
+  std::condition_variable m_async_finished;
+  int m_async_pending = 0;
 };
 
 Rest_service::Rest_service(const Masked_string &base_url, bool verify_ssl,
@@ -577,6 +1060,28 @@ String_response Rest_service::delete_(Request *request) {
   return execute_internal(request);
 }
 
+void Rest_service::execute_async(Request *request, Response *response,
+                                 Completion_callback callback) {
+  m_impl->execute_async(request, response, std::move(callback));
+}
+
+std::future<Response::Status_code> Rest_service::execute_async(
+    Request *request, Response *response) {
+  auto promise = std::make_shared<std::promise<Response::Status_code>>();
+  auto future = promise->get_future();
+
+  execute_async(request, response,
+                [promise](Response::Status_code code, std::exception_ptr e) {
+                  if (e) {
+                    promise->set_exception(e);
+                  } else {
+                    promise->set_value(code);
+                  }
+                });
+
+  return future;
+}
+
 String_response Rest_service::execute_internal(Request *request) {
   String_response response;
 
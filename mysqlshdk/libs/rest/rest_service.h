@@ -26,6 +26,8 @@
 #ifndef MYSQLSHDK_LIBS_REST_REST_SERVICE_H_
 #define MYSQLSHDK_LIBS_REST_REST_SERVICE_H_
 
+#include <exception>
+#include <functional>
 #include <future>
 #include <memory>
 #include <string>
@@ -51,6 +53,16 @@ std::string type_name(Type t);
  */
 class Rest_service {
  public:
+  /**
+   * Called once an asynchronous request is finished. Receives the status code
+   * of the response, or an exception if request has failed.
+   *
+   * Callback is executed by a background thread, must not throw, should not
+   * block and must not use the service which executed the request.
+   */
+  using Completion_callback =
+      std::function<void(Response::Status_code, std::exception_ptr)>;
+
   /**
    * Constructs an object which is going to handle requests to the REST service
    * located at the specified base URL.
@@ -188,6 +200,42 @@ class Rest_service {
    */
   Response::Status_code execute(Request *request, Response *response = nullptr);
 
+  /**
+   * Executes a request asynchronously, returns immediately.
+   *
+   * Asynchronous requests of all services are executed by a single background
+   * thread, which reuses the connections and multiplexes HTTP/2 requests sent
+   * to the same host.
+   *
+   * Request, response and the retry strategy of the request must be valid
+   * until the callback is called, retry strategy cannot be shared with other
+   * requests which are executed at the same time. Request headers are obtained
+   * when this method is called, and again by the background thread before
+   * each retry.
+   *
+   * This service waits for all of its asynchronous requests to finish before
+   * it is destroyed.
+   *
+   * @param request Request to be sent, type needs to be set.
+   * @param response Response received.
+   * @param callback Called once request is finished.
+   */
+  void execute_async(Request *request, Response *response,
+                     Completion_callback callback);
+
+  /**
+   * Executes a request asynchronously, returns immediately.
+   *
+   * @param request Request to be sent, type needs to be set.
+   * @param response Response received.
+   *
+   * @returns The code of the request response, once it's available.
+   *
+   * @see execute_async(Request *, Response *, Completion_callback)
+   */
+  std::future<Response::Status_code> execute_async(
+      Request *request, Response *response = nullptr);
+
  private:
   String_response execute_internal(Request *request);
 
@@ -25,11 +25,15 @@
 
 #include "mysqlshdk/libs/rest/signed_rest_service.h"
 
+#include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
 #include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
 namespace mysqlshdk {
@@ -39,6 +43,8 @@ namespace {
 
 constexpr time_t k_header_cache_ttl = 60;
 
+constexpr int k_authorization_retry_limit = 2;
+
 mysqlshdk::rest::Rest_service *get_rest_service(const std::string &uri,
                                                 const std::string &label) {
   static thread_local std::unordered_map<
@@ -65,12 +71,18 @@ const Headers &Signed_request::headers() const {
     auto self = const_cast<Signed_request *>(this);
     const auto now = time(nullptr);
 
-    if (!m_signed_headers.empty() && !m_service->valid_headers(this, now)) {
-      self->m_signed_headers.clear();
-    }
+    if (m_async) {
+      // asynchronous requests are signed each time they are sent, they can be
+      // signed by a background thread, so they don't use the cache
+      self->m_signed_headers = m_service->make_async_headers(this, now);
+    } else {
+      if (!m_signed_headers.empty() && !m_service->valid_headers(this, now)) {
+        self->m_signed_headers.clear();
+      }
 
-    if (m_signed_headers.empty()) {
-      self->m_signed_headers = m_service->make_headers(this, now);
+      if (m_signed_headers.empty()) {
+        self->m_signed_headers = m_service->make_headers(this, now);
+      }
     }
 
     return m_signed_headers;
@@ -85,7 +97,27 @@ Signed_rest_service::Signed_rest_service(
       m_label{config.service_label()},
       m_signer{config.signer()},
       m_enable_signature_caching(config.signature_caching_enabled()),
-      m_default_retry_strategy(config.retry_strategy()) {}
+      m_retry_strategy_factory(config.retry_strategy_factory()),
+      m_default_retry_strategy(m_retry_strategy_factory()) {}
+
+Signed_rest_service::~Signed_rest_service() {
+  {
+    // asynchronous requests refer to this object, wait until they are finished
+    std::unique_lock lock{m_async_mutex};
+    m_async_finished.wait(lock, [this]() { return 0 == m_async_pending; });
+  }
+
+  {
+    std::lock_guard lock{m_async_retry_mutex};
+    m_async_retry_stop = true;
+  }
+
+  m_async_retry_cv.notify_all();
+
+  if (m_async_retry_thread.joinable()) {
+    m_async_retry_thread.join();
+  }
+}
 
 Response::Status_code Signed_rest_service::get(Signed_request *request,
                                                Response *response) {
@@ -159,6 +191,16 @@ void Signed_rest_service::invalidate_cache() {
   m_cached_header.clear();
   m_signed_header_cache_time.clear();
   m_cache_cleared_at = 0;
+  m_cached_auth_data_version = m_auth_data_version;
+}
+
+bool Signed_rest_service::refresh_auth_data() {
+  if (!m_signer->refresh_auth_data()) {
+    return false;
+  }
+
+  ++m_auth_data_version;
+  return true;
 }
 
 bool Signed_rest_service::valid_headers(const Signed_request *request,
@@ -183,6 +225,13 @@ bool Signed_rest_service::valid_headers(const Signed_request *request,
 
 Headers Signed_rest_service::make_headers(const Signed_request *request,
                                           time_t now) {
+  std::lock_guard lock{m_signer_mutex};
+
+  if (m_cached_auth_data_version != m_auth_data_version) {
+    // authentication data was refreshed by an asynchronous request
+    invalidate_cache();
+  }
+
   clear_cache(now);
 
   const auto &path = request->full_path().real();
@@ -198,7 +247,7 @@ Headers Signed_rest_service::make_headers(const Signed_request *request,
   if (now - cached_time > k_header_cache_ttl || request->size ||
       !m_enable_signature_caching) {
     // make sure the credentials are up to date
-    if (m_signer->auth_data_expired(now) && m_signer->refresh_auth_data()) {
+    if (m_signer->auth_data_expired(now) && refresh_auth_data()) {
       invalidate_cache();
     }
 
@@ -216,6 +265,29 @@ Headers Signed_rest_service::make_headers(const Signed_request *request,
   return final_headers;
 }
 
+Headers Signed_rest_service::make_async_headers(const Signed_request *request,
+                                                time_t now) {
+  Headers headers;
+
+  {
+    std::lock_guard lock{m_signer_mutex};
+
+    // make sure the credentials are up to date
+    if (m_signer->auth_data_expired(now)) {
+      refresh_auth_data();
+    }
+
+    headers = m_signer->sign_request(request, now);
+  }
+
+  // Adds any additional headers
+  for (const auto &header : request->m_headers) {
+    headers[header.first] = header.second;
+  }
+
+  return headers;
+}
+
 Response::Status_code Signed_rest_service::execute(Signed_request *request,
                                                    Response *response) {
   const auto rest = get_rest_service(m_endpoint, m_label);
@@ -239,7 +311,6 @@ Response::Status_code Signed_rest_service::execute(Signed_request *request,
   rest::Response::Status_code code;
   bool retry = false;
   int retries = 0;
-  constexpr int k_authorization_retry_limit = 2;
 
   do {
     code = rest->execute(request, response);
@@ -249,14 +320,18 @@ Response::Status_code Signed_rest_service::execute(Signed_request *request,
 
     if (retry) {
       log_info("Refreshing authentication data");
-      retry = m_signer->refresh_auth_data();
+      std::lock_guard lock{m_signer_mutex};
+      retry = refresh_auth_data();
+
+      if (retry) {
+        // we've refreshed the authorization data, cache is no longer valid
+        invalidate_cache();
+      }
     }
 
     if (retry) {
       log_info("Retrying a request which failed due to an authorization error");
       response->body->clear();
-      // we've refreshed the authorization data, cache is no longer valid
-      invalidate_cache();
     }
   } while (retry);
 
@@ -265,5 +340,195 @@ Response::Status_code Signed_rest_service::execute(Signed_request *request,
   return code;
 }
 
+struct Signed_rest_service::Async_request {
+  Signed_request *request;
+  Response *response;
+  Rest_service::Completion_callback callback;
+  // used if caller did not provide the response handler
+  std::shared_ptr<rest::String_response> string_response;
+  // used if caller did not provide the retry strategy
+  std::shared_ptr<IRetry_strategy> retry_strategy;
+  int authorization_retries = 0;
+};
+
+void Signed_rest_service::execute_async(
+    Signed_request *request, Response *response,
+    Rest_service::Completion_callback callback) {
+  auto async = std::make_shared<Async_request>();
+  async->request = request;
+  async->callback = std::move(callback);
+
+  // same as in execute(), response handler needs to be in place in order to
+  // detect errors, here it has to outlive the request
+  if (!response || !response->body) {
+    async->string_response = std::make_shared<rest::String_response>();
+
+    if (!response) response = async->string_response.get();
+    if (!response->body) response->body = &async->string_response->buffer;
+  }
+
+  async->response = response;
+
+  // retry strategy holds the state of retries, default one cannot be used, as
+  // there could be other requests in progress
+  if (!request->retry_strategy) {
+    async->retry_strategy = m_retry_strategy_factory();
+  }
+
+  request->m_service = this;
+  request->m_async = true;
+
+  {
+    std::lock_guard lock{m_async_mutex};
+    ++m_async_pending;
+  }
+
+  try {
+    submit_async(async);
+  } catch (...) {
+    std::lock_guard lock{m_async_mutex};
+    --m_async_pending;
+    m_async_finished.notify_all();
+    throw;
+  }
+}
+
+void Signed_rest_service::submit_async(
+    const std::shared_ptr<Async_request> &async) {
+  const auto request = async->request;
+
+  if (async->retry_strategy) {
+    request->retry_strategy = async->retry_strategy.get();
+  }
+
+  // strategy is owned by the asynchronous request
+  const auto reset_strategy = shcore::on_leave_scope([&async, request]() {
+    if (async->retry_strategy) {
+      request->retry_strategy = nullptr;
+    }
+  });
+
+  get_rest_service(m_endpoint, m_label)
+      ->execute_async(request, async->response,
+                      [this, async](Response::Status_code code,
+                                    std::exception_ptr e) {
+                        on_async_finished(async, code, std::move(e));
+                      });
+}
+
+void Signed_rest_service::on_async_finished(
+    const std::shared_ptr<Async_request> &async, Response::Status_code code,
+    std::exception_ptr e) {
+  // this is executed by the engine thread, it must not block
+  if (!e && Response::is_error(code) &&
+      m_signer->is_authorization_error(*async->request, *async->response) &&
+      ++async->authorization_retries <= k_authorization_retry_limit) {
+    std::unique_lock lock{m_async_retry_mutex};
+
+    if (!m_async_retry_stop) {
+      if (!m_async_retry_thread.joinable()) {
+        m_async_retry_thread = mysqlsh::spawn_scoped_thread(
+            &Signed_rest_service::run_async_retries, this);
+      }
+
+      m_async_retries.emplace_back(
+          [this, async, code]() { retry_async(async, code); });
+
+      lock.unlock();
+      m_async_retry_cv.notify_one();
+      return;
+    }
+  }
+
+  finish_async(async, code, std::move(e));
+}
+
+void Signed_rest_service::finish_async(
+    const std::shared_ptr<Async_request> &async, Response::Status_code code,
+    std::exception_ptr e) {
+  // this object must not be accessed once the counter is decremented, this
+  // also needs to happen if callback throws
+  const auto finished = shcore::on_leave_scope([this]() {
+    std::lock_guard lock{m_async_mutex};
+    --m_async_pending;
+    m_async_finished.notify_all();
+  });
+
+  if (!e) {
+    try {
+      async->response->throw_if_error();
+    } catch (...) {
+      e = std::current_exception();
+    }
+  }
+
+  async->callback(code, std::move(e));
+}
+
+void Signed_rest_service::retry_async(
+    const std::shared_ptr<Async_request> &async, Response::Status_code code) {
+  bool retry = false;
+
+  {
+    log_info("Refreshing authentication data");
+    std::lock_guard lock{m_signer_mutex};
+    // cached signatures are invalidated once the version changes
+    retry = refresh_auth_data();
+  }
+
+  if (!retry) {
+    finish_async(async, code, {});
+    return;
+  }
+
+  log_info("Retrying a request which failed due to an authorization error");
+  async->response->body->clear();
+
+  try {
+    submit_async(async);
+  } catch (...) {
+    finish_async(async, code, std::current_exception());
+  }
+}
+
+void Signed_rest_service::run_async_retries() {
+  while (true) {
+    std::function<void()> retry;
+
+    {
+      std::unique_lock lock{m_async_retry_mutex};
+      m_async_retry_cv.wait(lock, [this]() {
+        return m_async_retry_stop || !m_async_retries.empty();
+      });
+
+      if (m_async_retries.empty()) {
+        break;
+      }
+
+      retry = std::move(m_async_retries.front());
+      m_async_retries.pop_front();
+    }
+
+    retry();
+  }
+}
+
+std::future<Response::Status_code> Signed_rest_service::execute_async(
+    Signed_request *request, Response *response) {
+  auto promise = std::make_shared<std::promise<Response::Status_code>>();
+  auto future = promise->get_future();
+
+  execute_async(request, response,
+                [promise](Response::Status_code code, std::exception_ptr e) {
+                  if (e) {
+                    promise->set_exception(e);
+                  } else {
+                    promise->set_value(code);
+                  }
+                });
+
+  return future;
+}
+
 }  // namespace rest
 }  // namespace mysqlshdk
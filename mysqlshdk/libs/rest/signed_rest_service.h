@@ -26,10 +26,17 @@
 #ifndef MYSQLSHDK_LIBS_REST_SIGNED_REST_SERVICE_H_
 #define MYSQLSHDK_LIBS_REST_SIGNED_REST_SERVICE_H_
 
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "mysqlshdk/libs/rest/response.h"
 #include "mysqlshdk/libs/rest/rest_service.h"
@@ -50,11 +57,21 @@ struct Signed_request : public rest::Request {
 
   const Headers &unsigned_headers() const { return m_headers; }
 
+  /**
+   * SHA256 hash of the body, if it was computed while the body was created,
+   * signers which need it don't have to compute it again.
+   */
+  std::vector<unsigned char> body_sha256;
+
  private:
   friend class Signed_rest_service;
 
   Signed_rest_service *m_service = nullptr;
 
+  // request is executed asynchronously, it can be signed by a background
+  // thread
+  bool m_async = false;
+
   rest::Headers m_signed_headers;
 };
 
@@ -107,8 +124,21 @@ class Signed_rest_service_config {
 
   virtual bool signature_caching_enabled() const { return true; }
 
-  virtual std::unique_ptr<IRetry_strategy> retry_strategy() const {
-    return rest::default_retry_strategy();
+  using Retry_strategy_factory =
+      std::function<std::unique_ptr<IRetry_strategy>()>;
+
+  /**
+   * Creates retry strategies, requests which are executed at the same time
+   * need separate instances. Returned function must not refer to this object.
+   */
+  virtual Retry_strategy_factory retry_strategy_factory() const {
+    return []() -> std::unique_ptr<IRetry_strategy> {
+      return rest::default_retry_strategy();
+    };
+  }
+
+  std::unique_ptr<IRetry_strategy> retry_strategy() const {
+    return retry_strategy_factory()();
   }
 };
 
@@ -119,12 +149,12 @@ class Signed_rest_service {
   explicit Signed_rest_service(const Signed_rest_service_config &config);
 
   Signed_rest_service(const Signed_rest_service &) = delete;
-  Signed_rest_service(Signed_rest_service &&) = default;
+  Signed_rest_service(Signed_rest_service &&) = delete;
 
   Signed_rest_service &operator=(const Signed_rest_service &) = delete;
-  Signed_rest_service &operator=(Signed_rest_service &&) = default;
+  Signed_rest_service &operator=(Signed_rest_service &&) = delete;
 
-  virtual ~Signed_rest_service() = default;
+  virtual ~Signed_rest_service();
 
   Response::Status_code get(Signed_request *request,
                             Response *response = nullptr);
@@ -140,6 +170,42 @@ class Signed_rest_service {
 
   Response::Status_code delete_(Signed_request *request);
 
+  /**
+   * Executes a request asynchronously, returns immediately.
+   *
+   * Request is signed when this method is called, and again before each
+   * retry. Signatures of asynchronous requests are not cached. If
+   * authorization fails, authentication data is refreshed and request is
+   * retried, same as in case of synchronous requests. This is done by a
+   * separate thread, so that other asynchronous requests are not blocked.
+   *
+   * Request and response must be valid until the callback is called.
+   *
+   * @param request Request to be sent, type needs to be set.
+   * @param response Response received.
+   * @param callback Called once request is finished, receives Response_error
+   *        if response is an error.
+   *
+   * @see Rest_service::execute_async()
+   */
+  void execute_async(Signed_request *request, Response *response,
+                     Rest_service::Completion_callback callback);
+
+  /**
+   * Executes a request asynchronously, returns immediately.
+   *
+   * @param request Request to be sent, type needs to be set.
+   * @param response Response received.
+   *
+   * @returns The code of the request response, once it's available.
+   *
+   * @throws Response_error (via the future) if response is an error.
+   *
+   * @see execute_async(Signed_request *, Response *, Completion_callback)
+   */
+  std::future<Response::Status_code> execute_async(
+      Signed_request *request, Response *response = nullptr);
+
  private:
   friend struct Signed_request;
 
@@ -148,6 +214,26 @@ class Signed_rest_service {
 
   Headers make_headers(const Signed_request *request, time_t now);
 
+  Headers make_async_headers(const Signed_request *request, time_t now);
+
+  struct Async_request;
+
+  void submit_async(const std::shared_ptr<Async_request> &async);
+
+  void on_async_finished(const std::shared_ptr<Async_request> &async,
+                         Response::Status_code code, std::exception_ptr e);
+
+  void finish_async(const std::shared_ptr<Async_request> &async,
+                    Response::Status_code code, std::exception_ptr e);
+
+  void retry_async(const std::shared_ptr<Async_request> &async,
+                   Response::Status_code code);
+
+  void run_async_retries();
+
+  // m_signer_mutex needs to be locked
+  bool refresh_auth_data();
+
   bool valid_headers(const Signed_request *request, time_t now) const;
 
   void clear_cache(time_t now);
@@ -164,8 +250,29 @@ class Signed_rest_service {
   std::string m_endpoint;
   std::string m_label;
   std::unique_ptr<Signer> m_signer;
+  // signer can be used by the background thread which executes asynchronous
+  // requests
+  std::mutex m_signer_mutex;
+  // incremented each time authentication data is refreshed
+  int m_auth_data_version = 0;
+  int m_cached_auth_data_version = 0;
   bool m_enable_signature_caching;
+  Signed_rest_service_config::Retry_strategy_factory m_retry_strategy_factory;
   std::unique_ptr<IRetry_strategy> m_default_retry_strategy;
+
+  // asynchronous requests refer to this object
+  std::mutex m_async_mutex;
+  std::condition_variable m_async_finished;
+  int m_async_pending = 0;
+
+  // asynchronous requests which failed due to an authorization error are
+  // retried by this thread, refreshing the authentication data can take a
+  // while and completion callbacks must not block the engine thread
+  std::thread m_async_retry_thread;
+  std::mutex m_async_retry_mutex;
+  std::condition_variable m_async_retry_cv;
+  std::deque<std::function<void()>> m_async_retries;
+  bool m_async_retry_stop = false;
 };
 
 }  // namespace rest
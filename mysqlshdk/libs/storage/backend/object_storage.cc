@@ -25,7 +25,12 @@
 
 #include "mysqlshdk/libs/storage/backend/object_storage.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <exception>
 #include <iterator>
+#include <utility>
 
 #include "mysqlshdk/libs/rest/error_codes.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
@@ -35,6 +40,15 @@ namespace storage {
 namespace backend {
 namespace object_storage {
 
+namespace {
+
+template <typename T>
+bool is_ready(const std::future<T> &f) {
+  return std::future_status::ready == f.wait_for(std::chrono::seconds::zero());
+}
+
+}  // namespace
+
 Directory::Directory(const Config_ptr &config, const std::string &name)
     : m_name(name),
       m_prefix(m_name.empty() ? "" : m_name + "/"),
@@ -62,7 +76,6 @@ void Directory::create() { m_created = true; }
 
 std::unordered_set<IDirectory::File_info> Directory::list_files(
     bool hidden_files) const {
-  std::unordered_set<IDirectory::File_info> files;
   std::vector<Object_details> objects;
 
   try {
@@ -71,13 +84,71 @@ std::unordered_set<IDirectory::File_info> Directory::list_files(
     throw rest::to_exception(error);
   }
 
-  if (m_prefix.empty()) {
-    for (auto &object : objects) {
-      files.emplace(std::move(object.name), object.size);
+  {
+    std::lock_guard lock{m_listed_objects_mutex};
+
+    m_listed_objects.clear();
+
+    for (const auto &object : objects) {
+      m_listed_objects.emplace(object.name.substr(m_prefix.size()),
+                               object.size);
     }
-  } else {
+  }
+
+  return listed_files(hidden_files);
+}
+
+std::unordered_set<IDirectory::File_info> Directory::list_files_incremental(
+    bool hidden_files) const {
+  std::string last_object;
+
+  {
+    std::lock_guard lock{m_listed_objects_mutex};
+
+    if (!m_listed_objects.empty()) {
+      last_object = m_listed_objects.rbegin()->first;
+    }
+  }
+
+  if (last_object.empty() || !m_container->has_list_objects_start_after()) {
+    return list_files(hidden_files);
+  }
+
+  std::vector<Object_details> objects;
+
+  try {
+    // objects are listed in lexicographical order, fetch only the ones which
+    // follow the last object we know about
+    objects = m_container->list_objects(m_prefix, 0, false,
+                                        Object_details::NAME_SIZE, nullptr,
+                                        m_prefix + last_object);
+  } catch (const rest::Response_error &error) {
+    throw rest::to_exception(error);
+  }
+
+  {
+    std::lock_guard lock{m_listed_objects_mutex};
+
     for (const auto &object : objects) {
-      files.emplace(object.name.substr(m_prefix.size()), object.size);
+      m_listed_objects.emplace(object.name.substr(m_prefix.size()),
+                               object.size);
+    }
+  }
+
+  return listed_files(hidden_files);
+}
+
+std::unordered_set<IDirectory::File_info> Directory::listed_files(
+    bool hidden_files) const {
+  std::unordered_set<IDirectory::File_info> files;
+
+  {
+    std::lock_guard lock{m_listed_objects_mutex};
+
+    files.reserve(m_listed_objects.size());
+
+    for (const auto &object : m_listed_objects) {
+      files.emplace(object.first, object.second);
     }
   }
 
@@ -156,8 +227,17 @@ std::string Directory::join_path(const std::string &a,
 
 std::unique_ptr<IFile> Directory::file(const std::string &name,
                                        const File_options &) const {
-  return std::make_unique<Object>(m_container->config(), name,
-                                  join_path(m_name, ""));
+  auto object = std::make_unique<Object>(m_container->config(), name,
+                                         join_path(m_name, ""));
+
+  std::lock_guard lock{m_listed_objects_mutex};
+
+  if (const auto it = m_listed_objects.find(name);
+      m_listed_objects.end() != it) {
+    object->set_known_size(it->second);
+  }
+
+  return object;
 }
 
 Object::Object(const Config_ptr &config, const std::string &name,
@@ -166,15 +246,34 @@ Object::Object(const Config_ptr &config, const std::string &name,
       m_prefix(prefix),
       m_container(config->container()),
       m_max_part_size(config->part_size()),
+      m_max_parts_in_flight(config->max_parts_in_flight()),
       m_writer{},
       m_reader{} {}
 
+Object::~Object() {
+  // pending asynchronous requests refer to the container, handlers wait for
+  // them to finish, this needs to happen before the container is destroyed
+  m_writer.reset();
+  m_reader.reset();
+}
+
 void Object::set_max_part_size(size_t new_size) {
   assert(!is_open());
   m_max_part_size = new_size;
 }
 
+void Object::set_max_parts_in_flight(size_t parts) {
+  assert(!is_open());
+  assert(parts > 0);
+  m_max_parts_in_flight = parts;
+}
+
 void Object::open(storage::Mode mode) {
+  if (Mode::READ != mode) {
+    // object is going to be modified
+    m_known_size.reset();
+  }
+
   switch (mode) {
     case Mode::READ:
       m_reader = std::make_unique<Reader>(this);
@@ -222,10 +321,27 @@ void Object::open(storage::Mode mode) {
   m_open_mode = mode;
 }
 
+Object::Read_ahead_stats Object::read_ahead_stats() const {
+  auto stats = m_read_ahead_stats;
+
+  if (m_reader) {
+    stats.hits += m_reader->stats().hits;
+    stats.misses += m_reader->stats().misses;
+  }
+
+  return stats;
+}
+
 bool Object::is_open() const { return m_open_mode.has_value(); }
 
 void Object::close() {
   if (m_writer) m_writer->close();
+
+  if (m_reader) {
+    m_read_ahead_stats.hits += m_reader->stats().hits;
+    m_read_ahead_stats.misses += m_reader->stats().misses;
+  }
+
   m_open_mode.reset();
   m_writer.reset();
   m_reader.reset();
@@ -236,6 +352,8 @@ size_t Object::file_size() const {
     return m_reader->size();
   } else if (m_writer) {
     return m_writer->size();
+  } else if (m_known_size.has_value()) {
+    return *m_known_size;
   } else {
     return m_container->head_object(full_path().real());
   }
@@ -322,6 +440,11 @@ void Object::remove() { m_container->delete_object(full_path().real()); }
 
 Object::Writer::Writer(Object *owner, Multipart_object *object)
     : File_handler(owner), m_is_multipart(false) {
+  if (m_object->m_container->uses_body_sha256()) {
+    // hash the data as it's written, instead of when it's being uploaded
+    m_buffer_sha256.emplace();
+  }
+
   // This is the writer for an already started multipart object
   if (object) {
     m_multipart = *object;
@@ -337,6 +460,8 @@ Object::Writer::Writer(Object *owner, Multipart_object *object)
     for (const auto &part : m_parts) {
       m_size += part.size;
     }
+
+    m_next_part_num = m_parts.size() + 1;
   }
 }
 
@@ -345,6 +470,9 @@ Object::Writer::~Writer() {
   // started, but close() was not called before writer has been destroyed),
   // attempt to cancel it
   abort_multipart_upload("unexpected inner state");
+  // uploads are cancelled by the call above if multipart upload was in
+  // progress, make sure they are not running in any case
+  cancel_uploads();
 }
 
 off64_t Object::Writer::seek(off64_t /*offset*/) { return 0; }
@@ -373,52 +501,149 @@ ssize_t Object::Writer::write(const void *buffer, size_t length) {
   // This loops handles the upload of N number of chunks of size
   // MY_MAX_PART_SIZE including the buffered data and the incoming data
   while (to_send > MY_MAX_PART_SIZE) {
-    const char *part = nullptr;
-
-    if (!m_buffer.empty()) {
-      // BUFFERED DATA: fills the buffer and sends it
+    if (!m_buffer.empty() || is_async()) {
+      // BUFFERED DATA: fills the buffer and sends it, asynchronous uploads
+      // always need to go through the buffer, as incoming data is not owned
       const auto buffer_space = MY_MAX_PART_SIZE - m_buffer.size();
-      m_buffer.append(incoming + incoming_offset, buffer_space);
-
-      part = m_buffer.data();
+      append_to_buffer(incoming + incoming_offset, buffer_space);
       incoming_offset += buffer_space;
+
+      if (is_async()) {
+        queue_buffer();
+      } else {
+        upload_part(m_buffer.data(), MY_MAX_PART_SIZE, buffer_sha256());
+        m_buffer.clear();
+      }
     } else {
       // NO BUFFERED DATA: sends the data directly from the incoming buffer
-      part = incoming + incoming_offset;
+      upload_part(incoming + incoming_offset, MY_MAX_PART_SIZE);
       incoming_offset += MY_MAX_PART_SIZE;
     }
 
-    try {
-      m_parts.push_back(m_object->m_container->upload_part(
-          m_multipart, m_parts.size() + 1, part, MY_MAX_PART_SIZE));
-    } catch (const rest::Response_error &error) {
-      abort_multipart_upload("failure uploading part", error.format());
-      throw rest::to_exception(error);
-    }
-
-    m_buffer.clear();
     to_send -= MY_MAX_PART_SIZE;
   }
 
   // REMAINING DATA: gets buffered again
   const auto remaining_input = length - incoming_offset;
   if (remaining_input)
-    m_buffer.append(incoming + incoming_offset, remaining_input);
+    append_to_buffer(incoming + incoming_offset, remaining_input);
 
   m_size += length;
 
   return length;
 }
 
+void Object::Writer::upload_part(const char *data, std::size_t size,
+                                  std::vector<unsigned char> sha256) {
+  try {
+    m_parts.push_back(m_object->m_container->upload_part(
+        m_multipart, m_next_part_num++, data, size, std::move(sha256)));
+  } catch (const rest::Response_error &error) {
+    abort_multipart_upload("failure uploading part", error.format());
+    throw rest::to_exception(error);
+  }
+}
+
+void Object::Writer::append_to_buffer(const char *data, std::size_t size) {
+  m_buffer.append(data, size);
+
+  if (m_buffer_sha256) {
+    m_buffer_sha256->update(data, size);
+  }
+}
+
+std::vector<unsigned char> Object::Writer::buffer_sha256() {
+  return m_buffer_sha256 ? m_buffer_sha256->finish()
+                         : std::vector<unsigned char>{};
+}
+
+void Object::Writer::queue_buffer() {
+  assert(is_async());
+
+  // bounds the memory: wait until there's a free slot
+  while (m_parts_in_flight.size() >= m_object->m_max_parts_in_flight) {
+    finish_upload();
+  }
+
+  auto &part = m_parts_in_flight.emplace_back();
+  part.data = std::move(m_buffer);
+
+  m_buffer = {};
+  m_buffer.reserve(m_object->m_max_part_size);
+
+  try {
+    part.uploaded = m_object->m_container->upload_part_async(
+        m_multipart, m_next_part_num++, part.data.data(), part.data.size(),
+        buffer_sha256());
+  } catch (const std::exception &e) {
+    // upload was not started
+    m_parts_in_flight.pop_back();
+    abort_multipart_upload("failure uploading part", e.what());
+    throw;
+  }
+}
+
+void Object::Writer::finish_upload() {
+  assert(!m_parts_in_flight.empty());
+
+  // data has to be valid (and must not be moved) until upload is finished
+  m_parts_in_flight.front().uploaded.wait();
+
+  auto part = std::move(m_parts_in_flight.front());
+  m_parts_in_flight.pop_front();
+
+  try {
+    m_parts.emplace_back(part.uploaded.get());
+  } catch (const rest::Response_error &e) {
+    abort_multipart_upload("failure uploading part", e.format());
+    throw rest::to_exception(e);
+  } catch (const rest::Connection_error &e) {
+    abort_multipart_upload("failure uploading part", e.what());
+    throw shcore::Exception::runtime_error(e.what());
+  } catch (const std::exception &e) {
+    abort_multipart_upload("failure uploading part", e.what());
+    throw;
+  }
+}
+
+void Object::Writer::wait_for_uploads() {
+  while (!m_parts_in_flight.empty()) {
+    finish_upload();
+  }
+}
+
+void Object::Writer::cancel_uploads() {
+  // data has to be valid until uploads are finished
+  for (const auto &part : m_parts_in_flight) {
+    part.uploaded.wait();
+  }
+
+  m_parts_in_flight.clear();
+}
+
 void Object::Writer::close() {
   if (m_is_multipart) {
     // MULTIPART UPLOAD STARTED: Sends last part if any and commits the upload
     try {
       if (!m_buffer.empty()) {
-        m_parts.push_back(m_object->m_container->upload_part(
-            m_multipart, m_parts.size() + 1, m_buffer.data(), m_buffer.size()));
+        if (is_async()) {
+          queue_buffer();
+        } else {
+          m_parts.push_back(m_object->m_container->upload_part(
+              m_multipart, m_next_part_num++, m_buffer.data(),
+              m_buffer.size(), buffer_sha256()));
+        }
       }
 
+      wait_for_uploads();
+
+      // parts uploaded concurrently may have completed out of order
+      std::sort(m_parts.begin(), m_parts.end(),
+                [](const Multipart_object_part &l,
+                   const Multipart_object_part &r) {
+                  return l.part_num < r.part_num;
+                });
+
       m_object->m_container->commit_multipart_upload(m_multipart, m_parts);
     } catch (const rest::Response_error &error) {
       abort_multipart_upload("failure completing the upload", error.format());
@@ -432,7 +657,8 @@ void Object::Writer::close() {
     try {
       if (!m_buffer.empty()) {
         m_object->m_container->put_object(m_object->full_path().real(),
-                                          m_buffer.data(), m_buffer.size());
+                                          m_buffer.data(), m_buffer.size(),
+                                          buffer_sha256());
       }
     } catch (const rest::Response_error &error) {
       throw rest::to_exception(error);
@@ -448,7 +674,13 @@ void Object::Writer::reset() {
   // clean up
   m_is_multipart = false;
   m_buffer.clear();
+
+  if (m_buffer_sha256) {
+    m_buffer_sha256.emplace();
+  }
+
   m_parts.clear();
+  m_next_part_num = 1;
 }
 
 void Object::Writer::abort_multipart_upload(const char *context,
@@ -466,6 +698,9 @@ void Object::Writer::abort_multipart_upload(const char *context,
         context, maybe_error.c_str(), m_multipart.name.c_str(),
         m_multipart.upload_id.c_str());
 
+    // no more parts can be uploaded once the upload is aborted
+    cancel_uploads();
+
     // call reset() before aborting the upload, if abort throws it's not going
     // to be attempted again
     reset();
@@ -482,7 +717,16 @@ void Object::Writer::abort_multipart_upload(const char *context,
   }
 }
 
-Object::Reader::Reader(Object *owner) : File_handler(owner), m_offset(0) {
+Object::Reader::Reader(Object *owner)
+    : File_handler(owner),
+      m_offset(0),
+      m_block_size(owner->m_container->config()->read_ahead_block_size()),
+      m_max_blocks(owner->m_container->config()->read_ahead_blocks()) {
+  if (m_object->m_known_size.has_value()) {
+    m_size = *m_object->m_known_size;
+    return;
+  }
+
   try {
     m_size = m_object->m_container->head_object(m_object->full_path().real());
   } catch (const rest::Response_error &error) {
@@ -501,6 +745,16 @@ Object::Reader::Reader(Object *owner) : File_handler(owner), m_offset(0) {
   }
 }
 
+Object::Reader::~Reader() {
+  cancel_fetches();
+
+  if (is_read_ahead() && (m_stats.hits || m_stats.misses)) {
+    log_debug("Read-ahead of object '%s': %zu hit(s), %zu miss(es)",
+              m_object->full_path().masked().c_str(), m_stats.hits,
+              m_stats.misses);
+  }
+}
+
 off64_t Object::Reader::seek(off64_t offset) {
   const off64_t fsize = m_size;
   m_offset = std::min(offset, fsize);
@@ -512,6 +766,10 @@ off64_t Object::Reader::tell() const {
 }
 
 ssize_t Object::Reader::read(void *buffer, size_t length) {
+  if (is_read_ahead()) {
+    return read_ahead(buffer, length);
+  }
+
   const size_t first = m_offset;
   const size_t last_unbounded = m_offset + length - 1;
   const off64_t fsize = m_size;
@@ -537,6 +795,148 @@ ssize_t Object::Reader::read(void *buffer, size_t length) {
   return read;
 }
 
+ssize_t Object::Reader::read_ahead(void *buffer, size_t length) {
+  const off64_t fsize = m_size;
+  auto out = static_cast<char *>(buffer);
+  ssize_t read = 0;
+  bool hit = true;
+
+  while (length > 0 && m_offset < fsize) {
+    // drop the blocks which do not hold data at the current position, this
+    // also handles the case when seek() has moved the position
+    while (!m_blocks.empty() &&
+           (m_blocks.front()->offset > m_offset ||
+            m_blocks.front()->offset +
+                    static_cast<off64_t>(m_blocks.front()->size) <=
+                m_offset)) {
+      discard_front_block();
+    }
+
+    if (m_blocks.empty()) {
+      m_next_block_offset = m_offset;
+    }
+
+    schedule_blocks();
+
+    auto &block = *m_blocks.front();
+
+    if (block.fetched.valid()) {
+      if (!is_ready(block.fetched)) {
+        hit = false;
+      }
+
+      std::exception_ptr error;
+
+      try {
+        const auto fetched = block.fetched.get();
+
+        if (fetched != block.size) {
+          throw std::runtime_error(shcore::str_format(
+              "Failed to read object '%s', expected %zu bytes at offset %zu, "
+              "got: %zu",
+              m_object->full_path().masked().c_str(), block.size,
+              static_cast<std::size_t>(block.offset), fetched));
+        }
+      } catch (...) {
+        error = std::current_exception();
+      }
+
+      if (error) {
+        // block is not usable, fetch it again on the next read
+        m_blocks.pop_front();
+
+        try {
+          std::rethrow_exception(error);
+        } catch (const rest::Response_error &e) {
+          throw rest::to_exception(e);
+        } catch (const rest::Connection_error &e) {
+          throw shcore::Exception::runtime_error(e.what());
+        }
+      }
+    }
+
+    const auto block_offset = static_cast<std::size_t>(m_offset - block.offset);
+    const auto bytes = std::min(length, block.size - block_offset);
+
+    ::memcpy(out, block.data.data() + block_offset, bytes);
+
+    out += bytes;
+    length -= bytes;
+    read += bytes;
+    m_offset += bytes;
+  }
+
+  if (read > 0) {
+    if (hit) {
+      ++m_stats.hits;
+    } else {
+      ++m_stats.misses;
+    }
+  }
+
+  return read;
+}
+
+void Object::Reader::schedule_blocks() {
+  const off64_t fsize = m_size;
+
+  // release the discarded blocks which were fetched in the meantime
+  std::erase_if(m_cancelled_blocks,
+                [](const auto &block) { return is_ready(block->fetched); });
+
+  if (m_blocks.empty()) {
+    // at least one block is needed to continue, wait until discarded blocks
+    // make room for it
+    while (m_cancelled_blocks.size() >= m_max_blocks) {
+      m_cancelled_blocks.front()->fetched.wait();
+      m_cancelled_blocks.pop_front();
+    }
+  }
+
+  while (m_blocks.size() + m_cancelled_blocks.size() < m_max_blocks &&
+         m_next_block_offset < fsize) {
+    auto block = std::make_unique<Block>();
+    block->offset = m_next_block_offset;
+    block->size = std::min<std::size_t>(m_block_size,
+                                        m_size - m_next_block_offset);
+    block->data.resize(block->size);
+    block->buffer = std::make_unique<rest::Static_char_ref_buffer>(
+        block->data.data(), block->size);
+
+    const auto first = static_cast<std::size_t>(block->offset);
+    block->fetched = m_object->m_container->get_object_async(
+        m_object->full_path().real(), block->buffer.get(), first,
+        first + block->size - 1);
+
+    m_next_block_offset += block->size;
+    m_blocks.emplace_back(std::move(block));
+  }
+}
+
+void Object::Reader::discard_front_block() {
+  auto block = std::move(m_blocks.front());
+  m_blocks.pop_front();
+
+  // if block is still being fetched, it's going to be released once it's
+  // done, until then it's counted as being in memory
+  if (block->fetched.valid() && !is_ready(block->fetched)) {
+    m_cancelled_blocks.emplace_back(std::move(block));
+  }
+}
+
+void Object::Reader::cancel_fetches() {
+  while (!m_blocks.empty()) {
+    discard_front_block();
+  }
+
+  // buffers have to be valid until blocks are fetched
+  for (const auto &block : m_cancelled_blocks) {
+    block->fetched.wait();
+  }
+
+  m_cancelled_blocks.clear();
+}
+
 }  // namespace object_storage
 }  // namespace backend
 }  // namespace storage
@@ -26,9 +26,17 @@
 #ifndef MYSQLSHDK_LIBS_STORAGE_BACKEND_OBJECT_STORAGE_H_
 #define MYSQLSHDK_LIBS_STORAGE_BACKEND_OBJECT_STORAGE_H_
 
+#include <deque>
+#include <future>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <vector>
+
+#include "mysqlshdk/libs/rest/response.h"
+#include "mysqlshdk/libs/utils/ssl_keygen.h"
 
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/storage/ifile.h"
@@ -99,12 +107,22 @@ class Directory : public mysqlshdk::storage::IDirectory {
   std::unordered_set<File_info> list_files(
       bool hidden_files = false) const override;
 
+  /**
+   * Lists only the objects which follow the last object listed so far, if
+   * container supports it. Previously listed objects are reported as well.
+   */
+  std::unordered_set<File_info> list_files_incremental(
+      bool hidden_files = false) const override;
+
   std::unordered_set<File_info> filter_files(
       const std::string &pattern) const override;
 
   /**
    * Creates a new file handle for for a file contained on this directory.
    *
+   * If file was found by one of the listings, its size is known and it's not
+   * going to be fetched again when file is opened for reading.
+   *
    * @param name: The name of the file.
    * @param options File backend specific options.
    */
@@ -125,6 +143,14 @@ class Directory : public mysqlshdk::storage::IDirectory {
 
  private:
   std::unordered_set<IDirectory::File_info> list_multipart_uploads() const;
+
+  std::unordered_set<IDirectory::File_info> listed_files(
+      bool hidden_files) const;
+
+  // names (without the prefix) and sizes of objects found by the listings,
+  // sorted by name, listings and file() can be called from different threads
+  mutable std::map<std::string, std::size_t> m_listed_objects;
+  mutable std::mutex m_listed_objects_mutex;
 };
 
 /**
@@ -148,7 +174,7 @@ class Object : public mysqlshdk::storage::IFile {
 
   Object &operator=(const Object &other) = delete;
   Object &operator=(Object &&other) = delete;
-  virtual ~Object() = default;
+  virtual ~Object();
 
   /**
    * Opens the object for data operations:
@@ -268,12 +294,46 @@ class Object : public mysqlshdk::storage::IFile {
    */
   void set_max_part_size(size_t new_size);
 
+  /**
+   * Use this function to customize the number of parts which are uploaded
+   * concurrently during a multipart upload.
+   *
+   * The default value is taken from the configuration of the bucket.
+   */
+  void set_max_parts_in_flight(size_t parts);
+
+  /**
+   * Sets the size of an existing object, i.e. obtained when listing the
+   * objects, so that it does not have to be fetched when object is opened for
+   * reading. Size is discarded if object is opened for writing.
+   */
+  void set_known_size(size_t size) { m_known_size = size; }
+
+  /**
+   * Statistics of the read-ahead mode.
+   */
+  struct Read_ahead_stats {
+    /// Number of read() calls which were served using already fetched data.
+    std::size_t hits = 0;
+    /// Number of read() calls which had to wait for the data to be fetched.
+    std::size_t misses = 0;
+  };
+
+  /**
+   * Provides the read-ahead statistics, accumulated since this handle was
+   * created.
+   */
+  Read_ahead_stats read_ahead_stats() const;
+
  protected:
   std::string m_name;
   std::string m_prefix;
   std::unique_ptr<Container> m_container;
   std::optional<Mode> m_open_mode;
   size_t m_max_part_size;
+  size_t m_max_parts_in_flight;
+  Read_ahead_stats m_read_ahead_stats;
+  std::optional<size_t> m_known_size;
 
   /**
    * Base class for the Read and Write Object handlers
@@ -303,15 +363,66 @@ class Object : public mysqlshdk::storage::IFile {
     void close();
 
    private:
+    struct Part {
+      std::string data;
+      std::future<Multipart_object_part> uploaded;
+    };
+
     void reset();
 
     void abort_multipart_upload(const char *context,
                                 const std::string &error = {});
 
+    /**
+     * Uploads the given part synchronously.
+     */
+    void upload_part(const char *data, std::size_t size,
+                     std::vector<unsigned char> sha256 = {});
+
+    /**
+     * Appends data to the internal buffer, updating its hash if needed.
+     */
+    void append_to_buffer(const char *data, std::size_t size);
+
+    /**
+     * Provides the hash of the internal buffer (if container uses it), and
+     * starts a new one.
+     */
+    std::vector<unsigned char> buffer_sha256();
+
+    /**
+     * Starts an asynchronous upload of the contents of the internal buffer,
+     * waits for the oldest upload to finish if the maximum number of parts is
+     * already in flight.
+     */
+    void queue_buffer();
+
+    /**
+     * Waits for the oldest part in flight to be uploaded.
+     */
+    void finish_upload();
+
+    void wait_for_uploads();
+
+    /**
+     * Waits for all the parts in flight, ignoring the results.
+     */
+    void cancel_uploads();
+
+    bool is_async() const {
+      return m_is_multipart && m_object->m_max_parts_in_flight > 1;
+    }
+
     std::string m_buffer;
+    // hash of m_buffer, computed as the data is written
+    std::optional<shcore::ssl::Sha256> m_buffer_sha256;
     bool m_is_multipart;
     Multipart_object m_multipart;
     std::vector<Multipart_object_part> m_parts;
+    std::size_t m_next_part_num = 1;
+
+    // asynchronous uploads, in the order they were started
+    std::deque<Part> m_parts_in_flight;
   };
 
   /**
@@ -320,14 +431,53 @@ class Object : public mysqlshdk::storage::IFile {
   class Reader : public File_handler {
    public:
     explicit Reader(Object *owner);
-    ~Reader() override = default;
+    ~Reader() override;
 
     off64_t seek(off64_t offset);
     off64_t tell() const;
     ssize_t read(void *buffer, size_t length);
 
+    const Read_ahead_stats &stats() const { return m_stats; }
+
    private:
+    struct Block {
+      off64_t offset = 0;
+      std::string data;
+      std::size_t size = 0;
+      std::unique_ptr<rest::Static_char_ref_buffer> buffer;
+      // number of fetched bytes, invalid once the result was obtained
+      std::future<std::size_t> fetched;
+    };
+
+    bool is_read_ahead() const { return m_block_size > 0; }
+
+    ssize_t read_ahead(void *buffer, size_t length);
+
+    /**
+     * Schedules new blocks, until there's the maximum number of them in
+     * memory (including the discarded ones which are still being fetched), or
+     * the end of the object is reached. Always schedules at least one block if
+     * the queue is empty.
+     */
+    void schedule_blocks();
+
+    void discard_front_block();
+
+    /**
+     * Waits for all the blocks which are still being fetched.
+     */
+    void cancel_fetches();
+
     off64_t m_offset;
+
+    // read-ahead
+    std::size_t m_block_size;
+    std::size_t m_max_blocks;
+    off64_t m_next_block_offset = 0;
+    std::deque<std::unique_ptr<Block>> m_blocks;
+    // discarded blocks which are still being fetched
+    std::deque<std::unique_ptr<Block>> m_cancelled_blocks;
+    Read_ahead_stats m_stats;
   };
 
   std::unique_ptr<Writer> m_writer;
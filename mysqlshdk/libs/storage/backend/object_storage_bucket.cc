@@ -25,6 +25,8 @@
 
 #include "mysqlshdk/libs/storage/backend/object_storage_bucket.h"
 
+#include <exception>
+#include <future>
 #include <memory>
 #include <unordered_map>
 #include <utility>
@@ -52,6 +54,23 @@ FI_DEFINE(os_bucket, ([](const mysqlshdk::utils::FI::Args &args) {
                 args.get_string("msg"));
           }));
 
+Response_error get_object_error(const Response_error &error,
+                                const std::string &object_name,
+                                const std::string &range) {
+  return Response_error(error.status_code(),
+                        "Failed to get object '" + object_name + "'" +
+                            (range.empty() ? "" : " [" + range + "]") + ": " +
+                            error.what());
+}
+
+Response_error upload_part_error(const Response_error &error, size_t part_num,
+                                 const std::string &object_name) {
+  return Response_error(
+      error.status_code(),
+      shcore::str_format("Failed to upload part %zu for object '%s': %s",
+                         part_num, object_name.c_str(), error.what()));
+}
+
 }  // namespace
 
 Container::Container(const Config_ptr &config) : m_config(config) {
@@ -61,7 +80,10 @@ Container::Container(const Config_ptr &config) : m_config(config) {
 std::vector<Object_details> Container::list_objects(
     const std::string &prefix, size_t limit, bool recursive,
     const Object_details::Fields_mask &fields,
-    std::unordered_set<std::string> *out_prefixes) {
+    std::unordered_set<std::string> *out_prefixes,
+    const std::string &start_after) {
+  assert(start_after.empty() || has_list_objects_start_after());
+
   bool done = false;
   std::vector<Object_details> result;
   std::string next_start;
@@ -73,7 +95,7 @@ std::vector<Object_details> Container::list_objects(
     // limit request
     auto request = list_objects_request(
         prefix, remaining < MAX_LIST_OBJECTS_LIMIT ? remaining : 0, recursive,
-        fields, next_start);
+        fields, next_start, start_after);
     rest::String_response response;
 
     try {
@@ -153,12 +175,14 @@ void Container::rename_object(const std::string &src_name,
 }
 
 void Container::put_object(const std::string &object_name, const char *data,
-                           size_t size) {
+                           size_t size,
+                           std::vector<unsigned char> body_sha256) {
   Headers headers{{"content-type", "application/octet-stream"}};
 
   auto request = put_object_request(object_name, std::move(headers));
   request.body = data;
   request.size = size;
+  request.body_sha256 = std::move(body_sha256);
 
   try {
     FI_TRIGGER_TRAP(os_bucket,
@@ -173,24 +197,31 @@ void Container::put_object(const std::string &object_name, const char *data,
   }
 }
 
-size_t Container::get_object(const std::string &object_name,
-                             mysqlshdk::rest::Base_response_buffer *buffer,
-                             const std::optional<size_t> &from_byte,
-                             const std::optional<size_t> &to_byte) {
+rest::Signed_request Container::ranged_get_object_request(
+    const std::string &object_name, const std::optional<size_t> &from_byte,
+    const std::optional<size_t> &to_byte, std::string *range) {
   Headers headers;
-  std::string range;
 
   if (from_byte.has_value() || to_byte.has_value()) {
     validate_range(from_byte, to_byte);
 
-    range = shcore::str_format(
+    *range = shcore::str_format(
         "bytes=%s-%s",
         (from_byte.has_value() ? std::to_string(*from_byte).c_str() : ""),
         (to_byte.has_value() ? std::to_string(*to_byte).c_str() : ""));
-    headers["range"] = range;
+    headers["range"] = *range;
   }
 
-  auto request = get_object_request(object_name, std::move(headers));
+  return get_object_request(object_name, std::move(headers));
+}
+
+size_t Container::get_object(const std::string &object_name,
+                             mysqlshdk::rest::Base_response_buffer *buffer,
+                             const std::optional<size_t> &from_byte,
+                             const std::optional<size_t> &to_byte) {
+  std::string range;
+  auto request =
+      ranged_get_object_request(object_name, from_byte, to_byte, &range);
   Response response;
   response.body = buffer;
 
@@ -201,15 +232,58 @@ size_t Container::get_object(const std::string &object_name,
 
     ensure_connection()->get(&request, &response);
   } catch (const Response_error &error) {
-    throw Response_error(error.status_code(),
-                         "Failed to get object '" + object_name + "'" +
-                             (range.empty() ? "" : " [" + range + "]") + ": " +
-                             error.what());
+    throw get_object_error(error, object_name, range);
   }
 
   return buffer->size();
 }
 
+std::future<size_t> Container::get_object_async(
+    const std::string &object_name,
+    mysqlshdk::rest::Base_response_buffer *buffer, size_t from_byte,
+    size_t to_byte) {
+  struct Context {
+    rest::Signed_request request;
+    Response response;
+    std::promise<size_t> result;
+  };
+
+  std::string range;
+  const auto context = std::make_shared<Context>(Context{
+      ranged_get_object_request(object_name, from_byte, to_byte, &range)});
+  auto result = context->result.get_future();
+
+  context->request.type = rest::Type::GET;
+  context->response.body = buffer;
+
+  try {
+    FI_TRIGGER_TRAP(os_bucket,
+                    mysqlshdk::utils::FI::Trigger_options(
+                        {{"op", "get_object"}, {"name", object_name}}));
+  } catch (const Response_error &error) {
+    context->result.set_exception(
+        std::make_exception_ptr(get_object_error(error, object_name, range)));
+    return result;
+  }
+
+  ensure_connection()->execute_async(
+      &context->request, &context->response,
+      [context, object_name, range](Response::Status_code,
+                                    std::exception_ptr e) {
+        try {
+          if (e) std::rethrow_exception(e);
+          context->result.set_value(context->response.body->size());
+        } catch (const Response_error &error) {
+          context->result.set_exception(std::make_exception_ptr(
+              get_object_error(error, object_name, range)));
+        } catch (...) {
+          context->result.set_exception(std::current_exception());
+        }
+      });
+
+  return result;
+}
+
 size_t Container::get_object(const std::string &object_name,
                              mysqlshdk::rest::Base_response_buffer *buffer,
                              size_t from_byte, size_t to_byte) {
@@ -332,26 +406,62 @@ Multipart_object Container::create_multipart_upload(
   }
 }
 
-Multipart_object_part Container::upload_part(const Multipart_object &object,
-                                             size_t part_num, const char *body,
-                                             size_t size) {
+Multipart_object_part Container::upload_part(
+    const Multipart_object &object, size_t part_num, const char *body,
+    size_t size, std::vector<unsigned char> body_sha256) {
   auto request = upload_part_request(object, part_num, size);
   request.body = body;
   request.size = size;
+  request.body_sha256 = std::move(body_sha256);
   Response response;
 
   try {
     ensure_connection()->put(&request, &response);
   } catch (const Response_error &error) {
-    throw Response_error(
-        error.status_code(),
-        shcore::str_format("Failed to upload part %zu for object '%s': %s",
-                           part_num, object.name.c_str(), error.what()));
+    throw upload_part_error(error, part_num, object.name);
   }
 
   return {part_num, parse_multipart_upload(response), size};
 }
 
+std::future<Multipart_object_part> Container::upload_part_async(
+    const Multipart_object &object, size_t part_num, const char *body,
+    size_t size, std::vector<unsigned char> body_sha256) {
+  struct Context {
+    rest::Signed_request request;
+    Response response;
+    std::promise<Multipart_object_part> result;
+  };
+
+  const auto context = std::make_shared<Context>(
+      Context{upload_part_request(object, part_num, size)});
+  auto result = context->result.get_future();
+
+  context->request.type = rest::Type::PUT;
+  context->request.body = body;
+  context->request.size = size;
+  context->request.body_sha256 = std::move(body_sha256);
+
+  ensure_connection()->execute_async(
+      &context->request, &context->response,
+      [this, context, name = object.name, part_num, size](
+          Response::Status_code, std::exception_ptr e) {
+        // executed by the engine thread, only the response headers are parsed
+        try {
+          if (e) std::rethrow_exception(e);
+          context->result.set_value(
+              {part_num, parse_multipart_upload(context->response), size});
+        } catch (const Response_error &error) {
+          context->result.set_exception(std::make_exception_ptr(
+              upload_part_error(error, part_num, name)));
+        } catch (...) {
+          context->result.set_exception(std::current_exception());
+        }
+      });
+
+  return result;
+}
+
 std::string Container::parse_multipart_upload(const rest::Response &response) {
   return response.headers.at("ETag");
 }
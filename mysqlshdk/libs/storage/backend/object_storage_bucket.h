@@ -26,6 +26,7 @@
 #ifndef MYSQLSHDK_LIBS_STORAGE_BACKEND_OBJECT_STORAGE_BUCKET_H_
 #define MYSQLSHDK_LIBS_STORAGE_BACKEND_OBJECT_STORAGE_BUCKET_H_
 
+#include <future>
 #include <optional>
 #include <string>
 #include <thread>
@@ -89,13 +90,22 @@ class Container {
    * @param fields: Fields to fetch.
    * @param out_prefixes: If not recursive, names of the subdirectories will
    *                      be stored here.
+   * @param start_after: List only objects which follow this one in
+   *                     lexicographical order, requires
+   *                     has_list_objects_start_after().
    *
    * @returns A list of objects.
    */
   std::vector<Object_details> list_objects(
       const std::string &prefix = "", size_t limit = 0, bool recursive = true,
       const Object_details::Fields_mask &fields = Object_details::NAME_SIZE,
-      std::unordered_set<std::string> *out_prefixes = nullptr);
+      std::unordered_set<std::string> *out_prefixes = nullptr,
+      const std::string &start_after = "");
+
+  /**
+   * Determines whether objects can be listed starting after the given object.
+   */
+  virtual bool has_list_objects_start_after() const { return false; }
 
   /**
    * Retrieves basic information from an object in the bucket.
@@ -123,6 +133,13 @@ class Container {
    */
   virtual bool has_object_rename() const { return true; }
 
+  /**
+   * Determines whether the SHA256 hash of the uploaded data is used when
+   * sending requests. If so, uploaders can compute it as the data is
+   * produced and pass it to put_object() and upload_part().
+   */
+  virtual bool uses_body_sha256() const { return false; }
+
   /**
    * Renames an object.
    *
@@ -137,9 +154,10 @@ class Container {
    * @param object_name: The name of the object to be created.
    * @param data: Buffer containing the information to be stored on the object.
    * @param size: The length of the data contained on the buffer.
+   * @param body_sha256: SHA256 hash of the data, if it's already known.
    */
   void put_object(const std::string &object_name, const char *data,
-                  size_t size);
+                  size_t size, std::vector<unsigned char> body_sha256 = {});
 
   /**
    * Retrieves content data from an object.
@@ -172,6 +190,23 @@ class Container {
   size_t get_object(const std::string &object_name,
                     mysqlshdk::rest::Base_response_buffer *buffer);
 
+  /**
+   * Retrieves content data from an object asynchronously, returns immediately.
+   *
+   * This object and the buffer must be valid until the data is retrieved.
+   *
+   * @param object_name: The object from which the data is to be retrieved.
+   * @param buffer: A buffer where the data will be stored.
+   * @param from_byte: First byte to be retrieved from the object.
+   * @param to_byte: Last byte to be retrieved from the object.
+   *
+   * @returns The number of retrieved bytes, once they are available.
+   */
+  std::future<size_t> get_object_async(
+      const std::string &object_name,
+      mysqlshdk::rest::Base_response_buffer *buffer, size_t from_byte,
+      size_t to_byte);
+
   // Multipart Handling
 
   /**
@@ -215,12 +250,28 @@ class Container {
    * @param object: the multipart object data for which this part belongs.
    * @param part_num: an incremental identifier for the part, the object will be
    * assembled joining the parts in ascending order based on this identifier.
+   * @param body_sha256: SHA256 hash of the body, if it's already known.
    *
    * @returns the part summary of the uploaded part.
    */
-  Multipart_object_part upload_part(const Multipart_object &object,
-                                    size_t part_num, const char *body,
-                                    size_t size);
+  Multipart_object_part upload_part(
+      const Multipart_object &object, size_t part_num, const char *body,
+      size_t size, std::vector<unsigned char> body_sha256 = {});
+
+  /**
+   * Uploads a part for an object being uploaded asynchronously, returns
+   * immediately. Parts of the same object can be uploaded concurrently.
+   *
+   * This object and the body must be valid until the upload is finished, the
+   * Object handle waits for its uploads before releasing the container.
+   *
+   * @see upload_part()
+   *
+   * @returns the part summary of the uploaded part, once it's uploaded.
+   */
+  std::future<Multipart_object_part> upload_part_async(
+      const Multipart_object &object, size_t part_num, const char *body,
+      size_t size, std::vector<unsigned char> body_sha256 = {});
 
   /**
    * Finishes a multipart object upload.
@@ -253,8 +304,8 @@ class Container {
  private:
   virtual rest::Signed_request list_objects_request(
       const std::string &prefix, size_t limit, bool recursive,
-      const Object_details::Fields_mask &fields,
-      const std::string &start_from) = 0;
+      const Object_details::Fields_mask &fields, const std::string &start_from,
+      const std::string &start_after) = 0;
 
   virtual std::vector<Object_details> parse_list_objects(
       const rest::Base_response_buffer &buffer, std::string *next_start_from,
@@ -324,6 +375,10 @@ class Container {
   void handle_multipart_request(rest::Signed_request *request,
                                 rest::Response *response = nullptr);
 
+  rest::Signed_request ranged_get_object_request(
+      const std::string &object_name, const std::optional<size_t> &from_byte,
+      const std::optional<size_t> &to_byte, std::string *range);
+
   Config_ptr m_config;
   rest::Signed_rest_service *m_rest_service = nullptr;
   std::thread::id m_rest_service_thread;
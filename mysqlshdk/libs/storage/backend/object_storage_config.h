@@ -60,6 +60,41 @@ class Config : public storage::Config, public rest::Signed_rest_service_config {
   std::size_t part_size() const { return m_part_size; }
   void set_part_size(std::size_t size) { m_part_size = size; }
 
+  /**
+   * Maximum number of parts of a single multipart upload which are allowed to
+   * be uploaded concurrently. Each of these parts is kept in memory until it is
+   * uploaded, so the memory used by a single object being written is bounded
+   * by: (max_parts_in_flight() + 1) * part_size().
+   *
+   * If set to 1 (default), parts are uploaded synchronously.
+   */
+  std::size_t max_parts_in_flight() const { return m_max_parts_in_flight; }
+  void set_max_parts_in_flight(std::size_t parts) {
+    assert(parts > 0);
+    m_max_parts_in_flight = parts;
+  }
+
+  /**
+   * Size of a single block which is fetched ahead of the current read
+   * position of an object. If set to 0 (default), read-ahead is disabled and
+   * each read() call is handled by a single ranged GET request.
+   */
+  std::size_t read_ahead_block_size() const { return m_read_ahead_block_size; }
+  void set_read_ahead_block_size(std::size_t size) {
+    m_read_ahead_block_size = size;
+  }
+
+  /**
+   * Maximum number of blocks which are fetched concurrently ahead of the
+   * current read position of an object. Memory used by a single object being
+   * read is bounded by: read_ahead_blocks() * read_ahead_block_size().
+   */
+  std::size_t read_ahead_blocks() const { return m_read_ahead_blocks; }
+  void set_read_ahead_blocks(std::size_t blocks) {
+    assert(blocks > 0);
+    m_read_ahead_blocks = blocks;
+  }
+
   virtual const std::string &hash() const = 0;
 
   virtual std::unique_ptr<Container> container() const = 0;
@@ -70,6 +105,9 @@ class Config : public storage::Config, public rest::Signed_rest_service_config {
   std::string m_container_name;
   std::string m_config_file;
   std::size_t m_part_size;
+  std::size_t m_max_parts_in_flight = 1;
+  std::size_t m_read_ahead_block_size = 0;
+  std::size_t m_read_ahead_blocks = 4;
 
  private:
   std::string describe_url(const std::string &url) const override;
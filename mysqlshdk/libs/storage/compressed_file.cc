@@ -30,6 +30,7 @@
 #include <vector>
 
 #include "mysqlshdk/libs/storage/compression/gz_file.h"
+#include "mysqlshdk/libs/storage/compression/lz4_file.h"
 #include "mysqlshdk/libs/storage/compression/zstd_file.h"
 #include "mysqlshdk/libs/storage/idirectory.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
@@ -44,10 +45,11 @@ void ensure_no_compression_options(const Compression_options &opts, void *) {
     throw std::invalid_argument("Compression options not supported");
 }
 
-#define COMPRESSIONS                                                      \
-  X(NONE, "none", "", ensure_no_compression_options)                      \
-  X(GZIP, "gzip", ".gz", compression::Gz_file::parse_compression_options) \
-  X(ZSTD, "zstd", ".zst", compression::Zstd_file::parse_compression_options)
+#define COMPRESSIONS                                                         \
+  X(NONE, "none", "", ensure_no_compression_options)                         \
+  X(GZIP, "gzip", ".gz", compression::Gz_file::parse_compression_options)    \
+  X(ZSTD, "zstd", ".zst", compression::Zstd_file::parse_compression_options) \
+  X(LZ4, "lz4", ".lz4", compression::Lz4_file::parse_compression_options)
 
 }  // namespace
 
@@ -189,6 +191,12 @@ std::unique_ptr<IFile> make_file(
 
       break;
 
+    case Compression::LZ4:
+      result = std::make_unique<compression::Lz4_file>(std::move(file),
+                                                       compression_options);
+
+      break;
+
     default:
       throw std::logic_error("Unhandled compression type: " + to_string(c));
   }
@@ -35,7 +35,7 @@
 namespace mysqlshdk {
 namespace storage {
 
-enum class Compression { NONE, GZIP, ZSTD };
+enum class Compression { NONE, GZIP, ZSTD, LZ4 };
 
 using Compression_options = std::unordered_map<std::string, std::string>;
 
@@ -26,16 +26,274 @@
 #include "mysqlshdk/libs/storage/compression/gz_file.h"
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <limits>
+#include <mutex>
+#include <thread>
 #include <utility>
 
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
 #include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/synchronized_queue.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
 namespace mysqlshdk {
 namespace storage {
 namespace compression {
 
+namespace {
+
+// size of the uncompressed block compressed by a single thread
+constexpr size_t k_block_size = 128 * 1024;
+// each block uses the tail of the previous one as a dictionary
+constexpr size_t k_dictionary_size = 32 * 1024;
+// upper limit for the number of compression threads
+constexpr int k_max_threads = 256;
+
+void store_le32(uint32_t value, uint8_t *out) {
+  out[0] = value & 0xFF;
+  out[1] = (value >> 8) & 0xFF;
+  out[2] = (value >> 16) & 0xFF;
+  out[3] = (value >> 24) & 0xFF;
+}
+
+}  // namespace
+
+class Gz_file::Block_compressor final {
+ public:
+  Block_compressor(Gz_file *owner, int level, int threads)
+      : m_owner(owner), m_max_blocks(2 * threads) {
+    m_workers.reserve(threads);
+
+    for (int i = 0; i < threads; ++i) {
+      m_workers.emplace_back(
+          mysqlsh::spawn_scoped_thread([this, level]() { worker(level); }));
+    }
+  }
+
+  Block_compressor(const Block_compressor &) = delete;
+  Block_compressor(Block_compressor &&) = delete;
+
+  Block_compressor &operator=(const Block_compressor &) = delete;
+  Block_compressor &operator=(Block_compressor &&) = delete;
+
+  ~Block_compressor() {
+    m_queue.shutdown(m_workers.size());
+
+    for (auto &worker : m_workers) {
+      worker.join();
+    }
+  }
+
+  void write(const uint8_t *buffer, size_t length) {
+    m_total_in += length;
+
+    while (length > 0) {
+      const auto bytes = std::min(length, k_block_size - m_input.size());
+      m_input.append(reinterpret_cast<const char *>(buffer), bytes);
+      buffer += bytes;
+      length -= bytes;
+
+      if (k_block_size == m_input.size()) {
+        submit(false);
+      }
+    }
+  }
+
+  void finish() {
+    submit(true);
+
+    while (!m_blocks.empty()) {
+      write_block();
+    }
+
+    // gzip trailer: CRC32 and size of the uncompressed data modulo 2^32
+    uint8_t trailer[8];
+    store_le32(m_crc, trailer);
+    store_le32(static_cast<uint32_t>(m_total_in), trailer + 4);
+    write_raw(trailer, sizeof(trailer));
+  }
+
+  uint64_t total_in() const { return m_total_in; }
+
+  uint64_t total_out() const { return m_total_out; }
+
+ private:
+  struct Block {
+    std::string input;
+    std::string dictionary;
+    bool last = false;
+
+    std::string output;
+    uLong crc = 0;
+    std::exception_ptr error;
+    bool done = false;
+  };
+
+  void submit(bool last) {
+    auto block = std::make_shared<Block>();
+    block->dictionary = std::move(m_dictionary);
+    block->last = last;
+
+    m_dictionary = m_input.substr(
+        m_input.size() - std::min(m_input.size(), k_dictionary_size));
+    block->input = std::move(m_input);
+
+    m_input = {};
+    m_input.reserve(k_block_size);
+
+    m_blocks.emplace_back(block);
+    m_queue.push(std::move(block));
+
+    // write out all blocks which are ready, bound the memory usage
+    while (!m_blocks.empty() &&
+           (m_blocks.size() > m_max_blocks || is_done(*m_blocks.front()))) {
+      write_block();
+    }
+  }
+
+  bool is_done(const Block &block) {
+    std::lock_guard lock{m_mutex};
+    return block.done;
+  }
+
+  void write_block() {
+    const auto block = std::move(m_blocks.front());
+    m_blocks.pop_front();
+
+    {
+      std::unique_lock lock{m_mutex};
+      m_block_done.wait(lock, [&block]() { return block->done; });
+    }
+
+    if (block->error) {
+      std::rethrow_exception(block->error);
+    }
+
+    if (!m_header_written) {
+      // gzip header: no flags, no modification time, unknown OS
+      const uint8_t header[] = {0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 0xff};
+      write_raw(header, sizeof(header));
+      m_header_written = true;
+    }
+
+    m_crc = crc32_combine(m_crc, block->crc, block->input.size());
+    write_raw(block->output.data(), block->output.size());
+  }
+
+  void write_raw(const void *buffer, size_t length) {
+    const auto bytes = m_owner->file()->write(buffer, length);
+
+    if (bytes < 0 || static_cast<size_t>(bytes) != length) {
+      throw std::runtime_error("deflate: cannot write");
+    }
+
+    m_owner->update_io(length);
+    m_total_out += length;
+  }
+
+  void worker(int level) {
+    z_stream stream{};
+    const auto initialized =
+        Z_OK ==
+        deflateInit2(&stream, level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY);
+
+    while (const auto block = m_queue.pop()) {
+      try {
+        if (!initialized) {
+          throw std::runtime_error("deflate init failed");
+        }
+
+        compress(&stream, block.get());
+      } catch (...) {
+        block->error = std::current_exception();
+      }
+
+      {
+        std::lock_guard lock{m_mutex};
+        block->done = true;
+      }
+
+      m_block_done.notify_all();
+    }
+
+    if (initialized) {
+      deflateEnd(&stream);
+    }
+  }
+
+  static void compress(z_stream *stream, Block *block) {
+    if (Z_OK != deflateReset(stream)) {
+      throw std::runtime_error("deflate: reset failed");
+    }
+
+    if (!block->dictionary.empty() &&
+        Z_OK != deflateSetDictionary(
+                    stream,
+                    reinterpret_cast<const Bytef *>(block->dictionary.data()),
+                    block->dictionary.size())) {
+      throw std::runtime_error("deflate: cannot set dictionary");
+    }
+
+    const auto input = reinterpret_cast<const Bytef *>(block->input.data());
+    block->crc = crc32(crc32(0, nullptr, 0), input, block->input.size());
+
+    stream->next_in = const_cast<Bytef *>(input);
+    stream->avail_in = block->input.size();
+
+    // all blocks but the last one end with a sync flush, so that the next
+    // one starts on a byte boundary and they can be simply concatenated
+    const auto flush = block->last ? Z_FINISH : Z_SYNC_FLUSH;
+    // room for the sync flush marker
+    block->output.resize(deflateBound(stream, block->input.size()) + 16);
+    size_t have = 0;
+
+    while (true) {
+      stream->next_out = reinterpret_cast<Bytef *>(&block->output[have]);
+      stream->avail_out = block->output.size() - have;
+
+      const auto ret = deflate(stream, flush);
+
+      if (Z_STREAM_ERROR == ret) {
+        throw std::runtime_error(
+            std::string("deflate: stream error (") +
+            (stream->msg ? stream->msg : "unknown error") + ")");
+      }
+
+      have = block->output.size() - stream->avail_out;
+
+      if (Z_STREAM_END == ret ||
+          (0 == stream->avail_in && 0 != stream->avail_out)) {
+        break;
+      }
+
+      block->output.resize(2 * block->output.size());
+    }
+
+    block->output.resize(have);
+  }
+
+  Gz_file *m_owner;
+  const size_t m_max_blocks;
+
+  std::vector<std::thread> m_workers;
+  shcore::Synchronized_queue<std::shared_ptr<Block>> m_queue;
+  std::mutex m_mutex;
+  std::condition_variable m_block_done;
+
+  // blocks which are being compressed, in the order they were submitted
+  std::deque<std::shared_ptr<Block>> m_blocks;
+  std::string m_input;
+  std::string m_dictionary;
+  bool m_header_written = false;
+
+  uLong m_crc = crc32(0, nullptr, 0);
+  uint64_t m_total_in = 0;
+  uint64_t m_total_out = 0;
+};
+
 Gz_file::Gz_file(std::unique_ptr<IFile> file,
                  const Compression_options &options)
     : Compressed_file(std::move(file)) {
@@ -99,12 +357,36 @@ ssize_t Gz_file::read(void *buffer, size_t length) {
   return length - m_stream.avail_out;
 }
 
+off64_t Gz_file::tell() const {
+  if (m_compressor) {
+    return std::max(m_compressor->total_in(), m_compressor->total_out());
+  }
+
+  return std::max(m_stream.total_in, m_stream.total_out);
+}
+
 ssize_t Gz_file::write(const void *buffer, size_t length) {
+  if (m_compressor) {
+    start_io();
+    m_compressor->write(static_cast<const uint8_t *>(buffer), length);
+    finish_io();
+
+    return length;
+  }
+
   return do_write(static_cast<Bytef *>(const_cast<void *>(buffer)), length,
                   Z_NO_FLUSH);
 }
 
 void Gz_file::write_finish() {
+  if (m_compressor) {
+    start_io();
+    m_compressor->finish();
+    finish_io();
+
+    return;
+  }
+
   // deflate() may return Z_STREAM_ERROR if next_in is NULL
   char c = 0;
   (void)do_write(&c, 0, Z_FINISH);
@@ -128,6 +410,12 @@ void Gz_file::init_read() {
 }
 
 void Gz_file::init_write() {
+  if (m_threads > 0) {
+    m_compressor =
+        std::make_unique<Block_compressor>(this, m_clevel, m_threads);
+    return;
+  }
+
   m_stream.zalloc = nullptr;
   m_stream.zfree = nullptr;
   m_stream.opaque = nullptr;
@@ -180,12 +468,17 @@ void Gz_file::do_close() {
       (void)result;
       assert(result == Z_OK);
     } break;
-    case Mode::WRITE: {
+    case Mode::WRITE:
       write_finish();
-      auto result = deflateEnd(&m_stream);
-      (void)result;
-      assert(result == Z_OK);
-    } break;
+
+      if (m_compressor) {
+        m_compressor.reset();
+      } else {
+        auto result = deflateEnd(&m_stream);
+        (void)result;
+        assert(result == Z_OK);
+      }
+      break;
     case Mode::APPEND:
       break;
   }
@@ -211,6 +504,17 @@ void Gz_file::parse_compression_options(const Compression_options &options,
         throw std::invalid_argument("Invalid compression level for gzip: " +
                                     opt.second);
       if (out) out->m_clevel = level;
+    } else if (opt.first == "threads") {
+      int threads;
+      try {
+        threads = std::stoi(opt.second);
+      } catch (...) {
+        threads = -1;
+      }
+      if (threads < 0 || threads > k_max_threads)
+        throw std::invalid_argument(
+            "Invalid number of compression threads for gzip: " + opt.second);
+      if (out) out->m_threads = threads;
     } else {
       throw std::invalid_argument("Invalid compression option for gzip: " +
                                   opt.first);
@@ -65,9 +65,7 @@ class Gz_file : public Compressed_file {
     throw std::logic_error("Gz_file::seek() - not supported");
   }
 
-  off64_t tell() const override {
-    return std::max(m_stream.total_in, m_stream.total_out);
-  }
+  off64_t tell() const override;
 
   ssize_t read(void *buffer, size_t length) override;
   ssize_t write(const void *buffer, size_t length) override;
@@ -76,6 +74,13 @@ class Gz_file : public Compressed_file {
                                         Gz_file *out);
 
  private:
+  /**
+   * Compresses the data using multiple threads (like pigz does): input is
+   * split into blocks, which are compressed independently and concatenated
+   * into a single gzip stream.
+   */
+  class Block_compressor;
+
   struct Buf_view {
     uint8_t *ptr;
     size_t length;
@@ -113,6 +118,10 @@ class Gz_file : public Compressed_file {
   std::vector<uint8_t> m_source;
   std::optional<Mode> m_open_mode;
   int m_clevel = 1;  // Z_DEFAULT_COMPRESSION
+  // number of compression threads, compression is done in the calling thread
+  // if this is 0
+  int m_threads = 0;
+  std::unique_ptr<Block_compressor> m_compressor;
 };
 
 Gz_file::Buf_view Gz_file::peek(const size_t length) {
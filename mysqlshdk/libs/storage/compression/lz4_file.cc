@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/storage/compression/lz4_file.h"
+
+#include <lz4hc.h>
+#include <cassert>
+#include <utility>
+
+#include "mysqlshdk/libs/utils/logger.h"
+
+namespace mysqlshdk {
+namespace storage {
+namespace compression {
+
+namespace {
+
+void check_lz4_error(size_t result, const char *context) {
+  if (LZ4F_isError(result)) {
+    throw std::runtime_error(std::string(context) + ": " +
+                             LZ4F_getErrorName(result));
+  }
+}
+
+}  // namespace
+
+Lz4_file::Lz4_file(std::unique_ptr<IFile> file,
+                   const Compression_options &options)
+    : Compressed_file(std::move(file)), m_prefs{} {
+  parse_compression_options(options, this);
+}
+
+Lz4_file::~Lz4_file() {
+  try {
+    if (is_open()) do_close();
+  } catch (const std::runtime_error &e) {
+    log_error("Failed to close LZ4 file: %s", e.what());
+  }
+}
+
+Lz4_file::Buf_view Lz4_file::peek(const size_t length) {
+  const auto avail = m_source.size();
+  if (avail < length) {
+    m_source.resize(length);
+    const auto bytes_read = file()->read(&m_source[avail], length - avail);
+    m_source.resize(avail + std::max<ssize_t>(bytes_read, 0));
+  }
+  return Lz4_file::Buf_view{m_source.data(), m_source.size()};
+}
+
+ssize_t Lz4_file::read(void *buffer, size_t length) {
+  const auto out = static_cast<uint8_t *>(buffer);
+  size_t produced = 0;
+
+  start_io();
+
+  while (produced < length) {
+    const auto input_buf = peek(CHUNK);
+    size_t dst_size = length - produced;
+    size_t src_size = input_buf.length;
+
+    const auto result =
+        LZ4F_decompress(m_dctx, out + produced, &dst_size,
+                        src_size ? input_buf.ptr : nullptr, &src_size, nullptr);
+    check_lz4_error(result, "LZ4F_decompress");
+
+    if (src_size > 0) {
+      consume(src_size);
+      update_io(src_size);
+      m_total_in += src_size;
+      // 0 means that the frame has been fully decoded
+      m_next_input_hint = result;
+    }
+
+    produced += dst_size;
+    m_total_out += dst_size;
+
+    if (0 == src_size && 0 == dst_size) {
+      // no more input, internal buffers have been flushed
+      if (0 != m_next_input_hint) {
+        throw std::runtime_error("LZ4F_decompress: truncated input");
+      }
+
+      break;
+    }
+  }
+
+  finish_io();
+
+  return produced;
+}
+
+ssize_t Lz4_file::write(const void *buffer, size_t length) {
+  auto ptr = static_cast<const uint8_t *>(buffer);
+  auto remaining = length;
+
+  start_io();
+
+  if (!m_frame_started) {
+    write_begin();
+  }
+
+  while (remaining > 0) {
+    const auto size = std::min(remaining, CHUNK);
+    const auto result = LZ4F_compressUpdate(
+        m_cctx, m_buffer.data(), m_buffer.size(), ptr, size, nullptr);
+    check_lz4_error(result, "LZ4F_compressUpdate");
+    write_buffer(result);
+
+    ptr += size;
+    remaining -= size;
+  }
+
+  m_total_in += length;
+
+  finish_io();
+
+  return length;
+}
+
+void Lz4_file::write_begin() {
+  const auto result = LZ4F_compressBegin(m_cctx, m_buffer.data(),
+                                         m_buffer.size(), &m_prefs);
+  check_lz4_error(result, "LZ4F_compressBegin");
+  write_buffer(result);
+
+  m_frame_started = true;
+}
+
+void Lz4_file::write_finish() {
+  start_io();
+
+  if (!m_frame_started) {
+    // an empty file is still a valid frame
+    write_begin();
+  }
+
+  const auto result =
+      LZ4F_compressEnd(m_cctx, m_buffer.data(), m_buffer.size(), nullptr);
+  check_lz4_error(result, "LZ4F_compressEnd");
+  write_buffer(result);
+
+  finish_io();
+}
+
+void Lz4_file::write_buffer(size_t length) {
+  if (0 == length) return;
+
+  const auto bytes = file()->write(m_buffer.data(), length);
+
+  if (bytes < 0 || static_cast<size_t>(bytes) != length) {
+    throw std::runtime_error("LZ4F_compress: cannot write");
+  }
+
+  update_io(length);
+  m_total_out += length;
+}
+
+void Lz4_file::init_read() {
+  if (!m_dctx) {
+    check_lz4_error(LZ4F_createDecompressionContext(&m_dctx, LZ4F_VERSION),
+                    "lz4 decompression context init failed");
+  }
+
+  m_source.resize(0);
+  m_next_input_hint = 0;
+}
+
+void Lz4_file::init_write() {
+  if (!m_cctx) {
+    check_lz4_error(LZ4F_createCompressionContext(&m_cctx, LZ4F_VERSION),
+                    "lz4 compression context init failed");
+  }
+
+  // independent blocks, so that they could be decompressed in parallel
+  m_prefs.frameInfo.blockSizeID = LZ4F_max256KB;
+  m_prefs.frameInfo.blockMode = LZ4F_blockIndependent;
+  m_prefs.frameInfo.contentChecksumFlag = LZ4F_contentChecksumEnabled;
+  m_prefs.compressionLevel = m_clevel;
+
+  // large enough to hold the frame header, a compressed chunk and the footer
+  m_buffer.resize(std::max<size_t>(LZ4F_compressBound(CHUNK, &m_prefs),
+                                   LZ4F_HEADER_SIZE_MAX));
+  m_frame_started = false;
+}
+
+void Lz4_file::open(Mode m) {
+  if (!file()->is_open()) {
+    file()->open(m);
+  }
+
+  switch (m) {
+    case Mode::READ:
+      init_read();
+      break;
+    case Mode::WRITE:
+      init_write();
+      break;
+    case Mode::APPEND:
+      throw std::invalid_argument("append not supported for lz4 file");
+  }
+
+  m_open_mode = m;
+  m_total_in = 0;
+  m_total_out = 0;
+}
+
+bool Lz4_file::is_open() const {
+  return m_open_mode.has_value() && file()->is_open();
+}
+
+void Lz4_file::close() { do_close(); }
+
+void Lz4_file::do_close() {
+  assert(is_open());
+
+  switch (*m_open_mode) {
+    case Mode::READ:
+      if (m_dctx) LZ4F_freeDecompressionContext(m_dctx);
+      m_dctx = nullptr;
+      break;
+
+    case Mode::WRITE:
+      write_finish();
+      if (m_cctx) LZ4F_freeCompressionContext(m_cctx);
+      m_cctx = nullptr;
+      break;
+
+    case Mode::APPEND:
+      break;
+  }
+
+  m_open_mode.reset();
+  m_source.resize(0);
+  m_buffer.resize(0);
+
+  if (file()->is_open()) {
+    file()->close();
+  }
+}
+
+void Lz4_file::parse_compression_options(const Compression_options &options,
+                                         Lz4_file *out) {
+  for (const auto &opt : options) {
+    if (opt.first == "level") {
+      int level;
+      try {
+        level = std::stoi(opt.second);
+      } catch (...) {
+        level = -1;
+      }
+      if (level < 0 || level > LZ4HC_CLEVEL_MAX)
+        throw std::invalid_argument("Invalid compression level for lz4: " +
+                                    opt.second);
+      if (out) out->m_clevel = level;
+    } else {
+      throw std::invalid_argument("Invalid compression option for lz4: " +
+                                  opt.first);
+    }
+  }
+}
+
+}  // namespace compression
+}  // namespace storage
+}  // namespace mysqlshdk
@@ -26,17 +26,56 @@
 #include "mysqlshdk/libs/storage/compression/zstd_file.h"
 
 #include <algorithm>
+#include <cstring>
 #include <limits>
 #include <utility>
 
 #include "mysqlshdk/libs/storage/backend/file.h"
 #include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/strformat.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
 namespace mysqlshdk {
 namespace storage {
 namespace compression {
 
+namespace {
+
+// Seekable format, compatible with the one defined in the zstd repository
+// (contrib/seekable_format/zstd_seekable_compression_format.md):
+//  - data is compressed using independent frames,
+//  - a skippable frame is written at the end of the file, it holds the seek
+//    table (compressed and decompressed size of each frame) and a footer.
+// Files written using this format can be decompressed by any zstd decoder.
+constexpr uint32_t k_skippable_frame_magic = 0x184D2A5E;
+constexpr uint32_t k_seekable_magic = 0x8F92EAB1;
+constexpr size_t k_skippable_header_size = 8;
+constexpr size_t k_seek_table_footer_size = 9;
+constexpr size_t k_seek_table_entry_size = 8;
+constexpr uint8_t k_checksum_flag = 0x80;
+constexpr uint8_t k_reserved_bits = 0x7C;
+// decompressed size of a frame needs to fit in 32 bits, compressed size of a
+// frame of this size is guaranteed to fit as well
+constexpr size_t k_max_frame_size = 1024 * 1024 * 1024;
+// upper limit for the number of compression threads, matches the one used by
+// zstd on 64-bit platforms
+constexpr int k_max_threads = 256;
+
+void write_le32(uint32_t value, std::string *out) {
+  for (int i = 0; i < 4; ++i) {
+    out->push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+  }
+}
+
+uint32_t read_le32(const uint8_t *data) {
+  return static_cast<uint32_t>(data[0]) |
+         (static_cast<uint32_t>(data[1]) << 8) |
+         (static_cast<uint32_t>(data[2]) << 16) |
+         (static_cast<uint32_t>(data[3]) << 24);
+}
+
+}  // namespace
+
 Zstd_file::Zstd_file(std::unique_ptr<IFile> file,
                      const Compression_options &options)
     : Compressed_file(std::move(file)) {
@@ -63,6 +102,7 @@ Zstd_file::Buf_view Zstd_file::peek(const size_t length) {
       m_buffer.resize(avail);  // revert extent_to_fit
     } else {
       m_buffer.resize(avail + bytes_read);
+      m_file_offset += bytes_read;
     }
   }
   return Buf_view{m_buffer.data(), m_buffer.size()};
@@ -149,7 +189,40 @@ ssize_t Zstd_file::write(const void *buffer, size_t length) {
 
   m_offset += length;
 
-  return (*this.*m_write_f)(&ibuf, ZSTD_e_continue);
+  if (0 == m_frame_size) {
+    return (*this.*m_write_f)(&ibuf, ZSTD_e_continue);
+  }
+
+  // seekable format, input is split into frames
+  size_t io_size = 0;
+
+  while (ibuf.pos < length) {
+    const auto bytes = std::min<size_t>(
+        length - ibuf.pos, m_frame_size - m_current_frame.decompressed_size);
+    ZSTD_inBuffer frame_ibuf;
+    frame_ibuf.size = bytes;
+    frame_ibuf.pos = 0;
+    frame_ibuf.src = static_cast<const uint8_t *>(buffer) + ibuf.pos;
+
+    (*this.*m_write_f)(&frame_ibuf, ZSTD_e_continue);
+
+    m_current_frame.compressed_size += latest_io_size();
+    m_current_frame.decompressed_size += bytes;
+    io_size += latest_io_size();
+    ibuf.pos += bytes;
+
+    if (m_current_frame.decompressed_size == m_frame_size) {
+      end_frame();
+      io_size += latest_io_size();
+    }
+  }
+
+  // report the total number of bytes written by this call
+  start_io();
+  update_io(io_size);
+  finish_io();
+
+  return length;
 }
 
 bool Zstd_file::flush() {
@@ -160,10 +233,25 @@ bool Zstd_file::flush() {
 
   (*this.*m_write_f)(&ibuf, ZSTD_e_flush);
 
+  if (m_frame_size) {
+    m_current_frame.compressed_size += latest_io_size();
+  }
+
   return file()->flush();
 }
 
 void Zstd_file::write_finish() {
+  if (m_frame_size) {
+    // write the last frame, even if there was no data at all, so that the
+    // output is always a valid zstd file
+    if (m_current_frame.decompressed_size > 0 || m_frames.empty()) {
+      end_frame();
+    }
+
+    write_seek_table();
+    return;
+  }
+
   ZSTD_inBuffer ibuf;
   ibuf.size = 0;
   ibuf.pos = 0;
@@ -172,6 +260,73 @@ void Zstd_file::write_finish() {
   (*this.*m_write_f)(&ibuf, ZSTD_e_end);
 }
 
+void Zstd_file::end_frame() {
+  ZSTD_inBuffer ibuf;
+  ibuf.size = 0;
+  ibuf.pos = 0;
+  ibuf.src = nullptr;
+
+  (*this.*m_write_f)(&ibuf, ZSTD_e_end);
+
+  m_current_frame.compressed_size += latest_io_size();
+  m_frames.emplace_back(m_current_frame);
+
+  Frame next;
+  next.compressed_offset =
+      m_current_frame.compressed_offset + m_current_frame.compressed_size;
+  next.decompressed_offset =
+      m_current_frame.decompressed_offset + m_current_frame.decompressed_size;
+  m_current_frame = next;
+}
+
+void Zstd_file::write_seek_table() {
+  std::string table;
+  table.reserve(k_skippable_header_size +
+                m_frames.size() * k_seek_table_entry_size +
+                k_seek_table_footer_size);
+
+  write_le32(k_skippable_frame_magic, &table);
+  write_le32(static_cast<uint32_t>(m_frames.size() * k_seek_table_entry_size +
+                                   k_seek_table_footer_size),
+             &table);
+
+  for (const auto &frame : m_frames) {
+    write_le32(frame.compressed_size, &table);
+    write_le32(frame.decompressed_size, &table);
+  }
+
+  write_le32(static_cast<uint32_t>(m_frames.size()), &table);
+  // descriptor: no checksums
+  table.push_back(0);
+  write_le32(k_seekable_magic, &table);
+
+  start_io();
+  write_raw(table.data(), table.size());
+  update_io(table.size());
+  finish_io();
+}
+
+void Zstd_file::write_raw(const void *buffer, size_t length) {
+  if (is_mmapped()) {
+    auto *mfile = static_cast<backend::File *>(file());
+    const auto ptr = mfile->mmap_will_write(length);
+
+    if (!ptr) {
+      throw std::runtime_error(
+          std::string("Error reserving space on mmapped file"));
+    }
+
+    ::memcpy(ptr, buffer, length);
+    mfile->mmap_did_write(length);
+  } else {
+    const auto r = file()->write(buffer, length);
+
+    if (r < 0 || static_cast<size_t>(r) != length) {
+      throw std::runtime_error("zstd.write: error writing the seek table");
+    }
+  }
+}
+
 ssize_t Zstd_file::do_write(ZSTD_inBuffer *ibuf, ZSTD_EndDirective op) {
   ZSTD_outBuffer obuf;
 
@@ -200,8 +355,8 @@ ssize_t Zstd_file::do_write(ZSTD_inBuffer *ibuf, ZSTD_EndDirective op) {
 
       obuf.pos = 0;
     }
-    // make sure the whole input buffer is consumed
-    done = (op == ZSTD_e_end) ? (status == 0) : ibuf->pos == ibuf->size;
+    // make sure the whole input buffer is consumed, or everything is flushed
+    done = (op == ZSTD_e_continue) ? ibuf->pos == ibuf->size : (status == 0);
   } while (!done);
 
   finish_io();
@@ -236,8 +391,8 @@ ssize_t Zstd_file::do_write_mmap(ZSTD_inBuffer *ibuf, ZSTD_EndDirective op) {
       obuf.dst = mfile->mmap_did_write(obuf.pos, &obuf.size);
       obuf.pos = 0;
     }
-    // make sure the whole input buffer is consumed
-    done = (op == ZSTD_e_end) ? (status == 0) : ibuf->pos == ibuf->size;
+    // make sure the whole input buffer is consumed, or everything is flushed
+    done = (op == ZSTD_e_continue) ? ibuf->pos == ibuf->size : (status == 0);
   } while (!done);
 
   finish_io();
@@ -245,6 +400,160 @@ ssize_t Zstd_file::do_write_mmap(ZSTD_inBuffer *ibuf, ZSTD_EndDirective op) {
   return ibuf->size;
 }
 
+bool Zstd_file::is_seekable() {
+  if (!m_open_mode.has_value() || Mode::READ != *m_open_mode) {
+    throw std::logic_error("Zstd_file::is_seekable() - file not open for read");
+  }
+
+  if (!m_seekable.has_value()) {
+    m_seekable = load_seek_table();
+
+    if (!is_mmapped()) {
+      // restore the position in the underlying file
+      file()->seek(m_file_offset);
+    }
+  }
+
+  return *m_seekable;
+}
+
+off64_t Zstd_file::seek(off64_t offset) {
+  if (!m_open_mode.has_value() || Mode::READ != *m_open_mode ||
+      !is_seekable()) {
+    throw std::logic_error("Zstd_file::seek() - not supported");
+  }
+
+  uint64_t total = 0;
+
+  if (!m_frames.empty()) {
+    total = m_frames.back().decompressed_offset +
+            m_frames.back().decompressed_size;
+  }
+
+  const auto target =
+      std::min<uint64_t>(std::max<off64_t>(offset, 0), total);
+
+  // find the frame which holds the target offset
+  auto frame = std::upper_bound(
+      m_frames.begin(), m_frames.end(), target,
+      [](uint64_t o, const Frame &f) { return o < f.decompressed_offset; });
+  Frame start;
+
+  if (m_frames.begin() != frame) {
+    start = *(--frame);
+  }
+
+  file()->seek(start.compressed_offset);
+
+  m_buffer.clear();
+  m_file_offset = start.compressed_offset;
+  ZSTD_DCtx_reset(m_dctx, ZSTD_reset_session_only);
+  m_offset = start.decompressed_offset;
+
+  // decompress and discard data which precedes the target offset
+  if (m_offset < target) {
+    std::vector<uint8_t> discard(
+        std::min<uint64_t>(target - m_offset, CHUNK));
+
+    while (m_offset < target) {
+      const auto bytes = read(discard.data(), std::min<uint64_t>(
+                                                  target - m_offset,
+                                                  discard.size()));
+
+      if (bytes <= 0) {
+        throw std::runtime_error("zstd.seek: unexpected end of data");
+      }
+    }
+  }
+
+  return m_offset;
+}
+
+bool Zstd_file::load_seek_table() {
+  const uint64_t file_size = file()->file_size();
+
+  if (file_size < k_skippable_header_size + k_seek_table_footer_size) {
+    return false;
+  }
+
+  uint8_t footer[k_seek_table_footer_size];
+  read_raw(file_size - k_seek_table_footer_size, footer, sizeof(footer));
+
+  if (k_seekable_magic != read_le32(footer + 5) ||
+      (footer[4] & k_reserved_bits)) {
+    return false;
+  }
+
+  const uint64_t frames = read_le32(footer);
+  const auto entry_size =
+      k_seek_table_entry_size + ((footer[4] & k_checksum_flag) ? 4 : 0);
+  const auto table_size = k_skippable_header_size + frames * entry_size +
+                          k_seek_table_footer_size;
+
+  if (table_size > file_size) {
+    return false;
+  }
+
+  std::vector<uint8_t> table(table_size - k_seek_table_footer_size);
+  read_raw(file_size - table_size, table.data(), table.size());
+
+  if (k_skippable_frame_magic != read_le32(table.data()) ||
+      table_size - k_skippable_header_size != read_le32(table.data() + 4)) {
+    return false;
+  }
+
+  std::vector<Frame> result;
+  result.reserve(frames);
+  Frame frame;
+
+  for (uint64_t i = 0; i < frames; ++i) {
+    const auto entry =
+        table.data() + k_skippable_header_size + i * entry_size;
+
+    frame.compressed_size = read_le32(entry);
+    frame.decompressed_size = read_le32(entry + 4);
+
+    result.emplace_back(frame);
+
+    frame.compressed_offset += frame.compressed_size;
+    frame.decompressed_offset += frame.decompressed_size;
+  }
+
+  if (frame.compressed_offset != file_size - table_size) {
+    // seek table does not describe this file
+    return false;
+  }
+
+  m_frames = std::move(result);
+
+  return true;
+}
+
+void Zstd_file::read_raw(uint64_t offset, void *buffer, size_t length) {
+  if (is_mmapped()) {
+    // whole file is mapped, no need to change the current position
+    const auto mfile = static_cast<backend::File *>(file());
+    const auto base = mfile->mmap_will_read() - mfile->tell();
+    ::memcpy(buffer, base + offset, length);
+    return;
+  }
+
+  file()->seek(offset);
+
+  auto ptr = static_cast<char *>(buffer);
+
+  while (length > 0) {
+    const auto bytes = file()->read(ptr, length);
+
+    if (bytes <= 0) {
+      throw std::runtime_error("zstd.read: failed to read the seek table");
+    }
+
+    ptr += bytes;
+    length -= bytes;
+  }
+}
+
 void Zstd_file::init_write() {
   if (!m_cctx) {
     m_cctx = ZSTD_createCStream();
@@ -253,10 +562,24 @@ void Zstd_file::init_write() {
     }
     ZSTD_initCStream(m_cctx, m_clevel);
 
+    if (m_threads > 0) {
+      const auto status =
+          ZSTD_CCtx_setParameter(m_cctx, ZSTD_c_nbWorkers, m_threads);
+
+      if (ZSTD_isError(status)) {
+        log_warning(
+            "zstd: could not enable multithreaded compression, using a single "
+            "thread: %s",
+            ZSTD_getErrorName(status));
+        m_threads = 0;
+      }
+    }
+
     auto *mfile = dynamic_cast<backend::File *>(file());
 
-    // try to enable mmap if available
-    if (mfile && mfile->mmap_will_write(0, nullptr)) {
+    // try to enable mmap if available, compression threads can flush more data
+    // at once than the mmapped region is able to hold, mmap is not used then
+    if (0 == m_threads && mfile && mfile->mmap_will_write(0, nullptr)) {
       log_debug("mmap() enabled for file %s",
                 mfile->full_path().masked().c_str());
       m_write_f = &Zstd_file::do_write_mmap;
@@ -305,6 +628,10 @@ void Zstd_file::open(Mode m) {
 
   m_open_mode = m;
   m_offset = 0;
+  m_current_frame = {};
+  m_frames.clear();
+  m_seekable.reset();
+  m_file_offset = 0;
 }
 
 bool Zstd_file::is_open() const {
@@ -356,6 +683,29 @@ void Zstd_file::parse_compression_options(const Compression_options &options,
         throw std::invalid_argument("Invalid compression level for zstd: " +
                                     opt.second);
       if (out) out->m_clevel = level;
+    } else if (opt.first == "frameSize") {
+      size_t size = 0;
+
+      try {
+        size = mysqlshdk::utils::expand_to_bytes(opt.second);
+      } catch (...) {
+      }
+
+      if (0 == size || size > k_max_frame_size)
+        throw std::invalid_argument("Invalid frame size for zstd: " +
+                                    opt.second);
+      if (out) out->m_frame_size = size;
+    } else if (opt.first == "threads") {
+      int threads;
+      try {
+        threads = std::stoi(opt.second);
+      } catch (...) {
+        threads = -1;
+      }
+      if (threads < 0 || threads > k_max_threads)
+        throw std::invalid_argument(
+            "Invalid number of compression threads for zstd: " + opt.second);
+      if (out) out->m_threads = threads;
     } else {
       throw std::invalid_argument("Invalid compression option for zstd: " +
                                   opt.first);
@@ -61,9 +61,15 @@ class Zstd_file : public Compressed_file {
   bool is_open() const override;
   void close() override;
 
-  off64_t seek(off64_t) override {
-    throw std::logic_error("Zstd_file::seek() - not supported");
-  }
+  /**
+   * Moves the read position to the given uncompressed offset.
+   *
+   * This is only supported in READ mode, if file was written using the
+   * seekable format (see the 'frameSize' compression option).
+   *
+   * @throws std::logic_error if file is not seekable
+   */
+  off64_t seek(off64_t offset) override;
 
   off64_t tell() const override { return m_offset; }
 
@@ -75,7 +81,23 @@ class Zstd_file : public Compressed_file {
   static void parse_compression_options(const Compression_options &options,
                                         Zstd_file *out);
 
+  /**
+   * Checks if file was written using the seekable format, this requires the
+   * file to be open in the READ mode.
+   */
+  bool is_seekable();
+
  private:
+  /**
+   * Describes a single frame of a file written using the seekable format.
+   */
+  struct Frame {
+    uint64_t compressed_offset = 0;
+    uint64_t decompressed_offset = 0;
+    uint32_t compressed_size = 0;
+    uint32_t decompressed_size = 0;
+  };
+
   struct Buf_view {
     uint8_t *ptr;
     size_t length;
@@ -107,6 +129,18 @@ class Zstd_file : public Compressed_file {
   void init_write();
   void write_finish();
 
+  bool is_mmapped() const {
+    return &Zstd_file::do_read_mmap == m_read_f ||
+           &Zstd_file::do_write_mmap == m_write_f;
+  }
+
+  void end_frame();
+  void write_seek_table();
+  void write_raw(const void *buffer, size_t length);
+
+  bool load_seek_table();
+  void read_raw(uint64_t offset, void *buffer, size_t length);
+
   void do_close();
 
   ssize_t do_write(ZSTD_inBuffer *ibuf, ZSTD_EndDirective op);
@@ -123,9 +157,22 @@ class Zstd_file : public Compressed_file {
   ZSTD_CStream *m_cctx = nullptr;
   ZSTD_DStream *m_dctx = nullptr;
   int m_clevel = 1;
+  // number of background compression threads, compression is done in the
+  // calling thread if this is 0
+  int m_threads = 0;
   std::vector<uint8_t> m_buffer;
   size_t m_decompress_read_size = 0;
   std::optional<Mode> m_open_mode;
+
+  // seekable format, frames are not split if this is 0
+  size_t m_frame_size = 0;
+  // frame which is currently being written
+  Frame m_current_frame;
+  // frames written so far or frames read from the seek table
+  std::vector<Frame> m_frames;
+  std::optional<bool> m_seekable;
+  // offset in the underlying file, used if it's not mmapped
+  uint64_t m_file_offset = 0;
 };
 
 }  // namespace compression
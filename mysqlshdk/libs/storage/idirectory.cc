@@ -79,6 +79,11 @@ std::unique_ptr<IFile> IDirectory::file(const std::string &name,
   return make_file(join_path(full_path().real(), name), options);
 }
 
+std::unordered_set<IDirectory::File_info> IDirectory::list_files_incremental(
+    bool hidden_files) const {
+  return list_files(hidden_files);
+}
+
 std::set<IDirectory::File_info> IDirectory::list_files_sorted(
     bool hidden_files) const {
   return sort(list_files(hidden_files));
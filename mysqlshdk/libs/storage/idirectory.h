@@ -119,6 +119,19 @@ class IDirectory {
   virtual std::unordered_set<File_info> list_files(
       bool hidden_files = false) const = 0;
 
+  /**
+   * Lists files in this directory, reusing the results of the previous
+   * listings. Backends which support it fetch only the files which follow
+   * (in lexicographical order) the last file listed so far, files added
+   * before it are not reported until list_files() is called.
+   *
+   * Default implementation lists all files.
+   *
+   * @returns All files in this directory which were found so far.
+   */
+  virtual std::unordered_set<File_info> list_files_incremental(
+      bool hidden_files = false) const;
+
   /**
    * Lists all files in this directory in sorted order.
    *
@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/storage/pipelined_file.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/libs/storage/compressed_file.h"
+#include "mysqlshdk/libs/storage/idirectory.h"
+
+namespace mysqlshdk {
+namespace storage {
+
+Pipelined_file::Pipelined_file(std::unique_ptr<IFile> file,
+                               std::size_t block_size, std::size_t max_pending)
+    : m_file(std::move(file)),
+      m_compressed(dynamic_cast<Compressed_file *>(m_file.get())),
+      m_block_size(block_size),
+      m_max_pending(max_pending) {
+  if (!m_file) {
+    throw std::invalid_argument("Pipelined_file: file is missing");
+  }
+
+  if (0 == m_block_size) {
+    throw std::invalid_argument("Pipelined_file: block size cannot be 0");
+  }
+
+  if (0 == m_max_pending) {
+    throw std::invalid_argument(
+        "Pipelined_file: need at least one pending block");
+  }
+}
+
+Pipelined_file::~Pipelined_file() {
+  if (m_worker.joinable()) {
+    // file was not closed, data which was not written yet is lost, wrapped
+    // file is handled by its own destructor
+    stop(true);
+  }
+}
+
+void Pipelined_file::open(Mode m) {
+  if (Mode::READ == m) {
+    throw std::invalid_argument(
+        "Pipelined_file: only WRITE and APPEND modes are supported");
+  }
+
+  m_file->open(m);
+
+  m_stop = false;
+  m_has_exception = false;
+  m_worker_exception = nullptr;
+  m_block.reserve(m_block_size);
+
+  m_worker = mysqlsh::spawn_scoped_thread([this]() { run(); });
+}
+
+void Pipelined_file::close() {
+  if (m_worker.joinable()) {
+    try {
+      hand_off();
+      wait_for_pending();
+    } catch (...) {
+      // data was not fully written, wrapped file is left as is
+      stop(true);
+      throw;
+    }
+
+    stop(false);
+  }
+
+  m_file->close();
+}
+
+size_t Pipelined_file::file_size() const {
+  if (m_worker.joinable()) {
+    wait_for_pending();
+  }
+
+  return m_file->file_size();
+}
+
+ssize_t Pipelined_file::write(const void *buffer, size_t length) {
+  handle_exception();
+
+  auto data = static_cast<const char *>(buffer);
+  auto remaining = length;
+
+  while (remaining > 0) {
+    const auto bytes = std::min(remaining, m_block_size - m_block.size());
+
+    m_block.append(data, bytes);
+
+    data += bytes;
+    remaining -= bytes;
+
+    if (m_block.size() >= m_block_size) {
+      hand_off();
+    }
+  }
+
+  return static_cast<ssize_t>(length);
+}
+
+bool Pipelined_file::flush() {
+  hand_off();
+  wait_for_pending();
+
+  return m_file->flush();
+}
+
+std::unique_ptr<IDirectory> Pipelined_file::parent() const {
+  return m_file->parent();
+}
+
+void Pipelined_file::rename(const std::string &new_name) {
+  m_file->rename(new_name);
+}
+
+void Pipelined_file::remove() {
+  if (m_worker.joinable()) {
+    stop(true);
+    m_file->close();
+  }
+
+  m_file->remove();
+}
+
+void Pipelined_file::run() {
+  try {
+    while (true) {
+      std::string block;
+
+      {
+        auto l = lock();
+        m_cv.wait(l, [this]() { return m_stop || !m_pending.empty(); });
+
+        if (m_pending.empty()) {
+          // stopped
+          break;
+        }
+
+        block = std::move(m_pending.front());
+        m_pending.pop_front();
+        m_writing = true;
+      }
+
+      auto data = block.data();
+      auto remaining = block.size();
+      uint64_t bytes_written = 0;
+
+      while (remaining > 0) {
+        const auto bytes = m_file->write(data, remaining);
+
+        if (bytes <= 0) {
+          throw std::runtime_error("Failed to write '" +
+                                   full_path().masked() +
+                                   "', error: " + std::to_string(error()));
+        }
+
+        bytes_written += m_compressed ? m_compressed->latest_io_size() : bytes;
+        data += bytes;
+        remaining -= bytes;
+      }
+
+      m_bytes_written += bytes_written;
+
+      block.clear();
+
+      {
+        const auto l = lock();
+        m_free.emplace_back(std::move(block));
+        m_writing = false;
+      }
+
+      m_cv.notify_all();
+    }
+  } catch (...) {
+    {
+      const auto l = lock();
+      m_worker_exception = std::current_exception();
+      m_has_exception = true;
+      m_writing = false;
+    }
+
+    m_cv.notify_all();
+  }
+}
+
+void Pipelined_file::hand_off() {
+  if (m_block.empty()) {
+    handle_exception();
+    return;
+  }
+
+  {
+    auto l = lock();
+    m_cv.wait(l, [this]() {
+      return m_has_exception || m_pending.size() < m_max_pending;
+    });
+
+    if (m_has_exception) {
+      std::rethrow_exception(m_worker_exception);
+    }
+
+    m_pending.emplace_back(std::move(m_block));
+
+    if (m_free.empty()) {
+      m_block = std::string();
+    } else {
+      m_block = std::move(m_free.back());
+      m_free.pop_back();
+    }
+  }
+
+  m_cv.notify_all();
+
+  m_block.reserve(m_block_size);
+}
+
+void Pipelined_file::wait_for_pending() const {
+  auto l = lock();
+  m_cv.wait(l, [this]() {
+    return m_has_exception || (m_pending.empty() && !m_writing);
+  });
+
+  if (m_has_exception) {
+    std::rethrow_exception(m_worker_exception);
+  }
+}
+
+void Pipelined_file::handle_exception() const {
+  if (m_has_exception) {
+    std::rethrow_exception(m_worker_exception);
+  }
+}
+
+void Pipelined_file::stop(bool discard) {
+  {
+    const auto l = lock();
+
+    if (discard) {
+      m_pending.clear();
+    }
+
+    m_stop = true;
+  }
+
+  m_cv.notify_all();
+  m_worker.join();
+
+  m_block.clear();
+  m_free.clear();
+}
+
+}  // namespace storage
+}  // namespace mysqlshdk
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_STORAGE_PIPELINED_FILE_H_
+#define MYSQLSHDK_LIBS_STORAGE_PIPELINED_FILE_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "mysqlshdk/libs/storage/ifile.h"
+
+namespace mysqlshdk {
+namespace storage {
+
+class Compressed_file;
+
+/**
+ * Writes to the wrapped file in a background thread, only for writing.
+ *
+ * Data passed to write() is copied to blocks, full blocks are handed off to
+ * the background thread, so that the caller can prepare the next portion of
+ * data while the previous one is being written (i.e. compressed or uploaded).
+ * Number of pending blocks is limited, write() waits if this limit is reached.
+ *
+ * Errors reported by the background thread are rethrown by the subsequent call
+ * to write(), flush() or close().
+ */
+class Pipelined_file final : public IFile {
+ public:
+  static constexpr std::size_t k_default_block_size = 256 * 1024;
+  static constexpr std::size_t k_default_max_pending = 4;
+
+  Pipelined_file() = delete;
+
+  explicit Pipelined_file(std::unique_ptr<IFile> file,
+                          std::size_t block_size = k_default_block_size,
+                          std::size_t max_pending = k_default_max_pending);
+
+  Pipelined_file(const Pipelined_file &) = delete;
+  Pipelined_file(Pipelined_file &&) = delete;
+
+  Pipelined_file &operator=(const Pipelined_file &) = delete;
+  Pipelined_file &operator=(Pipelined_file &&) = delete;
+
+  ~Pipelined_file() override;
+
+  void open(Mode m) override;
+
+  bool is_open() const override { return m_file->is_open(); }
+
+  int error() const override { return m_file->error(); }
+
+  void close() override;
+
+  size_t file_size() const override;
+
+  Masked_string full_path() const override { return m_file->full_path(); }
+
+  std::string filename() const override { return m_file->filename(); }
+
+  bool exists() const override { return m_file->exists(); }
+
+  std::unique_ptr<IDirectory> parent() const override;
+
+  off64_t seek(off64_t) override {
+    throw std::logic_error("Pipelined_file::seek() - not supported");
+  }
+
+  off64_t tell() const override {
+    throw std::logic_error("Pipelined_file::tell() - not supported");
+  }
+
+  ssize_t read(void *, size_t) override {
+    throw std::logic_error("Pipelined_file::read() - not supported");
+  }
+
+  ssize_t write(const void *buffer, size_t length) override;
+
+  bool flush() override;
+
+  bool is_compressed() const override { return m_file->is_compressed(); }
+
+  bool is_local() const override { return m_file->is_local(); }
+
+  void rename(const std::string &new_name) override;
+
+  void remove() override;
+
+  IFile *file() const { return m_file.get(); }
+
+  /**
+   * Provides the number of bytes written so far by the wrapped file. If it is
+   * compressed, this is the number of compressed bytes.
+   */
+  uint64_t bytes_written() const { return m_bytes_written; }
+
+ private:
+  auto lock() const { return std::unique_lock{m_mutex}; }
+
+  void run();
+
+  void hand_off();
+
+  void wait_for_pending() const;
+
+  void handle_exception() const;
+
+  void stop(bool discard);
+
+  std::unique_ptr<IFile> m_file;
+  Compressed_file *m_compressed;
+  std::size_t m_block_size;
+  std::size_t m_max_pending;
+
+  // block which is currently being filled
+  std::string m_block;
+
+  std::thread m_worker;
+  mutable std::mutex m_mutex;
+  mutable std::condition_variable m_cv;
+  std::deque<std::string> m_pending;
+  std::vector<std::string> m_free;
+  bool m_writing = false;
+  bool m_stop = false;
+  std::atomic<bool> m_has_exception{false};
+  std::exception_ptr m_worker_exception;
+
+  std::atomic<uint64_t> m_bytes_written{0};
+};
+
+}  // namespace storage
+}  // namespace mysqlshdk
+
+#endif  // MYSQLSHDK_LIBS_STORAGE_PIPELINED_FILE_H_
@@ -32,6 +32,7 @@
 #include <unistd.h>
 #endif
 
+#include <bit>
 #include <deque>
 #include <string>
 #include <string_view>
@@ -39,6 +40,7 @@
 #include "mysqlshdk/include/scripting/type_info/custom.h"
 #include "mysqlshdk/include/scripting/type_info/generic.h"
 #include "mysqlshdk/include/scripting/types.h"
+#include "mysqlshdk/libs/utils/json_structural_index.h"
 #include "mysqlshdk/libs/utils/strformat.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 #include "mysqlshdk/shellcore/shell_console.h"
@@ -199,6 +201,77 @@ void Json_reader::parse_bom() {
   }
 }
 
+std::size_t Json_document_splitter::scan(const char *data,
+                                         std::size_t length) {
+  std::size_t last = std::string::npos;
+  std::size_t i = 0;
+
+  // full blocks are classified by the structural index, only the brackets
+  // which are outside of strings are visited
+  if (length >= Json_structural_index::k_block_size) {
+    Json_structural_index index{m_in_string, m_escape};
+    auto depth = m_depth;
+
+    for (; length - i >= Json_structural_index::k_block_size;
+         i += Json_structural_index::k_block_size) {
+      const auto [open, close] = index.next(data + i);
+
+      for (auto brackets = open | close; brackets; brackets &= brackets - 1) {
+        const auto bit = std::countr_zero(brackets);
+
+        if (open & (uint64_t{1} << bit)) {
+          ++depth;
+        } else if (depth > 0 && 0 == --depth) {
+          last = i + bit + 1;
+        }
+      }
+    }
+
+    m_depth = depth;
+    m_in_string = index.in_string();
+    m_escape = index.escaped();
+  }
+
+  // remaining bytes are processed one at a time, backslash escapes the next
+  // character also outside of a string, same as in Json_structural_index
+  for (; i < length; ++i) {
+    const auto c = data[i];
+
+    if (m_escape) {
+      m_escape = false;
+    } else if ('\\' == c) {
+      m_escape = true;
+    } else if (m_in_string) {
+      if ('"' == c) {
+        m_in_string = false;
+      }
+    } else {
+      switch (c) {
+        case '"':
+          m_in_string = true;
+          break;
+
+        case '{':
+        case '[':
+          ++m_depth;
+          break;
+
+        case '}':
+        case ']':
+          if (m_depth > 0 && 0 == --m_depth) {
+            last = i + 1;
+          }
+          break;
+
+        default:
+          break;
+      }
+    }
+  }
+
+  return last;
+}
+
 Document_parser::Document_parser(Buffered_input *input,
                                  const Document_reader_options &options,
                                  size_t depth, bool as_array,
@@ -865,7 +938,7 @@ void Json_document_parser::get_string(std::string *target,
         break;
 
       default:
-        get_char(target);
+        m_source->get_until_quote_or_backslash(target);
     }
   }
 
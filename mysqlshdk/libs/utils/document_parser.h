@@ -113,6 +113,32 @@ class Json_reader final : public Document_reader {
   void parse_bom();
 };
 
+/**
+ * Finds boundaries of the top-level JSON documents, without validating them.
+ * Used to split the input into chunks which can be parsed independently.
+ * Input is classified 64 bytes at a time using Json_structural_index.
+ */
+class Json_document_splitter final {
+ public:
+  /**
+   * Scans the next block of data, state is kept between the calls.
+   *
+   * @param data Block of data.
+   * @param length Length of the block.
+   *
+   * @return Offset (relative to the beginning of the block) of the first byte
+   *         after the last complete document found in this block, or
+   *         std::string::npos if the block does not contain an end of a
+   *         document.
+   */
+  std::size_t scan(const char *data, std::size_t length);
+
+ private:
+  std::size_t m_depth = 0;
+  bool m_in_string = false;
+  bool m_escape = false;
+};
+
 /**
  * Base class for standard JSON document generators.
  *
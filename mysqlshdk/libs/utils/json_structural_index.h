@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_UTILS_JSON_STRUCTURAL_INDEX_H_
+#define MYSQLSHDK_LIBS_UTILS_JSON_STRUCTURAL_INDEX_H_
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+#define JSON_STRUCTURAL_INDEX_SIMD
+#endif
+
+namespace shcore {
+
+/**
+ * Classifies JSON text 64 bytes at a time (similar to the stage 1 of
+ * simdjson), producing bit masks of the opening and closing brackets which are
+ * not a part of a string. The string and escape state is carried between the
+ * blocks.
+ *
+ * Bytes are compared using AVX2 (if enabled at compile time) or SSE2
+ * instructions, other platforms use a scalar loop to compute the masks. The
+ * escaped characters and the string ranges are then computed with bitwise
+ * arithmetic, without branching on the input.
+ *
+ * Input is not validated, a backslash outside of a string escapes the next
+ * character as well.
+ */
+class Json_structural_index final {
+ public:
+  static constexpr std::size_t k_block_size = 64;
+
+  struct Block {
+    // bit N is set if byte N of the block is '{' or '[' outside of a string
+    uint64_t open;
+    // bit N is set if byte N of the block is '}' or ']' outside of a string
+    uint64_t close;
+  };
+
+  Json_structural_index() = default;
+
+  /**
+   * Creates the index, resuming from the given state.
+   *
+   * @param in_string Whether next byte is inside of a string.
+   * @param escaped Whether next byte is escaped by a backslash.
+   */
+  Json_structural_index(bool in_string, bool escaped) noexcept
+      : m_in_string(in_string ? ~uint64_t{0} : 0), m_escaped(escaped ? 1 : 0) {}
+
+  Json_structural_index(const Json_structural_index &) = default;
+  Json_structural_index(Json_structural_index &&) = default;
+
+  Json_structural_index &operator=(const Json_structural_index &) = default;
+  Json_structural_index &operator=(Json_structural_index &&) = default;
+
+  ~Json_structural_index() = default;
+
+  /**
+   * Classifies the next block of k_block_size bytes.
+   */
+  inline Block next(const char *p) noexcept {
+    const auto masks = classify(p);
+    const auto escaped = next_escaped(masks.backslash);
+    const auto in_string = next_in_string(masks.quote & ~escaped);
+    // in valid JSON escaped characters are always inside of strings
+    const auto ignored = in_string | escaped;
+
+    return {masks.open & ~ignored, masks.close & ~ignored};
+  }
+
+  /**
+   * Whether the next byte to be classified is inside of a string.
+   */
+  bool in_string() const noexcept { return 0 != m_in_string; }
+
+  /**
+   * Whether the next byte to be classified is escaped by a backslash.
+   */
+  bool escaped() const noexcept { return 0 != m_escaped; }
+
+  /**
+   * Finds the first double quote or backslash in the given range.
+   *
+   * @returns pointer to the character, or end if not found
+   */
+  static const char *find_quote_or_backslash(const char *p,
+                                             const char *end) noexcept {
+#ifdef JSON_STRUCTURAL_INDEX_SIMD
+    for (; end - p >= 16; p += 16) {
+      const auto v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+      const auto m = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('"')),
+                                  _mm_cmpeq_epi8(v, _mm_set1_epi8('\\')));
+
+      if (const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(m))) {
+        return p + std::countr_zero(mask);
+      }
+    }
+#endif  // JSON_STRUCTURAL_INDEX_SIMD
+
+    for (; p != end; ++p) {
+      if ('"' == *p || '\\' == *p) {
+        return p;
+      }
+    }
+
+    return end;
+  }
+
+ private:
+  struct Masks {
+    uint64_t quote;
+    uint64_t backslash;
+    uint64_t open;
+    uint64_t close;
+  };
+
+#if defined(__AVX2__)
+  static inline Masks classify(const char *p) noexcept {
+    Masks masks;
+    masks.quote = 0;
+    masks.backslash = 0;
+    masks.open = 0;
+    masks.close = 0;
+
+    for (int i = 0; i < 2; ++i) {
+      const auto v =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + 32 * i));
+      // '[' | 0x20 == '{' and ']' | 0x20 == '}'
+      const auto b = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+      const auto shift = 32 * i;
+
+      masks.quote |= mask_32(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('"')))
+                     << shift;
+      masks.backslash |=
+          mask_32(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\\'))) << shift;
+      masks.open |= mask_32(_mm256_cmpeq_epi8(b, _mm256_set1_epi8('{')))
+                    << shift;
+      masks.close |= mask_32(_mm256_cmpeq_epi8(b, _mm256_set1_epi8('}')))
+                     << shift;
+    }
+
+    return masks;
+  }
+
+  static inline uint64_t mask_32(__m256i m) noexcept {
+    return static_cast<uint32_t>(_mm256_movemask_epi8(m));
+  }
+#elif defined(JSON_STRUCTURAL_INDEX_SIMD)
+  static inline Masks classify(const char *p) noexcept {
+    Masks masks;
+    masks.quote = 0;
+    masks.backslash = 0;
+    masks.open = 0;
+    masks.close = 0;
+
+    for (int i = 0; i < 4; ++i) {
+      const auto v =
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 16 * i));
+      // '[' | 0x20 == '{' and ']' | 0x20 == '}'
+      const auto b = _mm_or_si128(v, _mm_set1_epi8(0x20));
+      const auto shift = 16 * i;
+
+      masks.quote |= mask_16(_mm_cmpeq_epi8(v, _mm_set1_epi8('"'))) << shift;
+      masks.backslash |= mask_16(_mm_cmpeq_epi8(v, _mm_set1_epi8('\\')))
+                         << shift;
+      masks.open |= mask_16(_mm_cmpeq_epi8(b, _mm_set1_epi8('{'))) << shift;
+      masks.close |= mask_16(_mm_cmpeq_epi8(b, _mm_set1_epi8('}'))) << shift;
+    }
+
+    return masks;
+  }
+
+  static inline uint64_t mask_16(__m128i m) noexcept {
+    return static_cast<uint32_t>(_mm_movemask_epi8(m));
+  }
+#else   // !JSON_STRUCTURAL_INDEX_SIMD
+  static inline Masks classify(const char *p) noexcept {
+    Masks masks;
+    masks.quote = 0;
+    masks.backslash = 0;
+    masks.open = 0;
+    masks.close = 0;
+
+    for (std::size_t i = 0; i < k_block_size; ++i) {
+      const auto bit = uint64_t{1} << i;
+
+      switch (p[i]) {
+        case '"':
+          masks.quote |= bit;
+          break;
+
+        case '\\':
+          masks.backslash |= bit;
+          break;
+
+        case '{':
+        case '[':
+          masks.open |= bit;
+          break;
+
+        case '}':
+        case ']':
+          masks.close |= bit;
+          break;
+
+        default:
+          break;
+      }
+    }
+
+    return masks;
+  }
+#endif  // !JSON_STRUCTURAL_INDEX_SIMD
+
+  /**
+   * Computes the mask of characters escaped by a backslash, an escaped
+   * backslash does not escape the next character.
+   */
+  inline uint64_t next_escaped(uint64_t backslash) noexcept {
+    constexpr uint64_t k_odd_bits = 0xAAAAAAAAAAAAAAAAULL;
+
+    // an escaped backslash cannot start an escape sequence
+    const auto potential_escape = backslash & ~m_escaped;
+    // subtraction carries through each sequence of backslashes, the bit after
+    // the sequence is flipped depending on the parity of its length and start
+    const auto escape_and_terminal_code =
+        (((potential_escape << 1) | k_odd_bits) - potential_escape) ^
+        k_odd_bits;
+    const auto escaped = escape_and_terminal_code ^ (backslash | m_escaped);
+    const auto escape = escape_and_terminal_code & backslash;
+
+    m_escaped = escape >> 63;
+
+    return escaped;
+  }
+
+  /**
+   * Computes the mask of characters which are inside of strings (including
+   * the opening quote, excluding the closing one).
+   */
+  inline uint64_t next_in_string(uint64_t quote) noexcept {
+    // prefix XOR: each bit is a XOR of itself and all the preceding bits
+    quote ^= quote << 1;
+    quote ^= quote << 2;
+    quote ^= quote << 4;
+    quote ^= quote << 8;
+    quote ^= quote << 16;
+    quote ^= quote << 32;
+
+    const auto in_string = quote ^ m_in_string;
+
+    // all ones if the last byte is inside of a string
+    m_in_string = 0 - (in_string >> 63);
+
+    return in_string;
+  }
+
+  uint64_t m_in_string = 0;
+  uint64_t m_escaped = 0;
+};
+
+}  // namespace shcore
+
+#undef JSON_STRUCTURAL_INDEX_SIMD
+
+#endif  // MYSQLSHDK_LIBS_UTILS_JSON_STRUCTURAL_INDEX_H_
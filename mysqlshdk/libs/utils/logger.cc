@@ -39,10 +39,16 @@
 #endif  // !_WIN32
 
 #include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
 #include <filesystem>
 #include <ios>
 #include <map>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include <rapidjson/prettywriter.h>
 #include <rapidjson/stringbuffer.h>
@@ -66,6 +72,9 @@ namespace {
  *        g_output_format but also to the file system
  *
  * NOTE: m_mutex_hooks is locked while g_mutex is locked (check do_log)
+ *
+ * Asynchronous loggers do not use g_mutex to write to the log file, access to
+ * the file is serialized by Async_writer instead.
  */
 std::recursive_mutex g_mutex;
 std::string g_output_format;
@@ -125,6 +134,283 @@ std::string check_logfile_permissions(const std::string &filepath) {
 
 }  // namespace
 
+/**
+ * Backend of the asynchronous loggers.
+ *
+ * Each thread which logs has its own ring buffer, a single-producer,
+ * single-consumer queue of bytes. Formatted entries are copied to the ring of
+ * the calling thread without any locks and a background thread periodically
+ * drains all the rings, writing their contents to the log file with a single
+ * write and a single flush.
+ *
+ * Memory is bounded: if an entry does not fit in the ring of the calling
+ * thread, that thread drains all the rings itself and writes the entry
+ * directly, so entries of a single thread are always written in order. Entries
+ * of different threads may be interleaved differently than they were logged.
+ */
+class Logger::Async_writer final {
+ public:
+  explicit Async_writer(Logger *logger)
+      : m_logger(logger), m_id(++s_next_id) {
+    register_writer(this);
+    m_thread = std::thread([this]() { run(); });
+  }
+
+  Async_writer(const Async_writer &) = delete;
+  Async_writer(Async_writer &&) = delete;
+
+  Async_writer &operator=(const Async_writer &) = delete;
+  Async_writer &operator=(Async_writer &&) = delete;
+
+  ~Async_writer() {
+    unregister_writer(this);
+
+    {
+      std::lock_guard lock{m_wait_mutex};
+      m_stop = true;
+    }
+
+    m_wait.notify_one();
+    m_thread.join();
+
+    flush();
+
+    std::lock_guard lock{m_rings_mutex};
+
+    for (const auto &ring : m_rings) {
+      ring->close();
+    }
+  }
+
+  void write(std::string_view s) {
+    const auto r = ring();
+
+    if (r->push(s)) {
+      if (r->size() >= k_ring_capacity / 2 && !m_pending.exchange(true)) {
+        m_wait.notify_one();
+      }
+    } else {
+      // ring is full or entry is bigger than the whole ring, write everything
+      // that's queued and then this entry
+      std::lock_guard lock{m_write_mutex};
+      drain();
+      m_logger->write_to_file(s);
+    }
+  }
+
+  void flush() {
+    std::lock_guard lock{m_write_mutex};
+    drain();
+  }
+
+  static void flush_all() {
+    auto &w = writers();
+    std::lock_guard lock{w.mutex};
+
+    for (const auto writer : w.list) {
+      writer->flush();
+    }
+  }
+
+ private:
+  static constexpr std::size_t k_ring_capacity = 64 * 1024;
+
+  static constexpr auto k_write_interval = std::chrono::milliseconds(100);
+
+  class Ring final {
+   public:
+    Ring() : m_data(std::make_unique<char[]>(k_ring_capacity)) {}
+
+    // producer
+    bool push(std::string_view s) {
+      const auto tail = m_tail.load(std::memory_order_relaxed);
+      const auto head = m_head.load(std::memory_order_acquire);
+
+      if (k_ring_capacity - (tail - head) < s.size()) return false;
+
+      const auto offset = tail & k_mask;
+      const auto first = std::min(s.size(), k_ring_capacity - offset);
+
+      std::copy_n(s.data(), first, m_data.get() + offset);
+      std::copy_n(s.data() + first, s.size() - first, m_data.get());
+
+      m_tail.store(tail + s.size(), std::memory_order_release);
+
+      return true;
+    }
+
+    std::size_t size() const {
+      return m_tail.load(std::memory_order_acquire) -
+             m_head.load(std::memory_order_acquire);
+    }
+
+    // consumer
+    void pop_all(std::string *out) {
+      const auto head = m_head.load(std::memory_order_relaxed);
+      const auto tail = m_tail.load(std::memory_order_acquire);
+
+      if (head == tail) return;
+
+      const auto offset = head & k_mask;
+      const auto size = tail - head;
+      const auto first = std::min(size, k_ring_capacity - offset);
+
+      out->append(m_data.get() + offset, first);
+      out->append(m_data.get(), size - first);
+
+      m_head.store(tail, std::memory_order_release);
+    }
+
+    // the owning thread has exited, no more entries will be pushed
+    void detach() { m_detached.store(true, std::memory_order_release); }
+
+    bool detached() const { return m_detached.load(std::memory_order_acquire); }
+
+    // the writer was destroyed, this ring is no longer drained
+    void close() { m_closed.store(true, std::memory_order_release); }
+
+    bool closed() const { return m_closed.load(std::memory_order_acquire); }
+
+   private:
+    static_assert((k_ring_capacity & (k_ring_capacity - 1)) == 0,
+                  "Ring capacity has to be a power of two");
+    static constexpr std::size_t k_mask = k_ring_capacity - 1;
+
+    std::unique_ptr<char[]> m_data;
+    std::atomic<std::size_t> m_head{0};
+    std::atomic<std::size_t> m_tail{0};
+    std::atomic<bool> m_detached{false};
+    std::atomic<bool> m_closed{false};
+  };
+
+  // rings used by the current thread, keyed by the ID of the writer
+  struct Thread_rings final {
+    ~Thread_rings() {
+      for (const auto &ring : rings) {
+        ring.second->detach();
+      }
+    }
+
+    std::vector<std::pair<uint64_t, std::shared_ptr<Ring>>> rings;
+  };
+
+  Ring *ring() {
+    static thread_local Thread_rings t_rings;
+    auto &rings = t_rings.rings;
+
+    for (const auto &ring : rings) {
+      if (m_id == ring.first) return ring.second.get();
+    }
+
+    // writers are identified by a unique ID, rings of the ones which were
+    // destroyed can be released
+    rings.erase(
+        std::remove_if(rings.begin(), rings.end(),
+                       [](const auto &r) { return r.second->closed(); }),
+        rings.end());
+
+    auto ring = std::make_shared<Ring>();
+
+    {
+      std::lock_guard lock{m_rings_mutex};
+      m_rings.emplace_back(ring);
+    }
+
+    rings.emplace_back(m_id, ring);
+
+    return ring.get();
+  }
+
+  void run() {
+    std::unique_lock lock{m_wait_mutex};
+
+    while (!m_stop) {
+      // notification may be missed if it's sent right before waiting, but
+      // then the rings are drained when the timeout expires
+      m_wait.wait_for(lock, k_write_interval,
+                      [this]() { return m_stop || m_pending; });
+      m_pending = false;
+
+      lock.unlock();
+      flush();
+      lock.lock();
+    }
+  }
+
+  // m_write_mutex must be held
+  void drain() {
+    m_batch.clear();
+
+    {
+      std::lock_guard lock{m_rings_mutex};
+
+      for (auto it = m_rings.begin(); it != m_rings.end();) {
+        // check before draining, entries pushed before thread has exited
+        // are then guaranteed to be visible
+        const auto detached = (*it)->detached();
+
+        (*it)->pop_all(&m_batch);
+
+        if (detached) {
+          it = m_rings.erase(it);
+        } else {
+          ++it;
+        }
+      }
+    }
+
+    if (!m_batch.empty()) {
+      m_logger->write_to_file(m_batch);
+    }
+  }
+
+  struct Writers final {
+    std::mutex mutex;
+    std::vector<Async_writer *> list;
+  };
+
+  static Writers &writers() {
+    // never destroyed, loggers may outlive the static objects
+    static const auto s_writers = new Writers();
+    return *s_writers;
+  }
+
+  static void register_writer(Async_writer *writer) {
+    static std::once_flag s_at_exit;
+    std::call_once(s_at_exit, []() { std::atexit(&flush_all); });
+
+    auto &w = writers();
+    std::lock_guard lock{w.mutex};
+    w.list.emplace_back(writer);
+  }
+
+  static void unregister_writer(Async_writer *writer) {
+    auto &w = writers();
+    std::lock_guard lock{w.mutex};
+    w.list.erase(std::remove(w.list.begin(), w.list.end(), writer),
+                 w.list.end());
+  }
+
+  Logger *m_logger;
+  const uint64_t m_id;
+
+  std::thread m_thread;
+  std::mutex m_wait_mutex;
+  std::condition_variable m_wait;
+  bool m_stop = false;
+  std::atomic<bool> m_pending{false};
+
+  std::mutex m_rings_mutex;
+  std::list<std::shared_ptr<Ring>> m_rings;
+
+  std::mutex m_write_mutex;
+  std::string m_batch;
+
+  static std::atomic<uint64_t> s_next_id;
+};
+
+std::atomic<uint64_t> Logger::Async_writer::s_next_id{0};
+
 void Logger::attach_log_hook(Log_hook hook, void *user_data, bool catch_all) {
   if (hook) {
     std::lock_guard l{m_mutex_hooks};
@@ -233,22 +519,14 @@ void Logger::do_log(const Log_entry &entry) {
 
 void Logger::do_log(const std::shared_ptr<shcore::Logger> &logger,
                     const Log_entry &entry) {
-  std::lock_guard lg{g_mutex};
+  std::unique_lock lg{g_mutex, std::defer_lock};
 
-  if (entry.level <= logger->m_log_level) {
-#ifdef _WIN32
-    if (logger->m_log_file.is_open()) {
-      const auto s = format_message(entry);
-      logger->m_log_file.write(s.c_str(), s.length());
-      logger->m_log_file.flush();
-    }
-#else
-    if (logger->m_log_file) {
-      const auto s = format_message(entry);
-      fwrite(s.c_str(), s.length(), 1, logger->m_log_file);
-      fflush(logger->m_log_file);
-    }
-#endif
+  // asynchronous loggers do not write to the file system in this thread,
+  // hooks are serialized by m_mutex_hooks
+  if (!logger->is_async()) lg.lock();
+
+  if (entry.level <= logger->m_log_level && logger->has_log_file()) {
+    logger->write(format_message(entry));
   }
 
   std::lock_guard lh{logger->m_mutex_hooks};
@@ -372,12 +650,47 @@ std::string Logger::format_message(const Log_entry &entry) {
 
 std::shared_ptr<Logger> Logger::create_instance(const char *filename,
                                                 bool use_stderr,
-                                                LOG_LEVEL level) {
+                                                LOG_LEVEL level, bool async) {
   std::shared_ptr<Logger> log(new Logger(filename, use_stderr));
   log->set_log_level(level);
+
+  if (async && log->has_log_file()) {
+    log->m_async_writer = std::make_unique<Async_writer>(log.get());
+  }
+
   return log;
 }
 
+void Logger::flush() {
+  if (m_async_writer) m_async_writer->flush();
+}
+
+bool Logger::has_log_file() const {
+#ifdef _WIN32
+  return m_log_file.is_open();
+#else
+  return m_log_file != nullptr;
+#endif
+}
+
+void Logger::write(std::string_view s) {
+  if (m_async_writer) {
+    m_async_writer->write(s);
+  } else {
+    write_to_file(s);
+  }
+}
+
+void Logger::write_to_file(std::string_view s) {
+#ifdef _WIN32
+  m_log_file.write(s.data(), s.length());
+  m_log_file.flush();
+#else
+  fwrite(s.data(), s.length(), 1, m_log_file);
+  fflush(m_log_file);
+#endif
+}
+
 void Logger::log_to_stderr() {
   // attach hook only if not already logging to stderr
   if (!use_stderr()) {
@@ -433,6 +746,9 @@ Logger::Logger(const char *filename, bool use_stderr) : m_dont_log(0) {
 }
 
 Logger::~Logger() {
+  // writes all the queued entries
+  m_async_writer.reset();
+
 #ifdef _WIN32
   if (m_log_file.is_open()) {
     m_log_file.close();
@@ -113,9 +113,19 @@ class SHCORE_PUBLIC Logger final {
   static void log(LOG_LEVEL level, const char *format, ...);
 #endif
 
+  /**
+   * Creates a new logger.
+   *
+   * @param filename path to the log file, nullptr to not log to a file
+   * @param use_stderr whether log entries should be also printed to stderr
+   * @param level the initial log level
+   * @param async if true, entries are queued in per-thread buffers and
+   *        written to the log file in batches by a background thread
+   */
   static std::shared_ptr<Logger> create_instance(const char *filename,
                                                  bool use_stderr = false,
-                                                 LOG_LEVEL level = LOG_INFO);
+                                                 LOG_LEVEL level = LOG_INFO,
+                                                 bool async = false);
 
   static LOG_LEVEL parse_log_level(const std::string &tag);
 
@@ -129,6 +139,18 @@ class SHCORE_PUBLIC Logger final {
 
   bool use_stderr() const;
 
+  bool is_async() const { return m_async_writer != nullptr; }
+
+  /**
+   * Writes all the queued entries to the log file. Entries are always written
+   * immediately if the logger is not asynchronous, in such case this is a
+   * no-op.
+   *
+   * Asynchronous loggers are also flushed when they are destroyed and when
+   * the process exits via exit().
+   */
+  void flush();
+
   void push_context(std::string context) {
     std::lock_guard l{m_mutex_log_ctx};
     m_log_context.push_back(std::move(context));
@@ -149,6 +171,8 @@ class SHCORE_PUBLIC Logger final {
   }
 
  private:
+  class Async_writer;
+
   Logger(const char *filename, bool use_stderr);
 
   static void out_to_stderr(const Log_entry &entry, void *);
@@ -165,6 +189,12 @@ class SHCORE_PUBLIC Logger final {
 
   bool will_log(LOG_LEVEL level) const;
 
+  bool has_log_file() const;
+
+  void write(std::string_view s);
+
+  void write_to_file(std::string_view s);
+
   std::atomic<LOG_LEVEL> m_log_level{LOG_NONE};
 
 #ifdef _WIN32
@@ -174,6 +204,8 @@ class SHCORE_PUBLIC Logger final {
 #endif
   std::string m_log_file_name;
 
+  std::unique_ptr<Async_writer> m_async_writer;
+
   mutable std::mutex m_mutex_hooks;
   std::list<std::tuple<Log_hook, void *, bool>> m_hook_list;
   std::list<std::tuple<Log_level_hook, void *>> m_level_hook_list;
@@ -290,29 +290,44 @@ std::string create_key_pair(const std::string &path,
 }
 
 std::vector<unsigned char> sha256(const char *data, size_t size) {
-  EVP_MD_CTX_ptr mctx(EVP_MD_CTX_new(), ::EVP_MD_CTX_free);
-  const EVP_MD *md = EVP_sha256();
-  int r = EVP_DigestInit_ex(mctx.get(), md, nullptr);
-  if (r != 1) {
+  Sha256 hash;
+  hash.update(data, size);
+  return hash.finish();
+}
+
+Sha256::Sha256() : m_ctx(EVP_MD_CTX_new(), ::EVP_MD_CTX_free) {
+  if (!m_ctx) {
+    throw std::runtime_error("SHA256: error creating the context.");
+  }
+
+  init();
+}
+
+void Sha256::init() {
+  if (1 != EVP_DigestInit_ex(m_ctx.get(), EVP_sha256(), nullptr)) {
     throw std::runtime_error("SHA256: error initializing encoder.");
   }
+}
 
-  r = EVP_DigestUpdate(mctx.get(), data, size);
-  if (r != 1) {
+void Sha256::update(const char *data, size_t size) {
+  if (1 != EVP_DigestUpdate(m_ctx.get(), data, size)) {
     throw std::runtime_error("SHA256: error while encoding data.");
   }
+}
 
+std::vector<unsigned char> Sha256::finish() {
   std::vector<unsigned char> md_value;
   unsigned int md_len = EVP_MAX_MD_SIZE;
   md_value.resize(md_len);
 
-  r = EVP_DigestFinal_ex(mctx.get(), md_value.data(), &md_len);
-  if (r != 1) {
+  if (1 != EVP_DigestFinal_ex(m_ctx.get(), md_value.data(), &md_len)) {
     throw std::runtime_error("SHA256: error completing encode operation.");
   }
 
   md_value.resize(md_len);
 
+  init();
+
   return md_value;
 }
 
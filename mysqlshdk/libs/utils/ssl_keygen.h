@@ -26,10 +26,14 @@
 #ifndef MYSQLSHDK_LIBS_UTILS_SSL_KEYGEN_H_
 #define MYSQLSHDK_LIBS_UTILS_SSL_KEYGEN_H_
 
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <vector>
 
+// EVP_MD_CTX
+struct evp_md_ctx_st;
+
 namespace shcore {
 namespace ssl {
 /**
@@ -104,6 +108,35 @@ std::string private_key_fingerprint(const std::string &path);
  */
 std::vector<unsigned char> sha256(const char *data, size_t size);
 
+/**
+ * Computes SHA256 hash incrementally, as the data becomes available.
+ */
+class Sha256 final {
+ public:
+  Sha256();
+
+  Sha256(const Sha256 &) = delete;
+  Sha256(Sha256 &&) = default;
+
+  Sha256 &operator=(const Sha256 &) = delete;
+  Sha256 &operator=(Sha256 &&) = default;
+
+  ~Sha256() = default;
+
+  void update(const char *data, size_t size);
+
+  /**
+   * Provides hash of all the data passed so far, and starts a new
+   * computation.
+   */
+  std::vector<unsigned char> finish();
+
+ private:
+  void init();
+
+  std::unique_ptr<evp_md_ctx_st, void (*)(evp_md_ctx_st *)> m_ctx;
+};
+
 std::vector<unsigned char> hmac_sha256(const std::vector<unsigned char> &key,
                                        const std::string &data);
 
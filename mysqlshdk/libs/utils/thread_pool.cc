@@ -33,7 +33,8 @@ Thread_pool::Thread_pool(uint64_t threads)
     : m_threads(threads),
       m_active_threads(threads),
       m_workers(threads),
-      m_worker_exceptions(threads) {}
+      m_worker_exceptions(threads),
+      m_worker_tasks(threads) {}
 
 Thread_pool::~Thread_pool() {
   kill_threads();
@@ -46,7 +47,7 @@ void Thread_pool::start_threads() {
         [this](auto id) {
           try {
             while (true) {
-              auto task = m_worker_tasks.pop();
+              auto task = m_worker_tasks.pop(id);
 
               if (m_worker_interrupt) {
                 return;
@@ -35,12 +35,16 @@
 #include <vector>
 
 #include "mysqlshdk/libs/utils/synchronized_queue.h"
+#include "mysqlshdk/libs/utils/work_stealing_queue.h"
 
 namespace shcore {
 
 /**
  * A pool of threads which allows to execute an operation in a pool, and
  * process the result of that operation in the calling thread.
+ *
+ * Each thread has its own queue of operations, idle threads steal operations
+ * from the queues of other threads.
  */
 class Thread_pool final {
  public:
@@ -166,7 +170,7 @@ class Thread_pool final {
 
   volatile bool m_all_tasks_pushed = false;
 
-  Synchronized_queue<Task> m_worker_tasks;
+  Work_stealing_queue<Task> m_worker_tasks;
 
   Synchronized_queue<std::function<void()>> m_main_thread_tasks;
 
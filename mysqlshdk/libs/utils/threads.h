@@ -26,8 +26,11 @@
 #ifndef MYSQLSHDK_LIBS_UTILS_THREADS_H_
 #define MYSQLSHDK_LIBS_UTILS_THREADS_H_
 
+#include <algorithm>
 #include <atomic>
 #include <functional>
+#include <iterator>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <utility>
@@ -79,6 +82,60 @@ OutputT map_reduce(InputIter begin, InputIter end, MapF map, ReduceF reduce) {
   return result;
 }
 
+/**
+ * Same as above, but uses at most the given number of threads, which fetch the
+ * values from the list until it's exhausted.
+ *
+ * map is not expected to throw.
+ */
+template <class OutputT, class IntermediateT, class InputIter, class MapF,
+          class ReduceF>
+OutputT map_reduce(InputIter begin, InputIter end, MapF map, ReduceF reduce,
+                   std::size_t max_threads) {
+  shcore::Synchronized_queue<IntermediateT> results;
+  std::vector<std::thread> workers;
+  std::mutex mutex;
+  auto next = begin;
+
+  const auto count = static_cast<std::size_t>(std::distance(begin, end));
+  const auto threads = std::min(count, std::max<std::size_t>(max_threads, 1));
+
+  // start computation in threads
+  for (std::size_t i = 0; i < threads; ++i) {
+    workers.push_back(
+        mysqlsh::spawn_scoped_thread([&results, &mutex, &next, end, map]() {
+          while (true) {
+            InputIter iter;
+
+            {
+              std::lock_guard lock{mutex};
+
+              if (next == end) {
+                break;
+              }
+
+              iter = next++;
+            }
+
+            results.push(map(*iter));
+          }
+        }));
+  }
+
+  // wait for all the results
+  auto result = OutputT();
+
+  for (std::size_t i = 0; i < count; ++i) {
+    result = reduce(result, results.pop());
+  }
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  return result;
+}
+
 }  // namespace utils
 }  // namespace mysqlshdk
 
@@ -34,9 +34,12 @@
 #include <unistd.h>
 #endif
 
+#include <algorithm>
 #include <deque>
 #include <string>
 
+#include "mysqlshdk/libs/utils/json_structural_index.h"
+
 namespace shcore {
 
 void Buffered_input::open(const std::string &filepath_) {
@@ -53,6 +56,27 @@ void Buffered_input::open(const std::string &filepath_) {
   }
 }
 
+void Buffered_input::open(const std::string &filepath_, size_t offset,
+                          size_t length) {
+  open(filepath_);
+
+#ifdef _WIN32
+  const auto result = ::_lseeki64(m_fd, offset, SEEK_SET);
+#else
+  const auto result = ::lseek(m_fd, offset, SEEK_SET);
+#endif
+
+  if (result < 0) {
+    int err = errno;
+    throw std::runtime_error(filepath_ + ": " + errno_to_string(err) +
+                             " (error code " + std::to_string(err) + ")");
+  }
+
+  // offsets reported to the user are relative to the beginning of the file
+  m_bytes_processed = offset;
+  m_bytes_remaining = length;
+}
+
 void Buffered_input::close() {
   if (m_fd > 0) {
 #ifdef _WIN32
@@ -79,23 +103,47 @@ std::string Buffered_input::get_double_quoted_string() {
         return s;
 
       default:
-        s += get();
+        get_until_quote_or_backslash(&s);
     }
   }
 
   throw std::out_of_range("Incomplete quoted string");
 }
 
+void Buffered_input::get_until_quote_or_backslash(std::string *target) {
+  while (!eof()) {
+    if (m_pos == m_end) {
+      fill_buffer();
+      continue;
+    }
+
+    const auto begin = reinterpret_cast<const char *>(m_pos);
+    const auto end = reinterpret_cast<const char *>(m_end);
+    const auto found =
+        Json_structural_index::find_quote_or_backslash(begin, end);
+    const auto length = static_cast<std::size_t>(found - begin);
+
+    target->append(begin, length);
+    m_pos += length;
+    m_bytes_processed += length;
+
+    if (found != end) {
+      return;
+    }
+  }
+}
+
 void Buffered_input::fill_buffer() {
   if (m_eof) {
     return;
   }
 
   m_pos = m_buffer;
+  const auto to_read = std::min(BUFFER_SIZE, m_bytes_remaining);
 #ifdef _WIN32
-  int bytes = ::_read(m_fd, m_buffer, BUFFER_SIZE);
+  int bytes = ::_read(m_fd, m_buffer, static_cast<unsigned int>(to_read));
 #else
-  ssize_t bytes = ::read(m_fd, m_buffer, BUFFER_SIZE);
+  ssize_t bytes = ::read(m_fd, m_buffer, to_read);
 #endif
 
   if (bytes < 0) {
@@ -103,6 +151,7 @@ void Buffered_input::fill_buffer() {
   }
 
   m_end = m_buffer + bytes;
+  m_bytes_remaining -= bytes;
 
   if (m_pos == m_end) {
     m_eof = true;
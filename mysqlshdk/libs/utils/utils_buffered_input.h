@@ -27,6 +27,7 @@
 #define MYSQLSHDK_LIBS_UTILS_UTILS_BUFFERED_INPUT_H_
 
 #include <string.h>
+#include <limits>
 #include <string>
 
 #include "mysqlshdk/libs/utils/utils_general.h"
@@ -53,6 +54,15 @@ class Buffered_input {
 
   void open(const std::string &filepath_);
 
+  /**
+   * Opens the file, reads only the given range of bytes.
+   *
+   * @param filepath_ Path to the file.
+   * @param offset Offset of the first byte to be read.
+   * @param length Number of bytes to be read.
+   */
+  void open(const std::string &filepath_, size_t offset, size_t length);
+
   bool eof() { return m_eof; }
 
   byte peek() {
@@ -83,6 +93,12 @@ class Buffered_input {
 
   std::string get_double_quoted_string();
 
+  /**
+   * Appends all the bytes up to (but not including) the first double quote or
+   * backslash to the given string. Stops at the end of input.
+   */
+  void get_until_quote_or_backslash(std::string *target);
+
  private:
   void close();
 
@@ -95,6 +111,7 @@ class Buffered_input {
   byte *m_pos = m_buffer;
   byte *m_end = m_buffer;
   size_t m_bytes_processed = 0;
+  size_t m_bytes_remaining = std::numeric_limits<size_t>::max();
 };
 
 }  // namespace shcore
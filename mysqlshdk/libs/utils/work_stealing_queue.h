@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef MYSQLSHDK_LIBS_UTILS_WORK_STEALING_QUEUE_H_
+#define MYSQLSHDK_LIBS_UTILS_WORK_STEALING_QUEUE_H_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "mysqlshdk/libs/utils/synchronized_queue.h"
+
+namespace shcore {
+
+/**
+ * Multiple producer, multiple consumer queue, where each consumer (worker) has
+ * its own queue. Workers take tasks from their own queue first, and steal
+ * tasks from the other queues once theirs is empty. Compared to the
+ * Synchronized_queue, this reduces the contention when many threads are used.
+ *
+ * Tasks with a higher priority are taken first, regardless of the queue they
+ * were added to. Tasks with the same priority are taken in the FIFO order
+ * from a single queue, but there's no ordering guarantee between queues.
+ */
+template <class T>
+class Work_stealing_queue final {
+ public:
+  Work_stealing_queue() = delete;
+
+  /**
+   * Creates the queue.
+   *
+   * @param workers Number of workers which are going to consume the tasks.
+   */
+  explicit Work_stealing_queue(std::size_t workers)
+      : m_lanes(std::max<std::size_t>(1, workers)) {}
+
+  Work_stealing_queue(const Work_stealing_queue &other) = delete;
+  Work_stealing_queue(Work_stealing_queue &&other) = delete;
+
+  Work_stealing_queue &operator=(const Work_stealing_queue &other) = delete;
+  Work_stealing_queue &operator=(Work_stealing_queue &&other) = delete;
+
+  ~Work_stealing_queue() = default;
+
+  /**
+   * Adds a task, tasks are distributed among the workers in a round-robin
+   * fashion.
+   */
+  template <class U = T>
+  void push(U &&r, Queue_priority p = Queue_priority::MEDIUM) {
+    push_local(m_next_lane++, std::forward<U>(r), p);
+  }
+
+  /**
+   * Adds a task to the queue of the given worker, i.e. a task created by that
+   * worker.
+   */
+  template <class U = T>
+  void push_local(std::size_t worker, U &&r,
+                  Queue_priority p = Queue_priority::MEDIUM) {
+    const auto q = index(p);
+    auto &lane = m_lanes[worker % m_lanes.size()];
+
+    {
+      std::lock_guard<std::mutex> lock(lane.mutex);
+      lane.queues[q].emplace_back(std::forward<U>(r));
+      ++lane.sizes[q];
+      ++m_sizes[q];
+      ++m_size;
+    }
+
+    if (m_sleeping > 0) {
+      // synchronize with a worker which is about to wait
+      { std::lock_guard<std::mutex> lock(m_park_mutex); }
+      m_task_ready.notify_one();
+    }
+  }
+
+  /**
+   * Takes a task with the highest priority, starting with the queue of the
+   * given worker. Blocks if there are no tasks.
+   *
+   * @param worker ID of the worker, in range [0, workers).
+   *
+   * @returns a task, or T() if queue was shut down and there are no more tasks
+   */
+  T pop(std::size_t worker) {
+    std::size_t attempts = 0;
+
+    while (true) {
+      if (auto task = try_pop(worker)) {
+        return std::move(*task);
+      }
+
+      if (consume_shutdown()) {
+        return T();
+      }
+
+      if (++attempts < k_spin_count) {
+        // new tasks are usually added shortly, avoid the cost of waking up
+        std::this_thread::yield();
+        continue;
+      }
+
+      attempts = 0;
+
+      std::unique_lock<std::mutex> lock(m_park_mutex);
+      ++m_sleeping;
+      m_task_ready.wait(lock, [this]() { return m_size > 0 || m_shutdown > 0; });
+      --m_sleeping;
+    }
+  }
+
+  /**
+   * Takes a task with the highest priority, starting with the queue of the
+   * given worker. Does not block.
+   */
+  std::optional<T> try_pop(std::size_t worker) {
+    const auto lanes = m_lanes.size();
+    worker %= lanes;
+
+    for (std::size_t q = 0; q < k_priorities; ++q) {
+      if (0 == m_sizes[q]) {
+        continue;
+      }
+
+      for (std::size_t i = 0; i < lanes; ++i) {
+        if (auto task = try_pop(&m_lanes[(worker + i) % lanes], q)) {
+          return task;
+        }
+      }
+    }
+
+    return {};
+  }
+
+  /**
+   * Notifies n workers that they should stop, they are going to receive T()
+   * once all the remaining tasks are taken.
+   *
+   * @param n number of consumer threads.
+   */
+  void shutdown(int64_t n) {
+    {
+      std::lock_guard<std::mutex> lock(m_park_mutex);
+      m_shutdown += n;
+    }
+    m_task_ready.notify_all();
+  }
+
+  size_t size() const { return m_size; }
+
+ private:
+  static constexpr std::size_t k_spin_count = 16;
+
+  static constexpr std::size_t k_priorities =
+      static_cast<std::size_t>(Queue_priority::HIGH);
+
+  // queues are ordered from the highest to the lowest priority
+  static constexpr std::size_t index(Queue_priority p) {
+    return k_priorities - static_cast<std::size_t>(p);
+  }
+
+  // lanes are accessed by different threads, avoid false sharing
+  struct alignas(64) Lane {
+    std::mutex mutex;
+    std::array<std::deque<T>, k_priorities> queues;
+    std::array<std::atomic<std::size_t>, k_priorities> sizes{};
+  };
+
+  std::optional<T> try_pop(Lane *lane, std::size_t q) {
+    if (0 == lane->sizes[q]) {
+      return {};
+    }
+
+    std::lock_guard<std::mutex> lock(lane->mutex);
+    auto &queue = lane->queues[q];
+
+    if (queue.empty()) {
+      return {};
+    }
+
+    std::optional<T> task = std::move(queue.front());
+    queue.pop_front();
+    --lane->sizes[q];
+    --m_sizes[q];
+    --m_size;
+
+    return task;
+  }
+
+  bool consume_shutdown() {
+    auto shutdown = m_shutdown.load();
+
+    while (shutdown > 0) {
+      if (m_shutdown.compare_exchange_weak(shutdown, shutdown - 1)) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  std::vector<Lane> m_lanes;
+  std::atomic<std::size_t> m_next_lane{0};
+
+  std::array<std::atomic<std::size_t>, k_priorities> m_sizes{};
+  std::atomic<std::size_t> m_size{0};
+  std::atomic<int64_t> m_shutdown{0};
+
+  std::mutex m_park_mutex;
+  std::condition_variable m_task_ready;
+  std::atomic<std::size_t> m_sleeping{0};
+};
+
+}  // namespace shcore
+
+#endif  // MYSQLSHDK_LIBS_UTILS_WORK_STEALING_QUEUE_H_
@@ -26,9 +26,12 @@
 #include "mysqlshdk/shellcore/provider_sql.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <functional>
 #include <iostream>
 #include <iterator>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <string_view>
@@ -47,6 +50,9 @@
 #include "mysqlshdk/libs/utils/utils_sqlstring.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 #include "mysqlshdk/libs/utils/version.h"
+#include "shellcore/interrupt_handler.h"
+#include "shellcore/scoped_contexts.h"
+#include "shellcore/shell_init.h"
 
 namespace shcore {
 namespace completer {
@@ -103,6 +109,8 @@ struct Instance {
     Tables tables;
     Objects triggers;
     Tables views;
+    // objects from this schema were fetched (schema can be empty)
+    bool loaded = false;
   };
   using Schemas = std::vector<Schema>;
 
@@ -141,27 +149,54 @@ class Provider_sql::Cache final {
  public:
   Cache() { set_system_functions(k_current_version); }
 
-  Cache(const Cache &) = default;
-  Cache(Cache &&) = default;
+  Cache(const Cache &other)
+      : m_instance(other.m_instance),
+        m_cancelled(other.cancelled()),
+        m_user_connection_id(other.m_user_connection_id) {}
 
-  Cache &operator=(const Cache &) = default;
-  Cache &operator=(Cache &&) = default;
+  Cache(Cache &&) = delete;
+
+  Cache &operator=(const Cache &) = delete;
+  Cache &operator=(Cache &&) = delete;
 
   ~Cache() = default;
 
   void cancel() { m_cancelled = true; }
 
+  void resume() { m_cancelled = false; }
+
+  bool cancelled() const { return m_cancelled; }
+
+  /**
+   * Sets ID of the connection used by the user, user variables are fetched
+   * for this connection if it's different than the one used to fetch data.
+   */
+  void set_user_connection_id(uint64_t id) { m_user_connection_id = id; }
+
+  /**
+   * Checks if the global names and objects from the given schema were
+   * fetched.
+   */
+  bool is_loaded(const std::string &schema) const {
+    if (m_instance.schemas.empty()) {
+      return false;
+    }
+
+    if (schema.empty()) {
+      return true;
+    }
+
+    const auto s = find(m_instance.schemas, schema);
+    return s && s->loaded;
+  }
+
   void refresh_schemas(
       const std::shared_ptr<mysqlshdk::db::ISession> &session) {
-    m_cancelled = false;
-
     fetch_schemas(session);
   }
 
   void refresh_schema(const std::shared_ptr<mysqlshdk::db::ISession> &session,
                       const std::string &schema, bool force) {
-    m_cancelled = false;
-
     // cache schema names if not done yet
     if (m_instance.schemas.empty() || force) {
       refresh_schemas(session);
@@ -179,30 +214,18 @@ class Provider_sql::Cache final {
       return;
     }
 
-    if (auto s = find(&m_instance.schemas, schema)) {
-      if (s->tables.empty() || force) {
-        fetch_tables(session, s);
-      }
-
-      if (s->views.empty() || force) {
-        fetch_views(session, s);
-      }
-
-      if (s->functions.empty() || force) {
-        fetch_functions(session, s);
-      }
-
-      if (s->procedures.empty() || force) {
-        fetch_procedures(session, s);
-      }
-
-      if (s->events.empty() || force) {
-        fetch_events(session, s);
-      }
-
-      if (s->triggers.empty() || force) {
-        fetch_triggers(session, s);
-      }
+    if (auto s = find(&m_instance.schemas, schema);
+        s && (!s->loaded || force)) {
+      fetch_tables(session, s);
+      fetch_views(session, s);
+      fetch_columns(session, s);
+      fetch_functions(session, s);
+      fetch_procedures(session, s);
+      fetch_events(session, s);
+      fetch_triggers(session, s);
+
+      // a cancelled refresh leaves some of the objects unfetched
+      s->loaded = !m_cancelled;
     }
   }
 
@@ -524,7 +547,17 @@ class Provider_sql::Cache final {
   template <class T, is_instance_object<T> = 0>
   static const T *find(const std::vector<T> &container,
                        const std::string &name) {
-    const auto wname = shcore::utf8_to_wide(name);
+    return find(container, shcore::utf8_to_wide(name));
+  }
+
+  template <class T, is_instance_object<T> = 0>
+  static T *find(std::vector<T> *container, const std::wstring &name) {
+    return const_cast<T *>(find(*container, name));
+  }
+
+  template <class T, is_instance_object<T> = 0>
+  static const T *find(const std::vector<T> &container,
+                       const std::wstring &wname) {
     const auto range = std::equal_range(container.begin(), container.end(),
                                         wname, Compare_ci{});
 
@@ -647,20 +680,68 @@ class Provider_sql::Cache final {
             std::string{target == &schema->tables ? "=" : "<>"} +
             "'BASE TABLE' AND TABLE_SCHEMA=" + quote_sql_string(schema->name()),
         target);
-
-    for (auto &table : *target) {
-      fetch_columns(session, schema, &table);
-    }
   }
 
   void fetch_columns(const std::shared_ptr<mysqlshdk::db::ISession> &session,
-                     const Instance::Schema *schema, Instance::Table *table) {
-    fetch(session,
-          "SELECT COLUMN_NAME FROM INFORMATION_SCHEMA.COLUMNS WHERE "
-          "TABLE_SCHEMA=" +
-              quote_sql_string(schema->name()) +
-              " AND TABLE_NAME=" + quote_sql_string(table->name()),
-          &table->columns);
+                     Instance::Schema *schema) {
+    // columns of all tables and views are fetched using a single query, schemas
+    // with lots of tables would otherwise require lots of round trips
+    if (m_cancelled) {
+      return;
+    }
+
+    for (auto &table : schema->tables) {
+      table.columns.clear();
+    }
+
+    for (auto &view : schema->views) {
+      view.columns.clear();
+    }
+
+    if (const auto result = session->query(
+            "SELECT TABLE_NAME, COLUMN_NAME FROM INFORMATION_SCHEMA.COLUMNS "
+            "WHERE TABLE_SCHEMA=" +
+            quote_sql_string(schema->name()))) {
+      std::wstring name;
+      Instance::Table *table = nullptr;
+
+      while (!m_cancelled) {
+        const auto row = result->fetch_one();
+
+        if (!row) {
+          break;
+        }
+
+        auto table_name = row->get_wstring(0);
+
+        // rows are not ordered, but columns of a single table are usually
+        // returned together
+        if (!table || table_name != name) {
+          name = std::move(table_name);
+          table = find(&schema->tables, name);
+
+          if (!table) {
+            table = find(&schema->views, name);
+          }
+        }
+
+        if (table) {
+          table->columns.emplace_back(row->get_wstring(1));
+        }
+      }
+    }
+
+    if (m_cancelled) {
+      return;
+    }
+
+    for (auto &table : schema->tables) {
+      sort(&table.columns);
+    }
+
+    for (auto &view : schema->views) {
+      sort(&view.columns);
+    }
   }
 
   void fetch_functions(const std::shared_ptr<mysqlshdk::db::ISession> &session,
@@ -741,9 +822,12 @@ class Provider_sql::Cache final {
   void set_system_functions(const Version &version) {
     static std::unordered_map<base::MySQLVersion, Instance::Objects>
         s_system_functions;
+    // cache can be refreshed in a background thread
+    static std::mutex s_mutex;
 
     const auto mysql_version =
         base::MySQLSymbolInfo::numberToVersion(version.numeric());
+    std::lock_guard lock{s_mutex};
     auto &functions = s_system_functions[mysql_version];
 
     if (functions.empty()) {
@@ -790,7 +874,13 @@ class Provider_sql::Cache final {
           "SELECT VARIABLE_NAME FROM "
           "performance_schema.user_variables_by_thread WHERE THREAD_ID=";
 
-      if (session->get_server_version() >= Version(8, 0, 16)) {
+      if (m_user_connection_id &&
+          m_user_connection_id != session->get_connection_id()) {
+        query +=
+            "(SELECT THREAD_ID FROM performance_schema.threads WHERE "
+            "PROCESSLIST_ID=" +
+            std::to_string(m_user_connection_id) + ")";
+      } else if (session->get_server_version() >= Version(8, 0, 16)) {
         query += "PS_CURRENT_THREAD_ID()";
       } else {
         query += "sys.ps_thread_id(NULL)";
@@ -837,21 +927,22 @@ class Provider_sql::Cache final {
   }
 
   Instance m_instance;
-  volatile bool m_cancelled = false;
+  std::atomic<bool> m_cancelled = false;
+  uint64_t m_user_connection_id = 0;
 };
 
 Provider_sql::Provider_sql()
     : m_completion_context{k_current_version},
-      m_cache(std::make_unique<Cache>()) {
+      m_cache(std::make_shared<Cache>()) {
   m_completion_context.set_filtered(true);
   m_completion_context.set_uppercase_keywords(true);
   m_completion_context.set_sql_mode(std::string{k_default_sql_mode_80});
 }
 
-Provider_sql::~Provider_sql() = default;
+Provider_sql::~Provider_sql() { cancel_refresh(); }
 
 Completion_list Provider_sql::complete_schema(const std::string &prefix) const {
-  return m_cache->complete_schema(prefix);
+  return cache()->complete_schema(prefix);
 }
 
 /**
@@ -887,23 +978,139 @@ Completion_list Provider_sql::complete(const std::string &buffer,
     *compl_offset = 0;
   }
 
-  return m_cache->complete(std::move(result));
+  return cache()->complete(std::move(result));
 }
 
-void Provider_sql::interrupt_rehash() { m_cache->cancel(); }
+void Provider_sql::interrupt_rehash() {
+  std::lock_guard lock{m_mutex};
+
+  m_cache->cancel();
+
+  if (m_pending_cache) {
+    m_pending_cache->cancel();
+  }
+}
 
 void Provider_sql::refresh_schema_cache(
-    const std::shared_ptr<mysqlshdk::db::ISession> &session) {
+    const std::shared_ptr<mysqlshdk::db::ISession> &session,
+    const std::shared_ptr<mysqlshdk::db::ISession> &background_session) {
   update_completion_context(session);
-  m_cache->refresh_schemas(session);
+  refresh(session, {}, true, true, background_session);
 }
 
 void Provider_sql::refresh_name_cache(
     const std::shared_ptr<mysqlshdk::db::ISession> &session,
-    const std::string &current_schema, bool force) {
+    const std::string &current_schema, bool force,
+    const std::shared_ptr<mysqlshdk::db::ISession> &background_session) {
   update_completion_context(session);
   m_completion_context.set_active_schema(current_schema);
-  m_cache->refresh_schema(session, current_schema, force);
+  refresh(session, current_schema, force, false, background_session);
+}
+
+void Provider_sql::refresh(
+    const std::shared_ptr<mysqlshdk::db::ISession> &session,
+    const std::string &schema, bool force, bool schemas_only,
+    const std::shared_ptr<mysqlshdk::db::ISession> &background) {
+  // only one refresh at a time, the new one is going to fetch up-to-date data
+  cancel_refresh();
+
+  const auto do_refresh =
+      [schema, force, schemas_only](
+          Cache *cache,
+          const std::shared_ptr<mysqlshdk::db::ISession> &s) {
+        if (schemas_only) {
+          cache->refresh_schemas(s);
+        } else {
+          cache->refresh_schema(s, schema, force);
+        }
+      };
+
+  if (!background) {
+    m_cache->resume();
+    do_refresh(m_cache.get(), session);
+    return;
+  }
+
+  // data is fetched into a copy of the cache, the current one is used to
+  // complete in the meantime and replaced once the refresh is finished
+  auto cache = std::make_shared<Cache>(*m_cache);
+  cache->resume();
+  cache->set_user_connection_id(session->get_connection_id());
+
+  {
+    std::lock_guard lock{m_mutex};
+    m_pending_cache = cache;
+    m_pending_schema = schemas_only ? std::string{} : schema;
+    m_pending_force = force;
+  }
+
+  m_refresh_thread = mysqlsh::spawn_scoped_thread(
+      [this, cache = std::move(cache), background, do_refresh]() {
+        mysqlsh::Mysql_thread mysql_thread;
+
+        try {
+          do_refresh(cache.get(), background);
+        } catch (const std::exception &e) {
+          log_warning("Failed to refresh the SQL auto-completion cache: %s",
+                      e.what());
+          // session is reused by the subsequent refreshes, make sure a new
+          // one is opened if this one is no longer usable
+          background->close();
+        }
+
+        {
+          std::lock_guard lock{m_mutex};
+
+          if (!cache->cancelled()) {
+            m_cache = cache;
+          }
+
+          m_pending_cache.reset();
+        }
+
+        m_refreshed.notify_all();
+      });
+}
+
+void Provider_sql::cancel_refresh() {
+  {
+    std::lock_guard lock{m_mutex};
+
+    if (m_pending_cache) {
+      m_pending_cache->cancel();
+    }
+  }
+
+  if (m_refresh_thread.joinable()) {
+    m_refresh_thread.join();
+  }
+}
+
+std::shared_ptr<const Provider_sql::Cache> Provider_sql::cache() const {
+  std::unique_lock lock{m_mutex};
+
+  // wait for the refresh if it was explicitly requested (i.e. \rehash), or if
+  // cache does not hold the requested data yet
+  const auto refreshed = [this]() {
+    return !m_pending_cache || m_pending_cache->cancelled() ||
+           (!m_pending_force && m_cache->is_loaded(m_pending_schema));
+  };
+
+  if (!refreshed()) {
+    // ^C cancels the refresh, names which are already cached are used instead,
+    // handler only sets a flag, wait is periodically interrupted to check it
+    const auto pending = m_pending_cache;
+    shcore::Interrupt_handler intr([&pending]() {
+      pending->cancel();
+      return true;
+    });
+
+    while (!m_refreshed.wait_for(lock, std::chrono::milliseconds{100},
+                                 refreshed)) {
+    }
+  }
+
+  return m_cache;
 }
 
 void Provider_sql::update_completion_context(
@@ -931,6 +1138,7 @@ void Provider_sql::update_completion_context(
 }
 
 void Provider_sql::clear_name_cache() {
+  cancel_refresh();
   reset_completion_context();
   m_cache->clear_cache();
 }
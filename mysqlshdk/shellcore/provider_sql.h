@@ -26,8 +26,11 @@
 #ifndef MYSQLSHDK_SHELLCORE_PROVIDER_SQL_H_
 #define MYSQLSHDK_SHELLCORE_PROVIDER_SQL_H_
 
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "mysqlshdk/libs/db/session.h"
@@ -46,12 +49,33 @@ class Provider_sql : public Provider {
   Completion_list complete(const std::string &buffer, const std::string &line,
                            size_t *compl_offset) override;
 
+  /**
+   * Refreshes the schema names.
+   *
+   * @param session The session used by the user.
+   * @param background_session If given, the names are fetched asynchronously
+   *        using this session, completion waits until refresh is finished.
+   *        Session is not closed, it can be reused by the next refresh.
+   */
   void refresh_schema_cache(
-      const std::shared_ptr<mysqlshdk::db::ISession> &session);
-
+      const std::shared_ptr<mysqlshdk::db::ISession> &session,
+      const std::shared_ptr<mysqlshdk::db::ISession> &background_session = {});
+
+  /**
+   * Refreshes the global names and object names from the current schema.
+   *
+   * @param session The session used by the user.
+   * @param current_schema The schema to be cached.
+   * @param force Whether to refresh the data which is already cached.
+   * @param background_session If given, the names are fetched asynchronously
+   *        using this session. Unless refresh is forced, previous contents of
+   *        the cache are used to complete until refresh is finished. Session
+   *        is not closed, it can be reused by the next refresh.
+   */
   void refresh_name_cache(
       const std::shared_ptr<mysqlshdk::db::ISession> &session,
-      const std::string &current_schema, bool force);
+      const std::string &current_schema, bool force,
+      const std::shared_ptr<mysqlshdk::db::ISession> &background_session = {});
 
   void clear_name_cache();
 
@@ -67,8 +91,24 @@ class Provider_sql : public Provider {
 
   void reset_completion_context();
 
+  void refresh(const std::shared_ptr<mysqlshdk::db::ISession> &session,
+               const std::string &schema, bool force, bool schemas_only,
+               const std::shared_ptr<mysqlshdk::db::ISession> &background);
+
+  void cancel_refresh();
+
+  std::shared_ptr<const Cache> cache() const;
+
   mysqlshdk::Sql_completion_context m_completion_context;
-  std::unique_ptr<Cache> m_cache;
+  std::shared_ptr<Cache> m_cache;
+
+  // background refresh
+  mutable std::mutex m_mutex;
+  mutable std::condition_variable m_refreshed;
+  std::shared_ptr<Cache> m_pending_cache;
+  std::string m_pending_schema;
+  bool m_pending_force = false;
+  std::thread m_refresh_thread;
 };
 
 }  // namespace completer
@@ -655,6 +655,9 @@ Shell_options::Shell_options(
         SHCORE_LOG_FILE_NAME, cmdline("--log-file=<path>"),
         "Override location of the Shell log file.",
         shcore::opts::Read_only<std::string>()) // read-only in shell.options
+    (&storage.log_async, false, SHCORE_LOG_ASYNC, cmdline("--log-async"),
+        "Write the log file in a background thread, in batches.",
+        shcore::opts::Read_only<bool>())
     (reinterpret_cast<int*>(&storage.log_level),
         shcore::Logger::LOG_INFO, "logLevel", cmdline("--log-level=<value>"),
         std::string("Set logging level. ") +
@@ -913,7 +913,9 @@ size_t Resultset_dumper_base::dump_json(const std::string &item_label,
 size_t Resultset_dumper_base::dump_table() {
   const auto &metadata = m_result->get_metadata();
   std::vector<Field_formatter> fmt;
-  std::vector<mysqlshdk::db::Row_copy> pre_fetched_rows;
+  // rows are released in bulk, when arena goes out of scope
+  mysqlshdk::db::Row_arena arena;
+  std::vector<mysqlshdk::db::Flat_row> pre_fetched_rows;
   size_t num_records = 0;
   const size_t field_count = metadata.size();
   if (field_count == 0) return 0;
@@ -929,7 +931,7 @@ size_t Resultset_dumper_base::dump_table() {
   {
     auto row = m_result->fetch_one();
     while (row && !m_cancelled) {
-      pre_fetched_rows.emplace_back(*row);
+      pre_fetched_rows.emplace_back(*row, &arena);
 
       for (size_t field_index = 0; field_index < field_count; field_index++) {
         fmt[field_index].process(row, field_index);
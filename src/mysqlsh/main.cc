@@ -637,7 +637,7 @@ int main(int argc, char **argv) {
     // Setup logging
     logger = shcore::Logger::create_instance(
         options.log_file.empty() ? nullptr : options.log_file.c_str(),
-        options.log_to_stderr, options.log_level);
+        options.log_to_stderr, options.log_level, options.log_async);
   } catch (const std::exception &e) {
     fprintf(stderr, "%s\n", e.what());
     exit(1);
@@ -1670,6 +1670,22 @@ bool Mysql_shell::cmd_rehash(const std::vector<std::string> & /* args */) {
   return true;
 }
 
+std::shared_ptr<mysqlshdk::db::ISession> Mysql_shell::completion_session(
+    const mysqlshdk::db::Connection_options &options) {
+  // the default schema does not matter, queries use fully qualified names
+  auto target = options;
+  target.clear_schema();
+
+  if (!m_completion_session || !m_completion_session->is_open() ||
+      m_completion_session_options != target) {
+    m_completion_session.reset();
+    m_completion_session = establish_session(target, false);
+    m_completion_session_options = std::move(target);
+  }
+
+  return m_completion_session;
+}
+
 void Mysql_shell::refresh_completion(bool force) {
   if (options().db_name_cache || force) {
     if (!_provider_sql) {
@@ -1709,19 +1725,33 @@ void Mysql_shell::refresh_completion(bool force) {
       context.emplace_back("schema names");
     }
 
+    const auto core = session->get_core_session();
+    std::shared_ptr<mysqlshdk::db::ISession> background;
+
     if (!context.empty()) {
+      // names are fetched using a separate session, so that the prompt is not
+      // blocked when there's a lot of objects
+      try {
+        background = completion_session(core->get_connection_options());
+      } catch (const std::exception &e) {
+        log_info(
+            "Failed to open a session for the auto-completion cache update, "
+            "falling back to the current session: %s",
+            e.what());
+      }
+
       println("Fetching " + shcore::str_join(context, ", ") +
-              " for auto-completion... Press ^C to stop.");
+              " for auto-completion" +
+              (background ? " in the background." : "... Press ^C to stop."));
     }
 
     try {
-      const auto core = session->get_core_session();
-
       if (_shell->interactive_mode() == shcore::IShell_core::Mode::SQL) {
         // Only refresh the full DB name cache if we're in SQL mode
-        _provider_sql->refresh_name_cache(core, current_schema, force);
+        _provider_sql->refresh_name_cache(core, current_schema, force,
+                                          background);
       } else if (force) {
-        _provider_sql->refresh_schema_cache(core);
+        _provider_sql->refresh_schema_cache(core, background);
       }
     } catch (const std::exception &e) {
       handle_error(e);
@@ -156,6 +156,17 @@ class Mysql_shell : public mysqlsh::Base_shell {
 
   virtual void toggle_print() {}
 
+  /**
+   * Provides the session used to refresh the auto-completion cache in the
+   * background. The same session is reused as long as the user stays
+   * connected to the same server, using the same account.
+   */
+  std::shared_ptr<mysqlshdk::db::ISession> completion_session(
+      const mysqlshdk::db::Connection_options &options);
+
+  std::shared_ptr<mysqlshdk::db::ISession> m_completion_session;
+  mysqlshdk::db::Connection_options m_completion_session_options;
+
 #ifdef FRIEND_TEST
   FRIEND_TEST(Cmdline_shell, check_password_history_linenoise);
   FRIEND_TEST(Cmdline_shell, check_history_overflow_del);
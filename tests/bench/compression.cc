@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "mysqlshdk/libs/storage/backend/memory_file.h"
+#include "mysqlshdk/libs/storage/compressed_file.h"
+
+// Compares the throughput and ratio of the compression algorithms supported
+// by dump and load utilities.
+//
+// Usage: bench_compression [file] [level]
+//
+// If file is not given, TSV data resembling a typical table is generated.
+
+namespace {
+
+using mysqlshdk::storage::Compression;
+using mysqlshdk::storage::Mode;
+using mysqlshdk::storage::backend::Memory_file;
+
+constexpr size_t k_generated_size = 256 * 1024 * 1024;
+constexpr size_t k_io_size = 64 * 1024;
+
+std::string generate_table_data(size_t size) {
+  static const std::vector<std::string> s_words = {
+      "ACADEMY",  "DINOSAUR", "ACE",       "GOLDFINGER", "ADAPTATION",
+      "HOLES",    "AFFAIR",   "PREJUDICE", "AFRICAN",    "EGG",
+      "AGENT",    "TRUMAN",   "AIRPLANE",  "SIERRA",     "AIRPORT",
+      "POLLOCK",  "ALABAMA",  "DEVIL",     "ALADDIN",    "CALENDAR"};
+
+  std::mt19937_64 generator{42};
+  std::uniform_int_distribution<size_t> word(0, s_words.size() - 1);
+  std::uniform_int_distribution<int> number(0, 99999);
+  std::uniform_int_distribution<int> day(1, 28);
+
+  std::string data;
+  data.reserve(size + 1024);
+
+  for (uint64_t id = 1; data.size() < size; ++id) {
+    data += std::to_string(id);
+    data += '\t';
+    data += s_words[word(generator)];
+    data += ' ';
+    data += s_words[word(generator)];
+    data += '\t';
+    data += std::to_string(number(generator));
+    data += '.';
+    data += std::to_string(number(generator) % 100);
+    data += "\t2006-02-";
+    data += std::to_string(day(generator));
+    data += " 04:34:33\t";
+    data += std::to_string(number(generator) % 16);
+    data += '\n';
+  }
+
+  return data;
+}
+
+std::string read_file(const char *path) {
+  std::string data;
+  const auto file = std::fopen(path, "rb");
+
+  if (!file) {
+    std::cerr << "Cannot open " << path << '\n';
+    std::exit(1);
+  }
+
+  char buffer[k_io_size];
+  size_t bytes;
+
+  while ((bytes = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    data.append(buffer, bytes);
+  }
+
+  std::fclose(file);
+
+  return data;
+}
+
+double mb_per_s(size_t bytes, std::chrono::steady_clock::duration duration) {
+  const auto us =
+      std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+  return us ? static_cast<double>(bytes) / us : 0.0;
+}
+
+void run(const std::string &data, Compression c, const std::string &level) {
+  mysqlshdk::storage::Compression_options options;
+
+  if (!level.empty() && Compression::NONE != c) {
+    options.emplace("level", level);
+  }
+
+  auto memfile = std::make_unique<Memory_file>("");
+  const auto memfile_ptr = memfile.get();
+  const auto file =
+      mysqlshdk::storage::make_file(std::move(memfile), c, options);
+
+  const auto c_start = std::chrono::steady_clock::now();
+
+  file->open(Mode::WRITE);
+
+  for (size_t offset = 0; offset < data.size(); offset += k_io_size) {
+    file->write(data.data() + offset,
+                std::min(k_io_size, data.size() - offset));
+  }
+
+  file->close();
+
+  const auto c_end = std::chrono::steady_clock::now();
+  const auto compressed_size = memfile_ptr->content().size();
+
+  std::string buffer;
+  buffer.resize(k_io_size);
+  size_t decompressed_size = 0;
+
+  const auto d_start = std::chrono::steady_clock::now();
+
+  file->open(Mode::READ);
+
+  for (auto bytes = file->read(&buffer[0], buffer.size()); bytes > 0;
+       bytes = file->read(&buffer[0], buffer.size())) {
+    decompressed_size += bytes;
+  }
+
+  file->close();
+
+  const auto d_end = std::chrono::steady_clock::now();
+
+  if (decompressed_size != data.size()) {
+    std::cerr << "Decompressed size mismatch: " << decompressed_size
+              << " != " << data.size() << '\n';
+    std::exit(1);
+  }
+
+  std::printf("%-6s %10zu bytes  ratio %6.2f  compress %8.1f MB/s  "
+              "decompress %8.1f MB/s\n",
+              mysqlshdk::storage::to_string(c).c_str(), compressed_size,
+              static_cast<double>(data.size()) / compressed_size,
+              mb_per_s(data.size(), c_end - c_start),
+              mb_per_s(data.size(), d_end - d_start));
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const auto data =
+      argc > 1 ? read_file(argv[1]) : generate_table_data(k_generated_size);
+  const std::string level = argc > 2 ? argv[2] : "";
+
+  std::cout << "# " << data.size() << " bytes of input data\n";
+
+  for (const auto c : {Compression::NONE, Compression::LZ4, Compression::ZSTD,
+                       Compression::GZIP}) {
+    run(data, c, level);
+  }
+}
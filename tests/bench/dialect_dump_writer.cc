@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "modules/util/dump/dialect_dump_writer.h"
+#include "mysqlshdk/libs/db/column.h"
+#include "mysqlshdk/libs/db/row.h"
+#include "mysqlshdk/libs/storage/backend/memory_file.h"
+
+// Compares the throughput of the per-character escaping loop with the one used
+// by the Dialect_dump_writer, and verifies that the writer produces exactly the
+// same output.
+//
+// Usage: bench_dialect_dump_writer [rows]
+
+namespace {
+
+using mysqlsh::dump::Dump_writer;
+using mysqlshdk::db::Type;
+using mysqlshdk::storage::Mode;
+using mysqlshdk::storage::backend::Memory_file;
+
+constexpr std::size_t k_default_rows = 200000;
+constexpr std::size_t k_columns = 4;
+
+// row which holds the raw data, without copying it when it's accessed
+class Raw_row : public mysqlshdk::db::IRow {
+ public:
+  explicit Raw_row(std::vector<std::string> fields)
+      : m_fields(std::move(fields)) {}
+
+  uint32_t num_fields() const override {
+    return static_cast<uint32_t>(m_fields.size());
+  }
+
+  Type get_type(uint32_t) const override { return Type::String; }
+
+  bool is_null(uint32_t) const override { return false; }
+
+  std::string get_as_string(uint32_t index) const override {
+    return m_fields[index];
+  }
+
+  std::string get_string(uint32_t index) const override {
+    return m_fields[index];
+  }
+
+  int64_t get_int(uint32_t) const override { unsupported(); }
+
+  uint64_t get_uint(uint32_t) const override { unsupported(); }
+
+  float get_float(uint32_t) const override { unsupported(); }
+
+  double get_double(uint32_t) const override { unsupported(); }
+
+  std::pair<const char *, size_t> get_string_data(
+      uint32_t index) const override {
+    return {m_fields[index].data(), m_fields[index].size()};
+  }
+
+  void get_raw_data(uint32_t index, const char **out_data,
+                    size_t *out_size) const override {
+    *out_data = m_fields[index].data();
+    *out_size = m_fields[index].size();
+  }
+
+  std::tuple<uint64_t, int> get_bit(uint32_t) const override { unsupported(); }
+
+ private:
+  [[noreturn]] static void unsupported() {
+    throw std::logic_error("Not supported");
+  }
+
+  std::vector<std::string> m_fields;
+};
+
+std::string generate_text(std::mt19937_64 *generator, std::size_t length) {
+  static constexpr char s_letters[] =
+      "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789 .-";
+  static constexpr char s_special[] = {'\t', '\n', '\r', '"',  '\\',
+                                       ',',  '\0', '\b', 0x1A, 0x01};
+
+  std::uniform_int_distribution<std::size_t> letter(
+      0, sizeof(s_letters) - 2);
+  std::uniform_int_distribution<std::size_t> special(0,
+                                                     sizeof(s_special) - 1);
+  // roughly one in 100 characters needs to be escaped
+  std::uniform_int_distribution<int> percent(0, 99);
+
+  std::string text;
+  text.reserve(length);
+
+  while (text.length() < length) {
+    text += 0 == percent(*generator) ? s_special[special(*generator)]
+                                     : s_letters[letter(*generator)];
+  }
+
+  return text;
+}
+
+std::vector<Raw_row> generate_rows(std::size_t count) {
+  std::mt19937_64 generator{42};
+  std::uniform_int_distribution<std::size_t> short_length(1, 16);
+  std::uniform_int_distribution<std::size_t> medium_length(16, 128);
+  std::uniform_int_distribution<std::size_t> long_length(128, 2048);
+
+  std::vector<Raw_row> rows;
+  rows.reserve(count);
+
+  for (std::size_t i = 0; i < count; ++i) {
+    rows.emplace_back(std::vector<std::string>{
+        std::to_string(i), generate_text(&generator, short_length(generator)),
+        generate_text(&generator, medium_length(generator)),
+        generate_text(&generator, long_length(generator))});
+  }
+
+  return rows;
+}
+
+std::vector<mysqlshdk::db::Column> columns() {
+  std::vector<mysqlshdk::db::Column> result;
+
+  for (std::size_t i = 0; i < k_columns; ++i) {
+    const auto name = "c" + std::to_string(i);
+    result.emplace_back("", "schema", "table", "table", name, name, 0, 0,
+                        Type::String, 33, false, false, false);
+  }
+
+  return result;
+}
+
+// the original implementation, one character at a time
+template <class T>
+void escape_scalar(const char *data, std::size_t length, std::string *out) {
+  for (const auto end = data + length; data != end; ++data) {
+    const auto c = *data;
+
+    if (const auto to_write = mysqlsh::dump::detail::escaped_char<T>(c)) {
+      *out += T::fields_escaped_by[0];
+      *out += to_write;
+    } else {
+      *out += c;
+    }
+  }
+}
+
+// the implementation used by the writer, characters which don't need to be
+// escaped are copied in bulk
+template <class T>
+void escape_bulk(const char *data, std::size_t length, std::string *out) {
+  const auto end = data + length;
+
+  for (auto p = data;; ++p) {
+    const auto next = mysqlsh::dump::detail::find_maybe_escaped<T>(p, end);
+    out->append(p, next - p);
+
+    if (next == end) {
+      break;
+    }
+
+    p = next;
+
+    if (const auto to_write = mysqlsh::dump::detail::escaped_char<T>(*p)) {
+      *out += T::fields_escaped_by[0];
+      *out += to_write;
+    } else {
+      *out += *p;
+    }
+  }
+}
+
+template <class T>
+std::string expected_output(const std::vector<Raw_row> &rows) {
+  std::string out;
+
+  for (const auto &row : rows) {
+    for (uint32_t i = 0; i < row.num_fields(); ++i) {
+      if (0 != i) out += T::fields_terminated_by;
+      out += T::fields_enclosed_by;
+
+      const auto field = row.get_string_data(i);
+
+      if (T::fields_escaped_by[0]) {
+        escape_scalar<T>(field.first, field.second, &out);
+      } else {
+        out.append(field.first, field.second);
+      }
+
+      out += T::fields_enclosed_by;
+    }
+
+    out += T::lines_terminated_by;
+  }
+
+  return out;
+}
+
+double mb_per_s(std::size_t bytes,
+                std::chrono::steady_clock::duration duration) {
+  const auto us =
+      std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+  return us ? static_cast<double>(bytes) / us : 0.0;
+}
+
+template <class T, class F>
+double run_kernel(const std::vector<Raw_row> &rows, std::size_t input_size,
+                  F escape) {
+  std::string out;
+  out.reserve(2 * input_size);
+
+  const auto start = std::chrono::steady_clock::now();
+
+  for (const auto &row : rows) {
+    for (uint32_t i = 0; i < row.num_fields(); ++i) {
+      const auto field = row.get_string_data(i);
+      escape(field.first, field.second, &out);
+    }
+  }
+
+  return mb_per_s(input_size, std::chrono::steady_clock::now() - start);
+}
+
+template <class W, class T>
+void run(const char *name, const std::vector<Raw_row> &rows,
+         std::size_t input_size) {
+  Memory_file file{""};
+  W writer;
+
+  const auto start = std::chrono::steady_clock::now();
+
+  file.open(Mode::WRITE);
+  writer.set_output_file(&file);
+  writer.open();
+  writer.write_preamble(columns());
+
+  for (const auto &row : rows) {
+    writer.write_row(&row);
+  }
+
+  writer.write_postamble();
+  writer.close();
+  file.close();
+
+  const auto writer_speed =
+      mb_per_s(input_size, std::chrono::steady_clock::now() - start);
+
+  if (file.content() != expected_output<T>(rows)) {
+    std::cerr << name << ": output differs from the expected one\n";
+    std::exit(1);
+  }
+
+  std::printf("%-8s writer %8.1f MB/s", name, writer_speed);
+
+  if (T::fields_escaped_by[0]) {
+    std::printf("  scalar escape %8.1f MB/s  bulk escape %8.1f MB/s",
+                run_kernel<T>(rows, input_size, escape_scalar<T>),
+                run_kernel<T>(rows, input_size, escape_bulk<T>));
+  }
+
+  std::printf("\n");
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const auto count = argc > 1 ? std::strtoull(argv[1], nullptr, 10)
+                              : k_default_rows;
+  const auto rows = generate_rows(count);
+  std::size_t input_size = 0;
+
+  for (const auto &row : rows) {
+    for (uint32_t i = 0; i < row.num_fields(); ++i) {
+      input_size += row.get_string_data(i).second;
+    }
+  }
+
+  std::cout << "# " << rows.size() << " rows, " << input_size
+            << " bytes of input data\n";
+
+  using namespace mysqlsh::dump;
+
+  run<Default_dump_writer, detail::default_traits>("default", rows,
+                                                    input_size);
+  run<Tsv_dump_writer, detail::tsv_traits>("tsv", rows, input_size);
+  run<Csv_dump_writer, detail::csv_traits>("csv", rows, input_size);
+  run<Csv_unix_dump_writer, detail::csv_unix_traits>("csv-unix", rows,
+                                                      input_size);
+  run<Json_dump_writer, detail::json_traits>("json", rows, input_size);
+}
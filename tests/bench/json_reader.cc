@@ -25,11 +25,114 @@
 
 #include "mysqlshdk/libs/utils/document_parser.h"
 
+#include <algorithm>
 #include <chrono>
 #include <iostream>
+#include <string>
 
-int main() {
+#include "mysqlshdk/libs/utils/utils_file.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+void print_throughput(const std::string &name, std::size_t bytes,
+                      Clock::duration duration) {
+  const auto us =
+      std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+
+  std::cout << "# " << name << ": " << bytes << " bytes @ " << us / 1000.0
+            << "ms, ";
+
+  if (0 == us) {
+    std::cout << "n/a\n";
+  } else {
+    std::cout << static_cast<double>(bytes) / us << " Mbytes/s\n";
+  }
+}
+
+/**
+ * Byte-at-a-time boundary detection, the baseline for the
+ * Json_document_splitter.
+ *
+ * @returns offset of the end of the last document
+ */
+std::size_t scalar_last_boundary(const std::string &data) {
+  std::size_t depth = 0;
+  bool in_string = false;
+  bool escape = false;
+  std::size_t last = 0;
+
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    const auto c = data[i];
+
+    if (escape) {
+      escape = false;
+    } else if ('\\' == c) {
+      escape = true;
+    } else if (in_string) {
+      if ('"' == c) {
+        in_string = false;
+      }
+    } else if ('"' == c) {
+      in_string = true;
+    } else if ('{' == c || '[' == c) {
+      ++depth;
+    } else if (('}' == c || ']' == c) && depth > 0 && 0 == --depth) {
+      last = i + 1;
+    }
+  }
+
+  return last;
+}
+
+std::size_t vectorized_last_boundary(const std::string &data) {
+  // use the same block size as the parallel import of JSON documents
+  constexpr std::size_t k_block_size = 1024 * 1024;
+  shcore::Json_document_splitter splitter;
+  std::size_t last = 0;
+
+  for (std::size_t offset = 0; offset < data.size(); offset += k_block_size) {
+    const auto length = std::min(k_block_size, data.size() - offset);
+    const auto end = splitter.scan(data.data() + offset, length);
+
+    if (std::string::npos != end) {
+      last = offset + end;
+    }
+  }
+
+  return last;
+}
+
+template <typename F>
+void bench_boundaries(const std::string &name, const std::string &data,
+                      F &&f) {
+  const auto t_start = Clock::now();
+  const auto last = f(data);
+  const auto t_end = Clock::now();
+
+  std::cout << "# " << name << ": last document ends at offset " << last
+            << '\n';
+  print_throughput(name, data.size(), t_end - t_start);
+}
+
+}  // namespace
+
+/**
+ * Usage: bench_json_reader [file]
+ *
+ * Reads JSON documents from the given file (or from stdin) and reports the
+ * throughput of the Json_reader. If file is given, throughput of the document
+ * boundary detection is also reported, both for the byte-at-a-time scan
+ * (before) and the vectorized Json_document_splitter (after).
+ */
+int main(int argc, char *argv[]) {
   shcore::Buffered_input input;
+
+  if (argc > 1) {
+    input.open(argv[1]);
+  }
+
   shcore::Document_reader_options opts;
   opts.convert_bson_id = true;
   opts.convert_bson_types = false;
@@ -63,4 +166,11 @@ int main() {
   std::cout << "# " << docs << " docs, " << docs_length << " bytes @ "
             << t_int_ms.count() << "ms\n";
   std::cout << "# " << bytes_per_ms / 1000.0 << " Mbytes/s\n";
+
+  if (argc > 1) {
+    const auto data = shcore::get_text_file(argv[1]);
+
+    bench_boundaries("scalar boundaries", data, scalar_last_boundary);
+    bench_boundaries("vectorized boundaries", data, vectorized_last_boundary);
+  }
 }
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "mysqlshdk/include/shellcore/scoped_contexts.h"
+#include "mysqlshdk/libs/utils/logger.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+
+// Compares the throughput of the synchronous and asynchronous Logger when
+// multiple threads are logging concurrently.
+//
+// Usage: bench_logger [messages per thread] [log file]
+//
+// Time includes destruction of the logger, so asynchronous results also
+// account for writing all the queued messages.
+
+namespace {
+
+double run(const std::string &path, std::size_t threads, std::size_t messages,
+           bool async) {
+  shcore::delete_file(path);
+
+  const auto start = std::chrono::steady_clock::now();
+
+  {
+    mysqlsh::Scoped_logger logger(shcore::Logger::create_instance(
+        path.c_str(), false, shcore::Logger::LOG_INFO, async));
+    std::vector<std::thread> workers;
+
+    for (std::size_t i = 0; i < threads; ++i) {
+      workers.emplace_back([i, messages]() {
+        for (std::size_t m = 0; m < messages; ++m) {
+          log_info("Worker %zu: processed chunk %zu of table `schema`.`table`",
+                   i, m);
+        }
+      });
+    }
+
+    for (auto &worker : workers) {
+      worker.join();
+    }
+  }
+
+  const auto end = std::chrono::steady_clock::now();
+  const auto us =
+      std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+          .count();
+
+  // millions of messages per second
+  return us ? static_cast<double>(threads * messages) / us : 0.0;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t messages =
+      argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100 * 1000;
+  const std::string path = argc > 2 ? argv[2] : "bench_logger.log";
+
+  std::printf("# %zu messages per thread, throughput in Mmsg/s\n", messages);
+  std::printf("%8s %12s %12s\n", "threads", "sync", "async");
+
+  for (std::size_t threads = 1; threads <= 32; threads *= 2) {
+    std::printf("%8zu %12.3f %12.3f\n", threads,
+                run(path, threads, messages, false),
+                run(path, threads, messages, true));
+  }
+
+  shcore::delete_file(path);
+}
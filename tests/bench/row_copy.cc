@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "mysqlshdk/libs/db/row_copy.h"
+
+// Compares the cost of buffering rows of wide result sets using Row_copy and
+// Flat_row, and verifies that both of them return the same values.
+//
+// Usage: bench_row_copy [rows] [columns]
+//
+// Rows are buffered in batches, like Resultset_dumper_base::dump_table() does,
+// each batch is released before the next one is copied.
+
+namespace {
+
+using mysqlshdk::db::Flat_row;
+using mysqlshdk::db::Mutable_row;
+using mysqlshdk::db::Row_arena;
+using mysqlshdk::db::Row_copy;
+using mysqlshdk::db::Type;
+
+constexpr std::size_t k_default_rows = 200000;
+constexpr std::size_t k_default_columns = 50;
+constexpr std::size_t k_batch_size = 1000;
+
+// types of columns repeat in this order
+const std::vector<Type> k_types = {Type::Integer, Type::String,
+                                   Type::Double,  Type::DateTime,
+                                   Type::Decimal, Type::UInteger,
+                                   Type::Null,    Type::Bytes};
+
+std::deque<Mutable_row> generate(std::size_t rows, std::size_t columns) {
+  std::mt19937 gen(1);
+  std::uniform_int_distribution<int> length(0, 64);
+  std::uniform_int_distribution<int> value(0, 1000000);
+  std::vector<Type> types;
+
+  for (std::size_t c = 0; c < columns; ++c) {
+    types.emplace_back(k_types[c % k_types.size()]);
+  }
+
+  // Mutable_row is not movable
+  std::deque<Mutable_row> result;
+
+  for (std::size_t r = 0; r < rows; ++r) {
+    auto &row = result.emplace_back(types);
+
+    for (uint32_t c = 0; c < columns; ++c) {
+      switch (types[c]) {
+        case Type::Integer:
+          row.set_field(c, static_cast<int64_t>(value(gen)) - 500000);
+          break;
+
+        case Type::UInteger:
+          row.set_field(c, static_cast<uint64_t>(value(gen)));
+          break;
+
+        case Type::Double:
+          row.set_field(c, value(gen) / 7.0);
+          break;
+
+        case Type::DateTime:
+          row.set_field(c, "2024-01-02 03:04:05");
+          break;
+
+        case Type::Decimal:
+          row.set_field(c, std::to_string(value(gen)) + ".25");
+          break;
+
+        case Type::String:
+        case Type::Bytes:
+          row.set_field(c, std::string(length(gen), 'a' + c % 26));
+          break;
+
+        default:
+          row.set_field(c, nullptr);
+          break;
+      }
+    }
+  }
+
+  return result;
+}
+
+template <class Copy>
+double run(const std::deque<Mutable_row> &rows, std::size_t columns,
+           Copy &&copy) {
+  const auto start = std::chrono::steady_clock::now();
+
+  for (std::size_t r = 0; r < rows.size(); r += k_batch_size) {
+    copy(rows, r, std::min(rows.size(), r + k_batch_size));
+  }
+
+  const auto end = std::chrono::steady_clock::now();
+  const auto us =
+      std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+          .count();
+
+  // millions of fields per second
+  return us ? static_cast<double>(rows.size() * columns) / us : 0.0;
+}
+
+void verify(const mysqlshdk::db::IRow &expected,
+            const mysqlshdk::db::IRow &actual) {
+  if (expected.num_fields() != actual.num_fields()) {
+    throw std::runtime_error("Number of fields differs");
+  }
+
+  for (uint32_t c = 0; c < expected.num_fields(); ++c) {
+    if (expected.get_type(c) != actual.get_type(c) ||
+        expected.is_null(c) != actual.is_null(c) ||
+        expected.get_as_string(c) != actual.get_as_string(c)) {
+      throw std::runtime_error("Field " + std::to_string(c) + " differs");
+    }
+  }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t rows =
+      argc > 1 ? std::strtoull(argv[1], nullptr, 10) : k_default_rows;
+  const std::size_t columns =
+      argc > 2 ? std::strtoull(argv[2], nullptr, 10) : k_default_columns;
+
+  const auto data = generate(rows, columns);
+
+  {
+    Row_arena arena;
+
+    for (const auto &row : data) {
+      verify(Row_copy{row}, Flat_row{row, &arena});
+    }
+  }
+
+  std::printf("# %zu rows, %zu columns, throughput in Mfields/s\n", rows,
+              columns);
+
+  const auto row_copy = run(
+      data, columns,
+      [](const std::deque<Mutable_row> &src, std::size_t begin,
+         std::size_t end) {
+        std::vector<Row_copy> batch;
+        batch.reserve(k_batch_size);
+
+        for (auto r = begin; r < end; ++r) {
+          batch.emplace_back(src[r]);
+        }
+      });
+
+  Row_arena arena;
+  const auto flat_row = run(
+      data, columns,
+      [&arena](const std::deque<Mutable_row> &src, std::size_t begin,
+               std::size_t end) {
+        std::vector<Flat_row> batch;
+        batch.reserve(k_batch_size);
+
+        for (auto r = begin; r < end; ++r) {
+          batch.emplace_back(src[r], &arena);
+        }
+
+        batch.clear();
+        arena.clear();
+      });
+
+  std::printf("%12s %12.2f\n", "Row_copy", row_copy);
+  std::printf("%12s %12.2f\n", "Flat_row", flat_row);
+}
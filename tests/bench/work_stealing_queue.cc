@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "mysqlshdk/libs/utils/synchronized_queue.h"
+#include "mysqlshdk/libs/utils/work_stealing_queue.h"
+
+// Compares the enqueue/dequeue throughput of the Synchronized_queue and the
+// Work_stealing_queue.
+//
+// Usage: bench_work_stealing_queue [tasks]
+//
+// Two scenarios are measured:
+//  - inject: a single thread adds all the tasks, workers execute them (this is
+//    how Thread_pool is used),
+//  - local: each worker adds its share of tasks, then executes tasks until
+//    all are done.
+
+namespace {
+
+using Task = std::function<void()>;
+
+// adapts Synchronized_queue to the interface of the Work_stealing_queue
+class Shared_queue {
+ public:
+  explicit Shared_queue(std::size_t) {}
+
+  void push(Task &&t) { m_queue.push(std::move(t)); }
+
+  void push_local(std::size_t, Task &&t) { m_queue.push(std::move(t)); }
+
+  Task pop(std::size_t) { return m_queue.pop(); }
+
+  void shutdown(int64_t n) { m_queue.shutdown(n); }
+
+ private:
+  shcore::Synchronized_queue<Task> m_queue;
+};
+
+using Work_stealing_queue = shcore::Work_stealing_queue<Task>;
+
+template <class Queue>
+double run(std::size_t threads, std::size_t tasks, bool local) {
+  Queue queue{threads};
+  std::atomic<std::size_t> executed{0};
+  std::vector<std::thread> workers;
+
+  const auto start = std::chrono::steady_clock::now();
+
+  for (std::size_t i = 0; i < threads; ++i) {
+    workers.emplace_back([&queue, &executed, i, threads, tasks, local]() {
+      if (local) {
+        for (std::size_t t = i; t < tasks; t += threads) {
+          queue.push_local(i, [&executed]() { ++executed; });
+        }
+      }
+
+      while (const auto task = queue.pop(i)) {
+        task();
+      }
+    });
+  }
+
+  if (!local) {
+    for (std::size_t t = 0; t < tasks; ++t) {
+      queue.push([&executed]() { ++executed; });
+    }
+  }
+
+  while (executed < tasks) {
+    std::this_thread::yield();
+  }
+
+  queue.shutdown(threads);
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  const auto end = std::chrono::steady_clock::now();
+  const auto us =
+      std::chrono::duration_cast<std::chrono::microseconds>(end - start)
+          .count();
+
+  // millions of tasks per second
+  return us ? static_cast<double>(tasks) / us : 0.0;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const std::size_t tasks = argc > 1 ? std::strtoull(argv[1], nullptr, 10)
+                                     : 2 * 1000 * 1000;
+
+  std::printf("# %zu tasks, throughput in Mtasks/s\n", tasks);
+  std::printf("%8s %12s %12s %12s %12s\n", "threads", "sync-inject",
+              "ws-inject", "sync-local", "ws-local");
+
+  for (std::size_t threads = 1; threads <= 128; threads *= 2) {
+    std::printf("%8zu %12.2f %12.2f %12.2f %12.2f\n", threads,
+                run<Shared_queue>(threads, tasks, false),
+                run<Work_stealing_queue>(threads, tasks, false),
+                run<Shared_queue>(threads, tasks, true),
+                run<Work_stealing_queue>(threads, tasks, true));
+  }
+}
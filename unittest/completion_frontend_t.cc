@@ -2400,4 +2400,54 @@ TEST_F(Completer_frontend, bug_34365581) {
   execute("DROP SCHEMA ogÓrek;");
 }
 
+TEST_F(Completer_frontend, background_refresh) {
+  connect_classic();
+  execute("\\sql");
+
+  const auto connections = [this]() {
+    wipe_all();
+    execute("SHOW GLOBAL STATUS LIKE 'Connections'\\G");
+
+    const auto &out = output_handler.std_out;
+    const auto pos = out.find("Value: ");
+    EXPECT_NE(std::string::npos, pos);
+
+    return std::stoull(out.substr(pos + 7));
+  };
+
+  // names are fetched using a separate session
+  wipe_all();
+  execute("\\rehash");
+  MY_EXPECT_STDOUT_CONTAINS("for auto-completion in the background.");
+
+  const auto initial_connections = connections();
+
+  // forced refresh is waited for, new names are available right away
+  execute("CREATE TABLE actest.refreshed_table (id INT);");
+  execute("\\rehash");
+  EXPECT_AFTER_TAB("SELECT actest.refreshed_t",
+                   "SELECT actest.refreshed_table");
+
+  // objects of the new schema are waited for, if they were not fetched yet
+  execute("\\use actest");
+  EXPECT_AFTER_TAB("SELECT refreshed_t", "SELECT refreshed_table");
+
+  execute("DROP TABLE actest.refreshed_table;");
+  execute("\\rehash");
+  EXPECT_TAB_DOES_NOTHING("SELECT actest.refreshed_t");
+
+  // an empty schema is marked as loaded, completion does not wait for it
+  execute("CREATE SCHEMA actest_empty;");
+  execute("\\rehash");
+  execute("\\use actest_empty");
+  EXPECT_TAB_DOES_NOTHING("SELECT refreshed_t");
+  execute("\\use actest");
+  execute("\\use actest_empty");
+  EXPECT_TAB_DOES_NOTHING("SELECT refreshed_t");
+  execute("DROP SCHEMA actest_empty;");
+
+  // the same session is used by all refreshes
+  EXPECT_EQ(initial_connections, connections());
+}
+
 }  // namespace mysqlsh
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "unittest/gprod_clean.h"
+
+#include <cstdlib>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "modules/util/dump/dump_schemas_options.h"
+#include "modules/util/dump/export_table_options.h"
+#include "modules/util/load/load_dump_options.h"
+#include "mysqlshdk/libs/storage/backend/object_storage_config.h"
+#include "mysqlshdk/libs/utils/utils_general.h"
+
+#include "unittest/gtest_clean.h"
+
+namespace mysqlsh {
+namespace dump {
+
+namespace {
+
+using mysqlshdk::storage::backend::object_storage::Config;
+
+class Aws_credentials final {
+ public:
+  Aws_credentials() {
+    set("AWS_ACCESS_KEY_ID", "access-key");
+    set("AWS_SECRET_ACCESS_KEY", "secret-key");
+  }
+
+  Aws_credentials(const Aws_credentials &) = delete;
+  Aws_credentials(Aws_credentials &&) = delete;
+
+  Aws_credentials &operator=(const Aws_credentials &) = delete;
+  Aws_credentials &operator=(Aws_credentials &&) = delete;
+
+  ~Aws_credentials() {
+    for (const auto &[name, value] : m_old_values) {
+      if (value.empty()) {
+        shcore::unsetenv(name);
+      } else {
+        shcore::setenv(name, value);
+      }
+    }
+  }
+
+ private:
+  void set(const std::string &name, const std::string &value) {
+    const auto old_value = ::getenv(name.c_str());
+    m_old_values.emplace_back(name, old_value ? old_value : "");
+    shcore::setenv(name, value);
+  }
+
+  std::vector<std::pair<std::string, std::string>> m_old_values;
+};
+
+template <typename Options>
+std::shared_ptr<const Config> object_storage_config(const Options &options) {
+  return std::dynamic_pointer_cast<const Config>(options.storage_config());
+}
+
+}  // namespace
+
+TEST(Dump_options, object_storage_parts_in_flight) {
+  Aws_credentials credentials;
+
+  for (const auto &[threads, expected] :
+       std::initializer_list<std::pair<int, std::size_t>>{
+           {1, 1}, {2, 2}, {4, 4}, {16, 4}}) {
+    SCOPED_TRACE("threads: " + std::to_string(threads));
+
+    Dump_schemas_options options;
+    Dump_schemas_options::options().unpack(
+        shcore::make_dict("s3BucketName", "bucket", "threads", threads),
+        &options);
+
+    const auto config = object_storage_config(options);
+    ASSERT_NE(nullptr, config);
+    EXPECT_EQ(expected, config->max_parts_in_flight());
+  }
+
+  {
+    // a single file is written, its parts are uploaded concurrently
+    Export_table_options options;
+    Export_table_options::options().unpack(
+        shcore::make_dict("s3BucketName", "bucket"), &options);
+
+    const auto config = object_storage_config(options);
+    ASSERT_NE(nullptr, config);
+    EXPECT_EQ(4, config->max_parts_in_flight());
+  }
+}
+
+TEST(Load_dump_options, object_storage_read_ahead) {
+  Aws_credentials credentials;
+
+  Load_dump_options options;
+  Load_dump_options::options().unpack(
+      shcore::make_dict("s3BucketName", "bucket", "progressFile", ""),
+      &options);
+
+  const auto config = object_storage_config(options);
+  ASSERT_NE(nullptr, config);
+  EXPECT_EQ(8 * 1024 * 1024, config->read_ahead_block_size());
+  EXPECT_EQ(2, config->read_ahead_blocks());
+}
+
+}  // namespace dump
+}  // namespace mysqlsh
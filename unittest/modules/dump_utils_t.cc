@@ -25,7 +25,14 @@
 
 #include <gtest/gtest_prod.h>
 #include <cstdlib>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_set>
 #include "modules/util/common/dump/utils.h"
+#include "mysqlshdk/libs/storage/backend/directory.h"
+#include "mysqlshdk/libs/utils/utils_file.h"
+#include "mysqlshdk/libs/utils/utils_path.h"
 #include "unittest/gtest_clean.h"
 
 #include "modules/util/load/dump_reader.h"
@@ -380,4 +387,100 @@ TEST_F(Dump_scheduler, load_scheduler) {
     test_scheduling(Dump_reader::schedule_chunk_proportionally, tables, 16);
   }
 }
+
+namespace {
+
+using File_info = mysqlshdk::storage::IDirectory::File_info;
+
+/**
+ * Emulates the incremental listing of an object storage: only the files which
+ * follow the last listed one are reported.
+ */
+class Incremental_directory : public mysqlshdk::storage::backend::Directory {
+ public:
+  using Directory::Directory;
+
+  std::unordered_set<File_info> list_files(
+      bool hidden_files = false) const override {
+    auto files = Directory::list_files(hidden_files);
+
+    m_listed.clear();
+
+    for (const auto &file : files) {
+      m_listed.emplace(file.name(), file.size());
+    }
+
+    return files;
+  }
+
+  std::unordered_set<File_info> list_files_incremental(
+      bool hidden_files = false) const override {
+    if (m_listed.empty()) {
+      return list_files(hidden_files);
+    }
+
+    const auto last = m_listed.rbegin()->first;
+
+    for (const auto &file : Directory::list_files(hidden_files)) {
+      if (file.name() > last) {
+        m_listed.emplace(file.name(), file.size());
+      }
+    }
+
+    std::unordered_set<File_info> files;
+
+    for (const auto &file : m_listed) {
+      files.emplace(file.first, file.second);
+    }
+
+    return files;
+  }
+
+ private:
+  mutable std::map<std::string, std::size_t> m_listed;
+};
+
+}  // namespace
+
+TEST(Dump_reader_test, list_files_incremental) {
+  const auto path =
+      shcore::path::join_path(getenv("TMPDIR"), "dump_reader_list_files");
+  shcore::create_directory(path);
+
+  const auto create_file = [&path](const std::string &name) {
+    shcore::create_file(shcore::path::join_path(path, name), "");
+  };
+
+  create_file("@.json");
+  create_file("s@t@@0.tsv.zst");
+
+  Dump_reader reader{std::make_unique<Incremental_directory>(path),
+                     Load_dump_options{}};
+
+  // first listing fetches everything
+  auto files = reader.list_files();
+  EXPECT_EQ(2u, files.size());
+
+  // files which follow the last one are found incrementally
+  create_file("s@t@@1.tsv.zst");
+  files = reader.list_files();
+  EXPECT_EQ(3u, files.size());
+  EXPECT_TRUE(files.count({"s@t@@1.tsv.zst"}));
+
+  // dump is complete, but "@.done.json" and the metadata precede the last
+  // file, they are found by the full listing triggered by "@.done.json", which
+  // is checked every few rescans
+  create_file("s@t.json");
+  create_file("@.done.json");
+  files = reader.list_files();
+  EXPECT_EQ(3u, files.size());
+
+  files = reader.list_files();
+  EXPECT_EQ(5u, files.size());
+  EXPECT_TRUE(files.count({"@.done.json"}));
+  EXPECT_TRUE(files.count({"s@t.json"}));
+
+  shcore::remove_directory(path);
+}
+
 }  // namespace mysqlsh
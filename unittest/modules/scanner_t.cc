@@ -42,7 +42,9 @@ namespace {
 void test_scanner(const std::string &data,
                   const std::vector<std::size_t> &row_lengths,
                   const Dialect &dialect,
-                  std::vector<std::size_t> skip_rows = {}) {
+                  std::vector<std::size_t> skip_rows = {},
+                  const std::vector<std::size_t> &block_lengths = {1, 2, 3,
+                                                                   4}) {
   SCOPED_TRACE("data: " + ::testing::PrintToString(data) +
                ", dialect: " + ::testing::PrintToString(dialect.build_sql()));
 
@@ -62,7 +64,7 @@ void test_scanner(const std::string &data,
   for (auto skip : skip_rows) {
     SCOPED_TRACE("skip: " + std::to_string(skip));
 
-    for (std::size_t length = 1; length < 5; ++length) {
+    for (const auto length : block_lengths) {
       SCOPED_TRACE("length: " + std::to_string(length));
 
       Scanner s{dialect, skip};
@@ -198,6 +200,40 @@ TEST(Scanner, rows) {
   }
 }
 
+TEST(Scanner, long_fields) {
+  // fields are long enough to be processed in multiple steps
+  const auto text = [](std::size_t length) {
+    std::string result;
+
+    while (result.length() < length) {
+      result += "abcdefghijklmnopqrstuvwxyz0123456789 ";
+    }
+
+    result.resize(length);
+    return result;
+  };
+
+  const auto t1 = text(70);
+  const auto t2 = text(200);
+
+  const std::string file =
+      t1 + ",'" + t2 + "'\n" +                      // 274
+      "'" + t1 + "\\'\n,''" + t2 + "'\n" +          // 279
+      "\\\n" + t2 + "\\\\" + "\\\n" + t1 + ",\n" +  // 278
+      "'" + t2 + "\n" + t1 + "'," + t1 + "\n" +     // 345
+      "'" + t2 + "'" + t1 + "',";                   // 274
+
+  Dialect dialect;
+  dialect.fields_enclosed_by = "'";
+  dialect.fields_escaped_by = "\\";
+  dialect.fields_terminated_by = ",";
+  dialect.lines_terminated_by = "\n";
+
+  // skipping rows does not take enclosed fields into account
+  test_scanner(file, {274, 279, 278, 345, 274}, dialect, {0, 1},
+               {1, 7, 16, 63, 64, 65, 128, file.length()});
+}
+
 }  // namespace
 }  // namespace import_table
 }  // namespace mysqlsh
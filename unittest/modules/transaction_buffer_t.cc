@@ -25,10 +25,14 @@
 
 #include "unittest/gprod_clean.h"
 
+#include <cinttypes>
 #include <cstdlib>
+#include <memory>
+#include <stdexcept>
 
 #include "modules/util/import_table/load_data.h"
 #include "mysqlshdk/libs/storage/backend/memory_file.h"
+#include "mysqlshdk/libs/storage/compressed_file.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 #include "unittest/gtest_clean.h"
 #include "unittest/test_utils.h"
@@ -220,5 +224,159 @@ TEST(Transaction_buffer, test_subchunking) {
   std::cout << count << "\n";
 }
 
+TEST(Transaction_buffer, find_row_start) {
+  mysqlshdk::storage::backend::Memory_file mfile("-");
+
+  const auto find = [&mfile](const Dialect &dialect, uint64_t offset) {
+    mfile.open(mysqlshdk::storage::Mode::READ);
+    const auto result = find_row_start(dialect, &mfile, offset);
+    mfile.close();
+    return result;
+  };
+
+  {
+    mfile.set_content("1\tone\n22\ttwo\n333\tthree\n");
+    const auto dialect = Dialect::default_();
+
+    EXPECT_EQ(6, find(dialect, 0));
+    EXPECT_EQ(6, find(dialect, 5));
+    EXPECT_EQ(13, find(dialect, 6));
+    EXPECT_EQ(13, find(dialect, 12));
+    EXPECT_EQ(23, find(dialect, 13));
+    EXPECT_FALSE(find(dialect, 23).has_value());
+    EXPECT_FALSE(find(dialect, 100).has_value());
+  }
+
+  {
+    // escaped terminators are not row boundaries
+    mfile.set_content("1,\"o\\\r\nne\"\r\n2,two\r\n");
+    const auto dialect = Dialect::csv();
+
+    EXPECT_EQ(12, find(dialect, 0));
+    EXPECT_EQ(12, find(dialect, 5));
+    EXPECT_EQ(19, find(dialect, 12));
+    EXPECT_FALSE(find(dialect, 19).has_value());
+  }
+
+  {
+    // terminator at the beginning of the file
+    mfile.set_content("\n1\n");
+    const auto dialect = Dialect::csv_unix();
+
+    EXPECT_EQ(1, find(dialect, 0));
+    EXPECT_EQ(3, find(dialect, 1));
+  }
+
+  {
+    // data before the offset is not read, file has to support seeking
+    const auto gz_file = mysqlshdk::storage::make_file(
+        std::make_unique<mysqlshdk::storage::backend::Memory_file>("-"),
+        mysqlshdk::storage::Compression::GZIP);
+    const std::string content = "1\tone\n22\ttwo\n";
+
+    gz_file->open(mysqlshdk::storage::Mode::WRITE);
+    gz_file->write(content.data(), content.size());
+    gz_file->close();
+
+    gz_file->open(mysqlshdk::storage::Mode::READ);
+    EXPECT_THROW(find_row_start(Dialect::default_(), gz_file.get(), 5),
+                 std::logic_error);
+    gz_file->close();
+  }
+}
+
+TEST(Transaction_buffer, split_range) {
+  std::string data;
+
+  for (int i = 0; i < 100; ++i) {
+    append_row(&data, i % 17);
+  }
+
+  for (std::size_t read_before_split = 0; read_before_split < data.size();
+       read_before_split += 7) {
+    for (const uint64_t max_trx_size : {0, 50}) {
+      SCOPED_TRACE(shcore::str_format("read_before_split: %zu, trx: %" PRIu64,
+                                      read_before_split, max_trx_size));
+
+      mysqlshdk::storage::backend::Memory_file mfile("-");
+      mfile.set_content(data);
+      mfile.open(mysqlshdk::storage::Mode::READ);
+
+      Transaction_options options;
+      options.max_trx_size = max_trx_size;
+      options.range = std::make_shared<File_range>(0);
+      Transaction_buffer buffer(Dialect::default_(), &mfile, options);
+
+      std::string loaded;
+      std::string net_buffer;
+      net_buffer.resize(13);
+
+      const auto read = [&](Transaction_buffer *b, std::string *out) {
+        bool has_more = true;
+
+        while (has_more) {
+          int bytes;
+
+          while ((bytes = b->read(&net_buffer[0], net_buffer.size())) > 0) {
+            out->append(&net_buffer[0], bytes);
+          }
+
+          ASSERT_EQ(0, bytes);
+          b->flush_done(&has_more);
+        }
+      };
+
+      while (loaded.size() < read_before_split) {
+        const auto bytes = buffer.read(&net_buffer[0], net_buffer.size());
+
+        if (bytes <= 0) {
+          break;
+        }
+
+        loaded.append(&net_buffer[0], bytes);
+      }
+
+      // split in the middle of the remaining data
+      const auto offset = options.range->position() +
+                          (data.size() - options.range->position()) / 2;
+      mysqlshdk::storage::backend::Memory_file split_file("-");
+      split_file.set_content(data);
+      split_file.open(mysqlshdk::storage::Mode::READ);
+      const auto row = find_row_start(Dialect::default_(), &split_file, offset);
+      split_file.close();
+
+      std::shared_ptr<File_range> split;
+
+      if (row.has_value()) {
+        split = options.range->split(*row);
+      }
+
+      read(&buffer, &loaded);
+
+      if (split) {
+        EXPECT_EQ(split->begin(), options.range->end());
+        EXPECT_EQ(split->begin(), loaded.size());
+
+        Transaction_options split_options;
+        split_options.max_trx_size = max_trx_size;
+        split_options.skip_bytes = split->begin();
+        split_options.range = split;
+        split_file.open(mysqlshdk::storage::Mode::READ);
+        Transaction_buffer split_buffer(Dialect::default_(), &split_file,
+                                        split_options);
+
+        std::string split_loaded;
+        read(&split_buffer, &split_loaded);
+
+        EXPECT_EQ('\n', loaded.back());
+        EXPECT_EQ(data.size(), split->position());
+        loaded.append(split_loaded);
+      }
+
+      EXPECT_EQ(data, loaded);
+    }
+  }
+}
+
 }  // namespace import_table
 }  // namespace mysqlsh
@@ -637,6 +637,30 @@ TEST(Upgrade_check_options, set_target_version) {
   EXPECT_EQ(Version(8, 0, 34), options.target_version);
 }
 
+TEST(Upgrade_check_options, threads) {
+  {
+    Upgrade_check_options options;
+    Upgrade_check_options::options().unpack(shcore::make_dict(), &options);
+    EXPECT_EQ(4u, options.threads);
+  }
+
+  {
+    Upgrade_check_options options;
+    Upgrade_check_options::options().unpack(shcore::make_dict("threads", 8),
+                                            &options);
+    EXPECT_EQ(8u, options.threads);
+  }
+
+  {
+    Upgrade_check_options options;
+    EXPECT_THROW_LIKE(Upgrade_check_options::options().unpack(
+                          shcore::make_dict("threads", 0), &options),
+                      std::invalid_argument,
+                      "The value of the 'threads' option must be greater "
+                      "than 0.");
+  }
+}
+
 TEST_F(MySQL_upgrade_check_test, upgrade_info_validation) {
   // First Check - No lower than 5.7
   {
@@ -2453,6 +2477,9 @@ TEST_F(MySQL_upgrade_check_test, JSON_output_format) {
       ASSERT_TRUE(checks[i]["title"].IsString());
       ASSERT_TRUE(checks[i].HasMember("status"));
       ASSERT_TRUE(checks[i]["status"].IsString());
+      ASSERT_TRUE(checks[i].HasMember("executionTime"));
+      ASSERT_TRUE(checks[i]["executionTime"].IsNumber());
+      EXPECT_GE(checks[i]["executionTime"].GetDouble(), 0.0);
       if (checks[i].HasMember("documentationLink")) {
         ASSERT_TRUE(checks[i]["documentationLink"].IsString());
       }
@@ -4107,6 +4134,35 @@ TEST_F(MySQL_upgrade_check_test, options_filter_json) {
   }
 }
 
+TEST_F(MySQL_upgrade_check_test, threads) {
+  SKIP_IF_NOT_5_7_UP_TO(Version(8, 4, 0));
+
+  Util util(_interactive_shell->shell_context().get());
+  const auto connection_options =
+      mysqlshdk::db::Connection_options(_mysql_uri);
+
+  const auto check = [&](uint64_t threads) {
+    // clear stdout/stderr garbage
+    reset_shell();
+    output_handler.wipe_all();
+
+    shcore::Option_pack_ref<Upgrade_check_options> options;
+    options->threads = threads;
+    util.check_for_server_upgrade(connection_options, options);
+
+    return output_handler.std_out;
+  };
+
+  const auto expected = check(1);
+  EXPECT_FALSE(expected.empty());
+
+  // checks executed concurrently report the same results, in the same order
+  for (const uint64_t threads : {2, 4, 16}) {
+    SCOPED_TRACE("threads: " + std::to_string(threads));
+    EXPECT_EQ(expected, check(threads));
+  }
+}
+
 TEST_F(MySQL_upgrade_check_test, partitions_with_prefix_keys) {
   info.server_version = Version(8, 0, 3);
   info.target_version = mysqlshdk::utils::k_shell_version;
@@ -32,6 +32,7 @@
 #include <set>
 #include <string>
 
+#include "mysqlshdk/libs/utils/ssl_keygen.h"
 #include "mysqlshdk/libs/utils/utils_string.h"
 
 namespace mysqlshdk {
@@ -39,7 +40,7 @@ namespace aws {
 
 class Aws_signer_test : public testing::Test {
  protected:
-  static Aws_signer create_signer() {
+  static Aws_signer create_signer(bool unsigned_payload = false) {
     Aws_signer signer;
 
     signer.m_host = k_host;
@@ -47,6 +48,7 @@ class Aws_signer_test : public testing::Test {
         k_access_key_id, "wJalrXUtnFEMI/K7MDENG/bPxRfiCYEXAMPLEKEY"));
     signer.m_region = k_region;
     signer.m_sign_all_headers = true;
+    signer.m_unsigned_payload = unsigned_payload;
 
     return signer;
   }
@@ -54,8 +56,10 @@ class Aws_signer_test : public testing::Test {
   static void test_sign_request(
       const rest::Signed_request *request, const std::string &signature,
       const std::string &sha256 =
-          "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855") {
-    const auto headers = create_signer().sign_request(request, k_now);
+          "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+      bool unsigned_payload = false) {
+    const auto headers =
+        create_signer(unsigned_payload).sign_request(request, k_now);
 
     ASSERT_NE(headers.end(), headers.find("Host"));
     EXPECT_EQ(k_host, headers.at("Host"));
@@ -130,6 +134,53 @@ TEST_F(Aws_signer_test, put_object) {
       "44ce7dd67c959e0d3524ffac1771dfbba87d2b6b4b4e99e42034a8b803f8b072");
 }
 
+TEST_F(Aws_signer_test, put_object_precomputed_hash) {
+  rest::Signed_request request{"/test%24file.text",
+                               {{"Date", "Fri, 24 May 2013 00:00:00 GMT"},
+                                {"x-amz-storage-class", "REDUCED_REDUNDANCY"}}};
+  request.type = rest::Type::PUT;
+
+  // body is not hashed if its hash is provided
+  const std::string data = "Welcome to Amazon S3.";
+  const std::string body(data.length(), 'x');
+  request.body = body.c_str();
+  request.size = body.length();
+  request.body_sha256 = shcore::ssl::sha256(data.c_str(), data.length());
+
+  test_sign_request(
+      &request,
+      "98ad721746da40c64f1a55b78f14c238d841ea1380cd77a1b5971af0ece108bd",
+      "44ce7dd67c959e0d3524ffac1771dfbba87d2b6b4b4e99e42034a8b803f8b072");
+}
+
+TEST_F(Aws_signer_test, put_object_unsigned_payload) {
+  rest::Signed_request request{"/test%24file.text",
+                               {{"Date", "Fri, 24 May 2013 00:00:00 GMT"},
+                                {"x-amz-storage-class", "REDUCED_REDUNDANCY"}}};
+  request.type = rest::Type::PUT;
+
+  const std::string data = "Welcome to Amazon S3.";
+  request.body = data.c_str();
+  request.size = data.length();
+
+  test_sign_request(
+      &request,
+      "91c6efc02b5801e55e03b4a83a22d6b4f85a6010fa94d5a87f88e41c5ee1bf46",
+      "UNSIGNED-PAYLOAD", true);
+}
+
+TEST_F(Aws_signer_test, get_object_unsigned_payload) {
+  rest::Signed_request request{"/test.txt", {{"Range", "bytes=0-9"}}};
+  request.type = rest::Type::GET;
+
+  // requests without a body use hash of an empty payload
+  test_sign_request(
+      &request,
+      "f0e8bdb87c964420e857bd35b5d6ed310bd44f0170aba48dd91039c6036bdb41",
+      "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+      true);
+}
+
 TEST_F(Aws_signer_test, get_bucket_lifecycle) {
   rest::Signed_request request{"/?lifecycle"};
   request.type = rest::Type::GET;
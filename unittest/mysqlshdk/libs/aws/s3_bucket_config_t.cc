@@ -624,6 +624,43 @@ TEST_F(Aws_s3_bucket_config_test, endpoint) {
   }
 }
 
+TEST_F(Aws_s3_bucket_config_test, payload_signing) {
+  const auto unsigned_payload_config =
+      default_config() + "s3 =\n  payload_signing_enabled = false\n";
+
+  {
+    // payload is signed by default
+    Cleanup c;
+    c += clear_aws_env_vars();
+    c += write_default_config(default_config());
+
+    EXPECT_FALSE(Config_builder{}.build()->unsigned_payload());
+  }
+
+  {
+    // payload signing is disabled, HTTPS is used
+    Cleanup c;
+    c += clear_aws_env_vars();
+    c += write_default_config(unsigned_payload_config);
+
+    EXPECT_TRUE(Config_builder{}.build()->unsigned_payload());
+    EXPECT_TRUE(
+        Config_builder{}.endpoint(k_endpoint).build()->unsigned_payload());
+  }
+
+  {
+    // payload signing is disabled, but HTTPS is not used
+    Cleanup c;
+    c += clear_aws_env_vars();
+    c += write_default_config(unsigned_payload_config);
+
+    EXPECT_FALSE(Config_builder{}
+                     .endpoint("http://example.com")
+                     .build()
+                     ->unsigned_payload());
+  }
+}
+
 TEST_F(Aws_s3_bucket_config_test, env_var_credentials) {
   Cleanup cleanup;
   cleanup += write_default_credentials(invalid_config(true));
@@ -30,6 +30,7 @@
 using mysqlshdk::rest::Response_error;
 using mysqlshdk::storage::Mode;
 using mysqlshdk::storage::backend::object_storage::Directory;
+using mysqlshdk::storage::backend::object_storage::Object;
 
 namespace mysqlshdk {
 namespace aws {
@@ -135,6 +136,54 @@ TEST_P(Object_storage_test, directory_list_files) {
   clean_bucket(bucket);
 }
 
+TEST_P(Object_storage_test, directory_list_files_incremental) {
+  SKIP_IF_NO_AWS_CONFIGURATION;
+
+  const auto config = get_config();
+  S3_bucket bucket(config);
+  Directory dir(config, "dump");
+
+  using set = std::unordered_set<mysqlshdk::storage::IDirectory::File_info>;
+
+  // first listing fetches everything
+  EXPECT_TRUE(dir.list_files_incremental().empty());
+
+  bucket.put_object("dump/b.tsv", "0123456789", 10);
+  EXPECT_EQ((set{{"b.tsv"}}), dir.list_files_incremental());
+
+  // objects which follow the last one are found
+  bucket.put_object("dump/c.tsv", "01234", 5);
+  EXPECT_EQ((set{{"b.tsv"}, {"c.tsv"}}), dir.list_files_incremental());
+
+  // objects which precede the last one are found only by the full listing
+  bucket.put_object("dump/a.tsv", "0", 1);
+  EXPECT_EQ((set{{"b.tsv"}, {"c.tsv"}}), dir.list_files_incremental());
+  EXPECT_EQ((set{{"a.tsv"}, {"b.tsv"}, {"c.tsv"}}), dir.list_files());
+
+  // sizes are reported and reused by files
+  for (const auto &file : dir.list_files_incremental()) {
+    EXPECT_EQ(file.size(), dir.file(file.name())->file_size());
+  }
+
+  {
+    const auto file = dir.file("c.tsv");
+    file->open(Mode::READ);
+    EXPECT_EQ(5, file->file_size());
+    file->close();
+  }
+
+  {
+    // size is not reused once file is written
+    const auto file = dir.file("c.tsv");
+    file->open(Mode::WRITE);
+    file->write("012", 3);
+    file->close();
+    EXPECT_EQ(3, file->file_size());
+  }
+
+  clean_bucket(bucket);
+}
+
 TEST_P(Object_storage_test, file_errors) {
   SKIP_IF_NO_AWS_CONFIGURATION;
 
@@ -234,6 +283,149 @@ TEST_P(Object_storage_test, file_write_multipart_upload) {
   bucket.delete_object("test/sample\".txt");
 }
 
+TEST_P(Object_storage_test, file_write_concurrent_multipart_upload) {
+  SKIP_IF_NO_AWS_CONFIGURATION;
+
+  auto config = get_config();
+  config->set_part_size(k_min_part_size);
+  config->set_max_parts_in_flight(3);
+  S3_bucket bucket(config);
+  Directory root(config, "test");
+
+  auto file = root.file("concurrent.txt");
+
+  // 5 full parts + a smaller one
+  const auto total_size = 5 * k_min_part_size + 1024;
+  const auto data = shcore::get_random_string(total_size, "0123456789ABCDEF");
+  size_t offset = 0;
+
+  file->open(Mode::WRITE);
+
+  while (offset < total_size) {
+    // write sizes which are not aligned with the part size
+    offset += file->write(data.data() + offset,
+                          std::min(k_min_part_size / 3, total_size - offset));
+  }
+
+  EXPECT_EQ(total_size, file->file_size());
+
+  file->close();
+
+  EXPECT_TRUE(bucket.list_multipart_uploads().empty());
+
+  file->open(Mode::READ);
+  std::string buffer;
+  buffer.resize(total_size + 5);
+  size_t read = 0;
+
+  while (read < total_size) {
+    const auto result = file->read(buffer.data() + read, buffer.size() - read);
+    ASSERT_GT(result, 0);
+    read += result;
+  }
+
+  EXPECT_EQ(total_size, read);
+  buffer.resize(read);
+  EXPECT_EQ(data, buffer);
+  file->close();
+
+  bucket.delete_object("test/concurrent.txt");
+}
+
+TEST_P(Object_storage_test, file_write_concurrent_multipart_errors) {
+  SKIP_IF_NO_AWS_CONFIGURATION;
+
+  auto config = get_config();
+  config->set_part_size(k_min_part_size);
+  config->set_max_parts_in_flight(2);
+  S3_bucket bucket(config);
+  Directory root(config);
+
+  auto mpo = bucket.create_multipart_upload("sample.txt");
+  auto file = root.file("sample.txt");
+
+  file->open(Mode::APPEND);
+
+  bucket.abort_multipart_upload(mpo);
+
+  const auto data = multipart_file_data();
+
+  // error is reported either by the subsequent write() or by close()
+  EXPECT_THROW_LIKE(
+      {
+        file->write(data.data(), data.size());
+        file->write(data.data(), data.size());
+        file->close();
+      },
+      shcore::Exception, "Failed to upload part ");
+
+  // upload was aborted, there's not going to be any more communication with
+  // the server
+  EXPECT_NO_THROW(file->close());
+  EXPECT_TRUE(bucket.list_multipart_uploads().empty());
+}
+
+TEST_P(Object_storage_test, file_read_ahead) {
+  SKIP_IF_NO_AWS_CONFIGURATION;
+
+  auto config = get_config();
+  config->set_read_ahead_block_size(1000);
+  config->set_read_ahead_blocks(3);
+  S3_bucket bucket(config);
+  Directory root(config);
+
+  const std::size_t total_size = 10 * 1000 + 123;
+  const auto data = shcore::get_random_string(total_size, "0123456789ABCDEF");
+  bucket.put_object("read_ahead.txt", data.data(), data.size());
+
+  auto file = root.file("read_ahead.txt");
+  const auto object = dynamic_cast<Object *>(file.get());
+  ASSERT_NE(nullptr, object);
+
+  const auto read_all = [&file](std::size_t chunk) {
+    std::string result;
+    std::string buffer;
+    buffer.resize(chunk);
+
+    while (true) {
+      const auto read = file->read(buffer.data(), buffer.size());
+
+      if (read <= 0) {
+        break;
+      }
+
+      result.append(buffer.data(), read);
+    }
+
+    return result;
+  };
+
+  file->open(Mode::READ);
+
+  // reads smaller than a block, crossing the block boundaries
+  EXPECT_EQ(data, read_all(333));
+
+  // reads bigger than a block
+  file->seek(0);
+  EXPECT_EQ(data, read_all(2500));
+
+  // seek in the middle of a block
+  file->seek(4567);
+  EXPECT_EQ(data.substr(4567), read_all(100));
+
+  // seek past the end
+  file->seek(total_size + 10);
+  EXPECT_EQ("", read_all(100));
+
+  file->close();
+
+  const auto stats = object->read_ahead_stats();
+  EXPECT_LT(0, stats.hits);
+  EXPECT_LT(0, stats.misses);
+
+  bucket.delete_object("read_ahead.txt");
+}
+
 TEST_P(Object_storage_test, file_append_new_file) {
   SKIP_IF_NO_AWS_CONFIGURATION;
 
@@ -140,7 +140,7 @@ class Azure_signer_test : public testing::Test {
 TEST_F(Azure_signer_test, azure_requests) {
   Blob_container container(m_config);
 
-  auto request = container.list_objects_request("", 0, true, {}, "");
+  auto request = container.list_objects_request("", 0, true, {}, "", "");
   request.type = mysqlshdk::rest::Type::GET;
   test_sign_request(
       "LIST OBJECTS", &request,
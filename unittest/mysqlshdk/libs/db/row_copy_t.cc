@@ -0,0 +1,375 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+#include "mysqlshdk/libs/db/row_copy.h"
+
+namespace mysqlshdk {
+namespace db {
+
+namespace {
+
+const std::vector<Type> k_all_types = {
+    Type::Null,     Type::String, Type::Integer, Type::UInteger,
+    Type::Float,    Type::Double, Type::Decimal, Type::Bytes,
+    Type::Geometry, Type::Json,   Type::Date,    Type::Time,
+    Type::DateTime, Type::Bit,    Type::Enum,    Type::Set};
+
+Mutable_row all_types_row() {
+  return Mutable_row(k_all_types, nullptr, std::string("string"),
+                     int64_t{-1234}, uint64_t{18446744073709551615ULL}, 1.5f,
+                     -2.25, std::string("-12.34"), std::string("by\0tes", 6),
+                     std::string("\x01\x02\x03", 3), std::string("{\"a\": 1}"),
+                     std::string("2024-01-02"), std::string("03:04:05"),
+                     std::string("2024-01-02 03:04:05"), std::string("101"),
+                     std::string("enum"), std::string("a,b"));
+}
+
+void expect_same_row(const IRow &expected, const IRow &actual) {
+  ASSERT_EQ(expected.num_fields(), actual.num_fields());
+
+  for (uint32_t i = 0; i < expected.num_fields(); ++i) {
+    SCOPED_TRACE("field " + std::to_string(i));
+
+    EXPECT_EQ(expected.get_type(i), actual.get_type(i));
+    EXPECT_EQ(expected.is_null(i), actual.is_null(i));
+    EXPECT_EQ(expected.get_as_string(i), actual.get_as_string(i));
+
+    if (expected.is_null(i)) continue;
+
+    const char *expected_data;
+    size_t expected_size;
+    const char *actual_data;
+    size_t actual_size;
+
+    expected.get_raw_data(i, &expected_data, &expected_size);
+    actual.get_raw_data(i, &actual_data, &actual_size);
+    EXPECT_EQ(std::string(expected_data, expected_size),
+              std::string(actual_data, actual_size));
+
+    switch (expected.get_type(i)) {
+      case Type::Null:
+        break;
+
+      case Type::String:
+      case Type::Bytes: {
+        const auto e = expected.get_string_data(i);
+        const auto a = actual.get_string_data(i);
+        EXPECT_EQ(std::string(e.first, e.second),
+                  std::string(a.first, a.second));
+        EXPECT_EQ(expected.get_string(i), actual.get_string(i));
+        break;
+      }
+
+      case Type::Geometry:
+      case Type::Json:
+      case Type::Date:
+      case Type::Time:
+      case Type::DateTime:
+      case Type::Enum:
+      case Type::Set:
+        EXPECT_EQ(expected.get_string(i), actual.get_string(i));
+        break;
+
+      case Type::Integer:
+        EXPECT_EQ(expected.get_int(i), actual.get_int(i));
+        break;
+
+      case Type::UInteger:
+        EXPECT_EQ(expected.get_uint(i), actual.get_uint(i));
+        break;
+
+      case Type::Float:
+        EXPECT_EQ(expected.get_float(i), actual.get_float(i));
+        EXPECT_EQ(expected.get_double(i), actual.get_double(i));
+        break;
+
+      case Type::Double:
+        EXPECT_EQ(expected.get_double(i), actual.get_double(i));
+        break;
+
+      case Type::Decimal:
+        EXPECT_EQ(expected.get_double(i), actual.get_double(i));
+        EXPECT_EQ(expected.get_float(i), actual.get_float(i));
+        break;
+
+      case Type::Bit:
+        EXPECT_EQ(expected.get_bit(i), actual.get_bit(i));
+        break;
+    }
+  }
+}
+
+}  // namespace
+
+TEST(Row_arena, allocate) {
+  Row_arena arena{1024};
+  EXPECT_EQ(0u, arena.capacity());
+
+  const auto first = static_cast<char *>(arena.allocate(10));
+  EXPECT_EQ(1024u, arena.capacity());
+
+  // allocations are aligned as requested
+  for (const std::size_t alignment : {1, 2, 4, 8, 16}) {
+    SCOPED_TRACE("alignment " + std::to_string(alignment));
+
+    arena.allocate(1);
+    const auto ptr = arena.allocate(8, alignment);
+    EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(ptr) % alignment);
+  }
+
+  // memory is allocated from the same block
+  const auto next = static_cast<char *>(arena.allocate(10));
+  EXPECT_LT(first, next);
+  EXPECT_GT(first + 1024, next);
+  EXPECT_EQ(1024u, arena.capacity());
+
+  // allocated memory can be written to
+  ::memset(first, 'a', 10);
+  ::memset(next, 'b', 10);
+  EXPECT_EQ(std::string(10, 'a'), std::string(first, 10));
+}
+
+TEST(Row_arena, growth) {
+  Row_arena arena{1024};
+
+  // allocations which do not fit in the current block start a new block
+  arena.allocate(500);
+  arena.allocate(500);
+  EXPECT_EQ(1024u, arena.capacity());
+
+  arena.allocate(500);
+  EXPECT_EQ(2048u, arena.capacity());
+
+  // allocations bigger than half of the block get a dedicated block, current
+  // block is still used
+  const auto large = arena.allocate(513);
+  EXPECT_EQ(2048u + 513, arena.capacity());
+  EXPECT_NE(nullptr, large);
+
+  arena.allocate(500);
+  EXPECT_EQ(2048u + 513, arena.capacity());
+
+  // allocation bigger than the block size
+  arena.allocate(10000);
+  EXPECT_EQ(2048u + 513 + 10000, arena.capacity());
+}
+
+TEST(Row_arena, reuse) {
+  Row_arena arena{1024};
+
+  // clearing an empty arena is fine
+  arena.clear();
+  EXPECT_EQ(0u, arena.capacity());
+
+  const auto first = arena.allocate(100);
+
+  for (int i = 0; i < 10; ++i) {
+    arena.allocate(500);
+  }
+
+  arena.allocate(5000);
+  EXPECT_LT(1024u + 5000, arena.capacity());
+
+  // first block is kept
+  arena.clear();
+  EXPECT_EQ(1024u, arena.capacity());
+
+  // and memory is allocated from its beginning
+  EXPECT_EQ(first, arena.allocate(100));
+  EXPECT_EQ(1024u, arena.capacity());
+}
+
+TEST(Row_arena, move) {
+  Row_arena arena{1024};
+  const auto first = static_cast<char *>(arena.allocate(100));
+  ::memset(first, 'a', 100);
+
+  // memory is owned by the new arena, the old one is empty
+  Row_arena moved{std::move(arena)};
+  EXPECT_EQ(1024u, moved.capacity());
+  EXPECT_EQ(0u, arena.capacity());  // NOLINT(bugprone-use-after-move)
+  EXPECT_EQ(std::string(100, 'a'), std::string(first, 100));
+
+  // moved-from arena does not use the blocks it no longer owns
+  const auto other = static_cast<char *>(arena.allocate(100));
+  EXPECT_EQ(1024u, arena.capacity());
+  EXPECT_TRUE(other < first || other >= first + 1024);
+
+  // move assignment releases the old memory
+  arena = std::move(moved);
+  EXPECT_EQ(1024u, arena.capacity());
+  EXPECT_EQ(0u, moved.capacity());  // NOLINT(bugprone-use-after-move)
+  EXPECT_EQ(first + 100, arena.allocate(100));
+}
+
+TEST(Flat_row, all_types) {
+  const auto source = all_types_row();
+  Row_arena arena;
+  const Flat_row row{source, &arena};
+
+  expect_same_row(source, row);
+  expect_same_row(Row_copy{source}, row);
+
+  EXPECT_EQ(-1234, row.get_int(2));
+  EXPECT_EQ(18446744073709551615ULL, row.get_uint(3));
+  EXPECT_EQ(1.5f, row.get_float(4));
+  EXPECT_EQ(-2.25, row.get_double(5));
+  EXPECT_EQ("-12.34", row.get_as_string(6));
+  EXPECT_EQ(std::string("by\0tes", 6), row.get_string(7));
+  EXPECT_EQ(std::make_tuple(uint64_t{5}, 3), row.get_bit(13));
+
+  // String and Bytes values point to the arena
+  const auto data = row.get_string_data(1);
+  EXPECT_EQ("string", std::string(data.first, data.second));
+
+  // moved row refers to the same data
+  Flat_row other{source, &arena};
+  const auto other_data = other.get_string_data(1);
+  const Flat_row moved{std::move(other)};
+  EXPECT_EQ(other_data, moved.get_string_data(1));
+  expect_same_row(source, moved);
+}
+
+TEST(Flat_row, nulls) {
+  Mutable_row source{k_all_types};
+
+  for (uint32_t i = 0; i < source.num_fields(); ++i) {
+    source.set_field(i, nullptr);
+  }
+
+  Row_arena arena;
+  const Flat_row row{source, &arena};
+
+  expect_same_row(source, row);
+
+  for (uint32_t i = 0; i < row.num_fields(); ++i) {
+    SCOPED_TRACE("field " + std::to_string(i));
+
+    EXPECT_TRUE(row.is_null(i));
+    EXPECT_EQ("NULL", row.get_as_string(i));
+
+    const char *data = "x";
+    size_t size = 1;
+    row.get_raw_data(i, &data, &size);
+    EXPECT_EQ(nullptr, data);
+    EXPECT_EQ(0u, size);
+  }
+}
+
+TEST(Flat_row, empty_values) {
+  const std::vector<Type> types = {Type::String, Type::Bytes, Type::Json};
+  const Mutable_row source{types, std::string(), std::string(), std::string()};
+  Row_arena arena;
+  const Flat_row row{source, &arena};
+
+  expect_same_row(source, row);
+
+  for (uint32_t i = 0; i < row.num_fields(); ++i) {
+    EXPECT_FALSE(row.is_null(i));
+    EXPECT_EQ("", row.get_string(i));
+  }
+}
+
+TEST(Flat_row, conversions) {
+  const std::vector<Type> types = {Type::Integer, Type::UInteger,
+                                   Type::Decimal, Type::Decimal,
+                                   Type::Integer, Type::UInteger};
+  const Mutable_row source{types,         int64_t{-1},
+                           uint64_t{100}, std::string("123"),
+                           std::string("-5"), int64_t{7},
+                           uint64_t{18446744073709551615ULL}};
+  Row_arena arena;
+  const Flat_row row{source, &arena};
+
+  // values are converted and validated the same way as in Mem_row
+  for (const IRow *r : {static_cast<const IRow *>(&source),
+                        static_cast<const IRow *>(&row)}) {
+    EXPECT_THROW(r->get_uint(0), std::invalid_argument);
+    EXPECT_EQ(100, r->get_int(1));
+    EXPECT_EQ(123, r->get_int(2));
+    EXPECT_EQ(123u, r->get_uint(2));
+    EXPECT_EQ(-5, r->get_int(3));
+    EXPECT_THROW(r->get_uint(3), std::invalid_argument);
+    EXPECT_EQ(7u, r->get_uint(4));
+    EXPECT_THROW(r->get_int(5), std::invalid_argument);
+
+    // wrong type
+    EXPECT_THROW(r->get_string(0), std::invalid_argument);
+    EXPECT_THROW(r->get_double(0), std::invalid_argument);
+    EXPECT_THROW(r->get_bit(1), std::invalid_argument);
+
+    // wrong index
+    EXPECT_THROW(r->get_type(6), std::invalid_argument);
+    EXPECT_THROW(r->is_null(6), std::invalid_argument);
+  }
+}
+
+TEST(Flat_row, arena_growth_and_reuse) {
+  const auto source = all_types_row();
+  const std::vector<Type> types = {Type::Integer, Type::String};
+  const Mutable_row large{types, int64_t{1}, std::string(3000, 'x')};
+  Row_arena arena{1024};
+
+  // rows which do not fit in a single block
+  std::vector<Flat_row> rows;
+
+  for (int i = 0; i < 100; ++i) {
+    rows.emplace_back(source, &arena);
+    rows.emplace_back(large, &arena);
+  }
+
+  EXPECT_LT(1024u, arena.capacity());
+
+  // rows created earlier are not affected by the new ones
+  for (std::size_t i = 0; i < rows.size(); i += 2) {
+    SCOPED_TRACE("row " + std::to_string(i));
+    expect_same_row(source, rows[i]);
+    expect_same_row(large, rows[i + 1]);
+  }
+
+  rows.clear();
+  arena.clear();
+  EXPECT_EQ(1024u, arena.capacity());
+
+  // memory is reused for the new rows
+  for (int i = 0; i < 10; ++i) {
+    rows.emplace_back(source, &arena);
+  }
+
+  for (const auto &row : rows) {
+    expect_same_row(source, row);
+  }
+}
+
+}  // namespace db
+}  // namespace mysqlshdk
@@ -25,6 +25,10 @@
 
 #include "mysqlshdk/libs/mysql/gtid_utils.h"
 
+#include <random>
+#include <string>
+#include <vector>
+
 #include "mysqlshdk/libs/db/session.h"
 #include "mysqlshdk/libs/mysql/instance.h"
 #include "unittest/test_utils/mocks/mysqlshdk/libs/db/mock_mysql_session.h"
@@ -81,12 +85,8 @@ TEST_F(Gtid_utils, gtid_set_basics) {
 
   EXPECT_THROW(gs2_s.count(), std::invalid_argument);
 
-  auto session = db::mysql::Session::create();
-  session->connect(db::Connection_options(_mysql_uri));
-  mysqlshdk::mysql::Instance server(session);
-
-  gs2_s.normalize(server);
-  gs6.normalize(server);
+  gs2_s.normalize();
+  gs6.normalize();
 
   EXPECT_EQ(gs2_r, gs2_s);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43", gs2_r.str());
@@ -111,19 +111,19 @@ TEST_F(Gtid_utils, gtid_set_basics) {
   EXPECT_FALSE(gs2.empty());
   EXPECT_EQ(43, gs2.count());
 
-  EXPECT_TRUE(gs2_r.contains(gs2_s, server));
-  EXPECT_TRUE(gs2_r.contains(gs2_s, server));
-  EXPECT_TRUE(gs2.contains(gs3, server));
-  EXPECT_FALSE(gs3.contains(gs2, server));
+  EXPECT_TRUE(gs2_r.contains(gs2_s));
+  EXPECT_TRUE(gs2_r.contains(gs2_s));
+  EXPECT_TRUE(gs2.contains(gs3));
+  EXPECT_FALSE(gs3.contains(gs2));
 
-  EXPECT_FALSE(gs2.contains(gs4, server));
-  EXPECT_FALSE(gs4.contains(gs2, server));
+  EXPECT_FALSE(gs2.contains(gs4));
+  EXPECT_FALSE(gs4.contains(gs2));
 
-  EXPECT_FALSE(gs2.contains(gs5, server));
-  EXPECT_FALSE(gs5.contains(gs2, server));
+  EXPECT_FALSE(gs2.contains(gs5));
+  EXPECT_FALSE(gs5.contains(gs2));
 
-  EXPECT_TRUE(gs6.contains(gs2, server));
-  EXPECT_TRUE(gs6.contains(gs5, server));
+  EXPECT_TRUE(gs6.contains(gs2));
+  EXPECT_TRUE(gs6.contains(gs5));
 
   EXPECT_EQ(50, gs6.count());
 }
@@ -158,9 +158,9 @@ TEST_F(Gtid_utils, gtid_set_basics_tag_support) {
 
   EXPECT_THROW(gs2_s.count(), std::invalid_argument);
 
-  gs2_s.normalize(server);
-  gs6_taga.normalize(server);
-  gs6_tagb.normalize(server);
+  gs2_s.normalize();
+  gs6_taga.normalize();
+  gs6_tagb.normalize();
 
   EXPECT_EQ(gs2_r, gs2_s);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:taga:1-43", gs2_r.str());
@@ -179,34 +179,29 @@ TEST_F(Gtid_utils, gtid_set_basics_tag_support) {
   EXPECT_FALSE(gs2.empty());
   EXPECT_EQ(43, gs2.count());
 
-  EXPECT_TRUE(gs2_r.contains(gs2_s, server));
-  EXPECT_TRUE(gs2_r.contains(gs2_s, server));
-  EXPECT_TRUE(gs2.contains(gs3_taga, server));
-  EXPECT_FALSE(gs2.contains(gs3_tagb, server));
-  EXPECT_FALSE(gs3_taga.contains(gs2, server));
-  EXPECT_FALSE(gs3_tagb.contains(gs2, server));
+  EXPECT_TRUE(gs2_r.contains(gs2_s));
+  EXPECT_TRUE(gs2_r.contains(gs2_s));
+  EXPECT_TRUE(gs2.contains(gs3_taga));
+  EXPECT_FALSE(gs2.contains(gs3_tagb));
+  EXPECT_FALSE(gs3_taga.contains(gs2));
+  EXPECT_FALSE(gs3_tagb.contains(gs2));
 
-  EXPECT_FALSE(gs2.contains(gs4, server));
-  EXPECT_FALSE(gs4.contains(gs2, server));
+  EXPECT_FALSE(gs2.contains(gs4));
+  EXPECT_FALSE(gs4.contains(gs2));
 
-  EXPECT_FALSE(gs2.contains(gs5, server));
-  EXPECT_FALSE(gs5.contains(gs2, server));
+  EXPECT_FALSE(gs2.contains(gs5));
+  EXPECT_FALSE(gs5.contains(gs2));
 
-  EXPECT_TRUE(gs6_taga.contains(gs2, server));
-  EXPECT_TRUE(gs6_taga.contains(gs5, server));
-  EXPECT_FALSE(gs6_tagb.contains(gs2, server));
-  EXPECT_FALSE(gs6_tagb.contains(gs5, server));
+  EXPECT_TRUE(gs6_taga.contains(gs2));
+  EXPECT_TRUE(gs6_taga.contains(gs5));
+  EXPECT_FALSE(gs6_tagb.contains(gs2));
+  EXPECT_FALSE(gs6_tagb.contains(gs5));
 
   EXPECT_EQ(50, gs6_taga.count());
   EXPECT_EQ(50, gs6_tagb.count());
 }
 
 TEST_F(Gtid_utils, gtid_set_ops) {
-  auto session = db::mysql::Session::create();
-  session->connect(db::Connection_options(_mysql_uri));
-
-  mysqlshdk::mysql::Instance server(session);
-
   Gtid_set gs1;
   Gtid_set gs2_r(Gtid_range{"8b8dc2ba-8803-11eb-af3d-a1178d81dccc", {}, 1, 43});
   Gtid_set gs2_s(
@@ -225,9 +220,22 @@ TEST_F(Gtid_utils, gtid_set_ops) {
 
   gs2 = gs2_r;
   gs2.add(gs2_s);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43", gs2.str());
 
+  // invalid ranges are rejected, as they are by the server
+  EXPECT_THROW(
+      Gtid_set::from_string("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:5-3")
+          .normalize(),
+      std::invalid_argument);
+  EXPECT_THROW(
+      Gtid_set::from_string("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:0")
+          .normalize(),
+      std::invalid_argument);
+  EXPECT_THROW(gs2.subtract(Gtid_set::from_string(
+                   "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1:7-6")),
+               std::invalid_argument);
+
   gs2 = gs2_r;
   gs2.add(gs1);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43", gs2.str());
@@ -241,28 +249,28 @@ TEST_F(Gtid_utils, gtid_set_ops) {
       },
       std::invalid_argument);
   EXPECT_THROW(gs2.count(), std::invalid_argument);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43", gs2.str());
 
   gs2 = gs2_r;
   gs2.add(gs4);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-44", gs2.str());
 
   gs2 = gs2_r;
   gs2.add(gs5);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43:45-70", gs2.str());
 
   gs2 = gs2_r;
   gs2.add(gs4);
   gs2.add(gs5);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-70", gs2.str());
 
   gs2 = gs2_r;
   gs2.add(gs8);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ(
       "88888888-8803-11eb-af3d-a1178d81dccc:1-8,\n8b8dc2ba-8803-11eb-af3d-"
       "a1178d81dccc:1-43",
@@ -272,12 +280,12 @@ TEST_F(Gtid_utils, gtid_set_ops) {
   gs2.add(Gtid_range("8b8dc2ba-8803-11eb-af3d-a1178d81dccc", {}, 99, 99));
   EXPECT_THROW({ [[maybe_unused]] bool x = gs1 == gs2; },
                std::invalid_argument);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43:99", gs2.str());
 
   gs2 = gs2_r;
   gs2.add(Gtid_range("9b8dc2ba-0000-11eb-af3d-a1178d81dccc", {}, 99, 99));
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ(
       "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43,\n9b8dc2ba-0000-11eb-af3d-"
       "a1178d81dccc:99",
@@ -285,7 +293,7 @@ TEST_F(Gtid_utils, gtid_set_ops) {
 
   gs2 = gs2_r;
   gs2.add(Gtid_range("9b8dc2ba-0000-11eb-af3d-a1178d81dccc", {}, 10, 99));
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ(
       "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43,\n9b8dc2ba-0000-11eb-af3d-"
       "a1178d81dccc:10-99",
@@ -293,27 +301,27 @@ TEST_F(Gtid_utils, gtid_set_ops) {
 
   gs2 = gs2_r;
   gs2.add(Gtid_range("8b8dc2ba-8803-11eb-af3d-a1178d81dccc", {}, 10, 99));
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-99", gs2.str());
 
   gs2 = gs2_r;
-  gs2.subtract(gs1, server);
+  gs2.subtract(gs1);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43", gs2.str());
 
   gs2 = gs2_r;
-  gs2.subtract(gs2, server);
+  gs2.subtract(gs2);
   EXPECT_EQ("", gs2.str());
 
   gs2 = gs2_r;
-  gs2.subtract(gs5, server);
+  gs2.subtract(gs5);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-43", gs2.str());
 
   gs2 = gs2_r;
-  gs2.subtract(gs3, server);
+  gs2.subtract(gs3);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:6-43", gs2.str());
 
   gs2 = gs2_r;
-  gs2.subtract(gs7, server);
+  gs2.subtract(gs7);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-9:21-43", gs2.str());
 }
 
@@ -352,7 +360,7 @@ TEST_F(Gtid_utils, gtid_set_ops_tag_support) {
 
   gs2 = gs2_r;
   gs2.add(gs2_s);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:foo:1-43", gs2.str());
 
   gs2 = gs2_r;
@@ -364,33 +372,33 @@ TEST_F(Gtid_utils, gtid_set_ops_tag_support) {
   EXPECT_THROW({ [[maybe_unused]] bool res = gs3_no_tag == gs2; },
                std::invalid_argument);
   EXPECT_THROW(gs2.count(), std::invalid_argument);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:1-5:foo:1-43", gs2.str());
 
   gs2 = gs2_r;
   gs2.add(gs4);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:foo:1-44", gs2.str());
 
   gs2 = gs2_r;
   gs2.add(gs5);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:foo:1-43:45-70", gs2.str());
 
   gs2 = gs2_r;
   gs2.add(gs5_no_tag);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:45-70:foo:1-43", gs2.str());
 
   gs2 = gs2_r;
   gs2.add(gs4);
   gs2.add(gs5);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:foo:1-70", gs2.str());
 
   gs2 = gs2_r;
   gs2.add(gs8_no_tag);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ(
       "88888888-8803-11eb-af3d-a1178d81dccc:1-8,\n8b8dc2ba-8803-11eb-af3d-"
       "a1178d81dccc:foo:1-43",
@@ -398,7 +406,7 @@ TEST_F(Gtid_utils, gtid_set_ops_tag_support) {
 
   gs2 = gs2_r;
   gs2.add(gs8);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ(
       "88888888-8803-11eb-af3d-a1178d81dccc:bar:1-8,\n8b8dc2ba-8803-11eb-af3d-"
       "a1178d81dccc:foo:1-43",
@@ -408,12 +416,12 @@ TEST_F(Gtid_utils, gtid_set_ops_tag_support) {
   gs2.add(Gtid_range("8b8dc2ba-8803-11eb-af3d-a1178d81dccc", "foo", 99, 99));
   EXPECT_THROW({ [[maybe_unused]] bool x = gs1 == gs2; },
                std::invalid_argument);
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:foo:1-43:99", gs2.str());
 
   gs2 = gs2_r;
   gs2.add(Gtid_range("9b8dc2ba-0000-11eb-af3d-a1178d81dccc", "bar", 99, 99));
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ(
       "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:foo:1-43,\n9b8dc2ba-0000-11eb-af3d-"
       "a1178d81dccc:bar:99",
@@ -421,7 +429,7 @@ TEST_F(Gtid_utils, gtid_set_ops_tag_support) {
 
   gs2 = gs2_r;
   gs2.add(Gtid_range("9b8dc2ba-0000-11eb-af3d-a1178d81dccc", {}, 10, 99));
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ(
       "8b8dc2ba-8803-11eb-af3d-a1178d81dccc:foo:1-43,\n9b8dc2ba-0000-11eb-af3d-"
       "a1178d81dccc:10-99",
@@ -429,36 +437,31 @@ TEST_F(Gtid_utils, gtid_set_ops_tag_support) {
 
   gs2 = gs2_r;
   gs2.add(Gtid_range("8b8dc2ba-8803-11eb-af3d-a1178d81dccc", "foo", 10, 99));
-  gs2.normalize(server);
+  gs2.normalize();
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:foo:1-99", gs2.str());
 
   gs2 = gs2_r;
-  gs2.subtract(gs1, server);
+  gs2.subtract(gs1);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:foo:1-43", gs2.str());
 
   gs2 = gs2_r;
-  gs2.subtract(gs2, server);
+  gs2.subtract(gs2);
   EXPECT_EQ("", gs2.str());
 
   gs2 = gs2_r;
-  gs2.subtract(gs5, server);
+  gs2.subtract(gs5);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:foo:1-43", gs2.str());
 
   gs2 = gs2_r;
-  gs2.subtract(gs3_no_tag, server);
+  gs2.subtract(gs3_no_tag);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:foo:1-43", gs2.str());
 
   gs2 = gs2_r;
-  gs2.subtract(gs7, server);
+  gs2.subtract(gs7);
   EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:foo:1-9:21-43", gs2.str());
 }
 
 TEST_F(Gtid_utils, gtid_set_enumerate) {
-  auto session = db::mysql::Session::create();
-  session->connect(db::Connection_options(_mysql_uri));
-
-  mysqlshdk::mysql::Instance server(session);
-
   Gtid_set gs1(Gtid_range{"8b8dc2ba-8803-11eb-af3d-a1178d81dccc", {}, 1, 9});
   Gtid_set gs2(Gtid_range{"8b8dc2ba-8803-11eb-af3d-a1178d81dccc", {}, 1, 1});
   Gtid_set gs3(
@@ -472,7 +475,7 @@ TEST_F(Gtid_utils, gtid_set_enumerate) {
       result.add(gtid);
       ++calls;
     });
-    result.normalize(server);
+    result.normalize();
     EXPECT_EQ(gs1, result);
     EXPECT_EQ(gs1.count(), calls);
   }
@@ -483,13 +486,13 @@ TEST_F(Gtid_utils, gtid_set_enumerate) {
       result.add(gtid);
       ++calls;
     });
-    result.normalize(server);
+    result.normalize();
     EXPECT_EQ(gs2.str(), result.str());
     EXPECT_EQ(gs2.count(), calls);
   }
 
   EXPECT_THROW(gs3.enumerate([&](const auto &) {}), std::invalid_argument);
-  gs3.normalize(server);
+  gs3.normalize();
 
   {
     int calls = 0;
@@ -498,7 +501,7 @@ TEST_F(Gtid_utils, gtid_set_enumerate) {
       result.add(gtid);
       ++calls;
     });
-    result.normalize(server);
+    result.normalize();
     EXPECT_EQ(gs3.str(), result.str());
     EXPECT_EQ(gs3.count(), calls);
   }
@@ -529,7 +532,7 @@ TEST_F(Gtid_utils, gtid_set_enumerate_tag_support) {
       result.add(gtid);
       ++calls;
     });
-    result.normalize(server);
+    result.normalize();
     EXPECT_EQ(gs1, result);
     EXPECT_EQ(gs1.count(), calls);
   }
@@ -540,13 +543,13 @@ TEST_F(Gtid_utils, gtid_set_enumerate_tag_support) {
       result.add(gtid);
       ++calls;
     });
-    result.normalize(server);
+    result.normalize();
     EXPECT_EQ(gs2.str(), result.str());
     EXPECT_EQ(gs2.count(), calls);
   }
 
   EXPECT_THROW(gs3.enumerate([&](const auto &) {}), std::invalid_argument);
-  gs3.normalize(server);
+  gs3.normalize();
 
   {
     int calls = 0;
@@ -555,13 +558,13 @@ TEST_F(Gtid_utils, gtid_set_enumerate_tag_support) {
       result.add(gtid);
       ++calls;
     });
-    result.normalize(server);
+    result.normalize();
     EXPECT_EQ(gs3.str(), result.str());
     EXPECT_EQ(gs3.count(), calls);
   }
 
   EXPECT_THROW(gs4.enumerate([&](const auto &) {}), std::invalid_argument);
-  gs4.normalize(server);
+  gs4.normalize();
 
   {
     int calls = 0;
@@ -570,7 +573,7 @@ TEST_F(Gtid_utils, gtid_set_enumerate_tag_support) {
       result.add(gtid);
       ++calls;
     });
-    result.normalize(server);
+    result.normalize();
     EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc:taga:30-40:tagb:1-20",
               result.str());
     EXPECT_EQ(gs4.count(), calls);
@@ -578,11 +581,6 @@ TEST_F(Gtid_utils, gtid_set_enumerate_tag_support) {
 }
 
 TEST_F(Gtid_utils, gtid_set_enumerate_ranges) {
-  auto session = db::mysql::Session::create();
-  session->connect(db::Connection_options(_mysql_uri));
-
-  mysqlshdk::mysql::Instance server(session);
-
   Gtid_set gs1(Gtid_range{"8b8dc2ba-8803-11eb-af3d-a1178d81dccc", {}, 1, 9});
   Gtid_set gs2(Gtid_range{"8b8dc2ba-8803-11eb-af3d-a1178d81dccc", {}, 1, 1});
   Gtid_set gs3(
@@ -596,7 +594,7 @@ TEST_F(Gtid_utils, gtid_set_enumerate_ranges) {
       result.add(gtids);
       ++calls;
     });
-    result.normalize(server);
+    result.normalize();
     EXPECT_EQ(gs1, result);
     EXPECT_EQ(1, calls);
   }
@@ -607,14 +605,14 @@ TEST_F(Gtid_utils, gtid_set_enumerate_ranges) {
       result.add(gtids);
       ++calls;
     });
-    result.normalize(server);
+    result.normalize();
     EXPECT_EQ(gs2.str(), result.str());
     EXPECT_EQ(1, calls);
   }
 
   EXPECT_THROW(gs3.enumerate_ranges([&](const auto &) {}),
                std::invalid_argument);
-  gs3.normalize(server);
+  gs3.normalize();
 
   {
     int calls = 0;
@@ -625,7 +623,7 @@ TEST_F(Gtid_utils, gtid_set_enumerate_ranges) {
       ranges.push_back(gtids);
       ++calls;
     });
-    result.normalize(server);
+    result.normalize();
     EXPECT_EQ(gs3.str(), result.str());
     EXPECT_EQ(3, calls);
     EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc", ranges[0].uuid_tag);
@@ -656,7 +654,7 @@ TEST_F(Gtid_utils, gtid_set_enumerate_ranges_tag_support) {
 
   EXPECT_THROW(gs1.enumerate_ranges([&](const auto &) {}),
                std::invalid_argument);
-  gs1.normalize(server);
+  gs1.normalize();
 
   {
     int calls = 0;
@@ -667,7 +665,7 @@ TEST_F(Gtid_utils, gtid_set_enumerate_ranges_tag_support) {
       ranges.push_back(gtids);
       ++calls;
     });
-    result.normalize(server);
+    result.normalize();
     EXPECT_EQ(gs1.str(), result.str());
     EXPECT_EQ(4, calls);
     EXPECT_EQ("8b8dc2ba-8803-11eb-af3d-a1178d81dccc", ranges[0].uuid_tag);
@@ -686,21 +684,16 @@ TEST_F(Gtid_utils, gtid_set_enumerate_ranges_tag_support) {
 }
 
 TEST_F(Gtid_utils, subtract_view_changes) {
-  auto session = db::mysql::Session::create();
-  session->connect(db::Connection_options(_mysql_uri));
-
-  mysqlshdk::mysql::Instance server(session);
-
   auto gtid_set = Gtid_set::from_string(
       "ec32d2c0-d3f0-11eb-abf3-eb7171e21adc:1-79,\nec32e076-d3f0-11eb-abf3-"
       "eb7171e21adc:1-3,\nf37283fa-d3f0-11eb-84e6-06d82947e5a7:1-2");
 
-  gtid_set.normalize(server);
+  gtid_set.normalize();
 
   auto view_changes =
       gtid_set.get_gtids_from("f37283fa-d3f0-11eb-84e6-06d82947e5a7");
 
-  gtid_set.subtract(view_changes, server);
+  gtid_set.subtract(view_changes);
 
   EXPECT_EQ(
       "ec32d2c0-d3f0-11eb-abf3-eb7171e21adc:1-79,\nec32e076-d3f0-11eb-abf3-"
@@ -721,7 +714,7 @@ TEST_F(Gtid_utils, subtract_view_changes_tag_support) {
       "ec32e076-d3f0-11eb-abf3-eb7171e21adc:1-79,\nec32e076-d3f0-11eb-abf3-"
       "eb7171e21adc:foo:1-3,\nf37283fa-d3f0-11eb-84e6-06d82947e5a7:bar:1-2");
 
-  gtid_set.normalize(server);
+  gtid_set.normalize();
 
   EXPECT_EQ(
       "ec32e076-d3f0-11eb-abf3-eb7171e21adc:1-79,ec32e076-d3f0-11eb-abf3-"
@@ -748,5 +741,65 @@ TEST_F(Gtid_utils, subtract_view_changes_tag_support) {
               .str());
 }
 
+TEST_F(Gtid_utils, gtid_set_ops_match_server) {
+  auto session = db::mysql::Session::create();
+  session->connect(db::Connection_options(_mysql_uri));
+  mysqlshdk::mysql::Instance server(session);
+
+  const bool tags_supported =
+      server.get_version() >= mysqlshdk::utils::Version(8, 3, 0);
+
+  const std::vector<std::string> uuids = {
+      "11111111-8803-11eb-af3d-a1178d81dccc",
+      "8b8dc2ba-8803-11eb-af3d-a1178d81dccc",
+      "9B8DC2BA-0000-11EB-AF3D-A1178D81DCCC",
+  };
+  const std::vector<std::string> tags = {"", "foo", "BAR"};
+
+  std::mt19937 rng(1234);
+
+  const auto random_set = [&]() {
+    Gtid_set gtids;
+    const auto ranges = rng() % 8;
+
+    for (std::size_t i = 0; i < ranges; ++i) {
+      const uint64_t begin = 1 + rng() % 50;
+      const uint64_t end = begin + rng() % 10;
+
+      gtids.add(Gtid_range{uuids[rng() % uuids.size()],
+                           tags_supported ? tags[rng() % tags.size()] : "",
+                           begin, end});
+    }
+
+    return gtids;
+  };
+
+  for (int i = 0; i < 200; ++i) {
+    const auto a = random_set();
+    const auto b = random_set();
+
+    SCOPED_TRACE("a = " + a.str() + ", b = " + b.str());
+
+    EXPECT_EQ(server.queryf_one_string(0, "", "SELECT gtid_subtract(?, '')",
+                                       a.str()),
+              Gtid_set{a}.normalize().str());
+
+    EXPECT_EQ(server.queryf_one_string(0, "", "SELECT gtid_subtract(?, ?)",
+                                       a.str(), b.str()),
+              Gtid_set{a}.subtract(b).str());
+
+    // a /\ b = a - (a - b)
+    EXPECT_EQ(server.queryf_one_string(
+                  0, "", "SELECT gtid_subtract(?, gtid_subtract(?, ?))",
+                  a.str(), a.str(), b.str()),
+              Gtid_set{a}.intersect(b).str());
+
+    EXPECT_EQ(
+        server.queryf_one_int(0, 0, "SELECT gtid_subset(?, ?)", b.str(),
+                              a.str()) != 0,
+        a.contains(b));
+  }
+}
+
 }  // namespace mysql
 }  // namespace mysqlshdk
@@ -23,6 +23,7 @@
  * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
  */
 
+#include <future>
 #include <iterator>
 #include <memory>
 #include <string>
@@ -858,6 +859,104 @@ TEST_F(Rest_service_test, bug34765385) {
   EXPECT_GE(d.seconds_elapsed(), 2.0);  // two retries, one second each
 }
 
+TEST_F(Rest_service_test, async_requests) {
+  FAIL_IF_NO_SERVER
+
+  constexpr int k_requests = 8;
+
+  std::vector<Request> requests;
+  std::vector<String_response> responses(k_requests);
+  std::vector<std::future<Response::Status_code>> results;
+
+  requests.reserve(k_requests);
+  results.reserve(k_requests);
+
+  for (int i = 0; i < k_requests; ++i) {
+    requests.emplace_back("/get", Headers{{"id", std::to_string(i)}});
+    requests.back().type = Type::GET;
+  }
+
+  for (int i = 0; i < k_requests; ++i) {
+    results.emplace_back(m_service.execute_async(&requests[i], &responses[i]));
+  }
+
+  for (int i = 0; i < k_requests; ++i) {
+    SCOPED_TRACE("request: " + std::to_string(i));
+
+    EXPECT_EQ(Response::Status_code::OK, results[i].get());
+    EXPECT_EQ(Response::Status_code::OK, responses[i].status);
+    EXPECT_EQ("GET", responses[i].json().as_map()->get_string("method"));
+    EXPECT_EQ(std::to_string(i),
+              responses[i].json().as_map()->get_map("headers")->get_string(
+                  "id"));
+  }
+
+  {
+    // requests with body
+    auto request = Json_request("/put", shcore::Value::parse("{'id' : 20}"));
+    request.type = Type::PUT;
+    String_response response;
+
+    EXPECT_EQ(Response::Status_code::OK,
+              m_service.execute_async(&request, &response).get());
+    EXPECT_EQ("PUT", response.json().as_map()->get_string("method"));
+    EXPECT_EQ(20, response.json().as_map()->get_map("json")->get_int("id"));
+  }
+
+  {
+    // callback
+    auto request = Request("/server_error/503");
+    request.type = Type::GET;
+
+    std::promise<Response::Status_code> promise;
+
+    m_service.execute_async(
+        &request, nullptr,
+        [&promise](Response::Status_code code, std::exception_ptr e) {
+          EXPECT_EQ(nullptr, e);
+          promise.set_value(code);
+        });
+
+    EXPECT_EQ(Response::Status_code::SERVICE_UNAVAILABLE,
+              promise.get_future().get());
+  }
+
+  {
+    // retries are delayed, but do not block the caller
+    const auto retry_strategy =
+        Retry_strategy_builder{1}.set_max_attempts(2).build();
+    retry_strategy->retry_on_server_errors();
+
+    auto request = Request("/server_error/503");
+    request.type = Type::GET;
+    request.retry_strategy = retry_strategy.get();
+
+    mysqlshdk::utils::Duration d;
+    d.start();
+    auto result = m_service.execute_async(&request);
+    EXPECT_LT(d.seconds_elapsed(), 1.0);
+
+    EXPECT_EQ(Response::Status_code::SERVICE_UNAVAILABLE, result.get());
+    d.finish();
+
+    EXPECT_GE(d.seconds_elapsed(), 2.0);  // two retries, one second each
+  }
+
+  {
+    // connection errors are reported through the future
+    const auto retry_strategy =
+        Retry_strategy_builder{1}.set_max_attempts(1).build();
+    retry_strategy->retry_on(Error_code::PARTIAL_FILE);
+    retry_strategy->retry_on(Error_code::RECV_ERROR);
+
+    auto request = Request("/partial_file/1000");
+    request.type = Type::GET;
+    request.retry_strategy = retry_strategy.get();
+
+    EXPECT_THROW(m_service.execute_async(&request).get(), Connection_error);
+  }
+}
+
 }  // namespace test
 }  // namespace rest
 }  // namespace mysqlshdk
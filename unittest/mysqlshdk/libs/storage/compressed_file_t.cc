@@ -156,11 +156,8 @@ class Compression
     if (mmap_mode.empty()) {
       return std::make_unique<backend::Memory_file>("");
     } else {
-      std::string fn;
-      if (std::get<0>(GetParam()) == storage::Compression::GZIP)
-        fn = "compressed.gz";
-      else
-        fn = "compressed.zst";
+      const auto fn =
+          "compressed" + storage::get_extension(std::get<0>(GetParam()));
       auto f = make_file(shcore::path::join_path(getenv("TMPDIR"), fn),
                          {{"file.mmap", mmap_mode}});
       f->remove();  // make sure file doesn't already exist
@@ -251,6 +248,14 @@ class Compression
         EXPECT_EQ(static_cast<std::string::value_type>(0xfd), header[3]);
         break;
 
+      case mysqlshdk::storage::Compression::LZ4:
+        // is lz4? (lz4 frame header startswith "\x04\x22\x4d\x18")
+        EXPECT_EQ(static_cast<std::string::value_type>(0x04), header[0]);
+        EXPECT_EQ(static_cast<std::string::value_type>(0x22), header[1]);
+        EXPECT_EQ(static_cast<std::string::value_type>(0x4d), header[2]);
+        EXPECT_EQ(static_cast<std::string::value_type>(0x18), header[3]);
+        break;
+
       case mysqlshdk::storage::Compression::NONE:
         break;
     }
@@ -326,6 +331,117 @@ TEST_P(Compression, options_level) {
   }
 }
 
+TEST_P(Compression, options_frame_size) {
+  if (storage::Compression::ZSTD != std::get<0>(GetParam())) {
+    SKIP_TEST("Seekable format is only supported by zstd");
+  }
+
+  for (const ssize_t length : {0, 1, 8313, 65536, 1024 * 1024 + 123}) {
+    SCOPED_TRACE(length);
+    Generate_text g;
+    auto input_data = g.bytes(length).substr(0, length);
+    compress_decompress(input_data, std::get<0>(GetParam()),
+                        {{"frameSize", "64k"}});
+  }
+}
+
+TEST_P(Compression, options_threads) {
+  const auto compression = std::get<0>(GetParam());
+
+  if (storage::Compression::ZSTD != compression &&
+      storage::Compression::GZIP != compression) {
+    SKIP_TEST("Multithreaded compression is only supported by zstd and gzip");
+  }
+
+  for (const ssize_t length :
+       {0, 1, 8313, 128 * 1024, 128 * 1024 + 1, 4 * 1024 * 1024 + 123}) {
+    SCOPED_TRACE(length);
+    Generate_text g;
+    auto input_data = g.bytes(length).substr(0, length);
+    compress_decompress(input_data, compression, {{"threads", "2"}});
+
+    if (storage::Compression::ZSTD == compression) {
+      compress_decompress(input_data, compression,
+                          {{"threads", "2"}, {"frameSize", "1M"}});
+    }
+  }
+}
+
+TEST_P(Compression, seekable_zstd) {
+  if (storage::Compression::ZSTD != std::get<0>(GetParam())) {
+    SKIP_TEST("Seekable format is only supported by zstd");
+  }
+
+  constexpr std::size_t k_size = 1024 * 1024 + 123;
+  Generate_text g;
+  const auto input_data = g.bytes(k_size).substr(0, k_size);
+  const auto size = static_cast<off64_t>(k_size);
+
+  const auto read_at = [&input_data](IFile *file, off64_t offset,
+                                     size_t length) {
+    SCOPED_TRACE(offset);
+    std::string buffer;
+    buffer.resize(length);
+    EXPECT_EQ(offset, file->seek(offset));
+    const auto bytes = file->read(buffer.data(), length);
+    ASSERT_LE(0, bytes);
+    buffer.resize(bytes);
+    EXPECT_EQ(input_data.substr(offset, length), buffer);
+  };
+
+  {
+    // not seekable
+    auto file = make_file(make_output_file(), std::get<0>(GetParam()));
+    file->open(Mode::WRITE);
+    file->write(input_data.data(), input_data.size());
+    file->close();
+
+    file->open(Mode::READ);
+
+    std::string buffer;
+    buffer.resize(1000);
+    EXPECT_EQ(1000, file->read(buffer.data(), buffer.size()));
+    EXPECT_THROW(file->seek(5000), std::logic_error);
+
+    // read position is not affected
+    EXPECT_EQ(1000, file->read(buffer.data(), buffer.size()));
+    EXPECT_EQ(input_data.substr(1000, 1000), buffer);
+
+    file->close();
+  }
+
+  {
+    // seekable
+    auto file = make_file(make_output_file(), std::get<0>(GetParam()),
+                          {{"frameSize", "10000"}});
+    file->open(Mode::WRITE);
+    EXPECT_THROW(file->seek(0), std::logic_error);
+    file->write(input_data.data(), input_data.size());
+    file->close();
+
+    file->open(Mode::READ);
+
+    // frame boundaries
+    read_at(file.get(), 0, 100);
+    read_at(file.get(), 9999, 100);
+    read_at(file.get(), 10000, 100);
+    read_at(file.get(), 10001, 20000);
+    // backwards
+    read_at(file.get(), 5, 100);
+    read_at(file.get(), 500000, 1000);
+    read_at(file.get(), size - 100, 1000);
+    read_at(file.get(), size - 1, 1000);
+
+    // past the end
+    EXPECT_EQ(size, file->seek(size + 10));
+    std::string buffer;
+    buffer.resize(100);
+    EXPECT_EQ(0, file->read(buffer.data(), buffer.size()));
+
+    file->close();
+  }
+}
+
 extern "C" const char *g_test_home;
 TEST_P(Compression, compress_decompress_bigdata) {
   SKIP_TEST("Slow test");
@@ -388,6 +504,35 @@ TEST_P(Compression, compress_decompress_bigdata) {
   }
 }
 
+TEST(Compression_lz4, truncated_input) {
+  auto memfile = std::make_unique<backend::Memory_file>("");
+  const auto memfile_ptr = memfile.get();
+  const auto compressed = make_file(std::move(memfile), Compression::LZ4);
+
+  Generate_text g;
+  const auto input_text = g.bytes(1024 * 1024);
+
+  compressed->open(Mode::WRITE);
+  compressed->write(input_text.data(), input_text.size());
+  compressed->close();
+
+  std::string content = memfile_ptr->content();
+  content.resize(content.size() / 2);
+  memfile_ptr->set_content(content);
+
+  std::string buffer;
+  buffer.resize(BUFSIZE);
+
+  compressed->open(Mode::READ);
+  EXPECT_THROW(
+      {
+        while (compressed->read(&buffer[0], buffer.size()) > 0) {
+        }
+      },
+      std::runtime_error);
+  compressed->close();
+}
+
 inline std::string fmt_compr(
     const testing::TestParamInfo<
         std::tuple<mysqlshdk::storage::Compression, std::string>> &info) {
@@ -405,7 +550,9 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_tuple(mysqlshdk::storage::Compression::ZSTD, ""),
         std::make_tuple(mysqlshdk::storage::Compression::ZSTD, "off"),
         std::make_tuple(mysqlshdk::storage::Compression::ZSTD, "on"),
-        std::make_tuple(mysqlshdk::storage::Compression::ZSTD, "required")),
+        std::make_tuple(mysqlshdk::storage::Compression::ZSTD, "required"),
+        std::make_tuple(mysqlshdk::storage::Compression::LZ4, ""),
+        std::make_tuple(mysqlshdk::storage::Compression::LZ4, "off")),
     fmt_compr);
 
 }  // namespace tests
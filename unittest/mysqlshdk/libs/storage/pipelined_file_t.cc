@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "unittest/gprod_clean.h"
+#include "unittest/gtest_clean.h"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "mysqlshdk/libs/storage/backend/memory_file.h"
+#include "mysqlshdk/libs/storage/compressed_file.h"
+#include "mysqlshdk/libs/storage/pipelined_file.h"
+
+namespace mysqlshdk {
+namespace storage {
+namespace tests {
+
+namespace {
+
+using backend::Memory_file;
+
+class Failing_file : public Memory_file {
+ public:
+  explicit Failing_file(std::size_t fail_after)
+      : Memory_file(""), m_fail_after(fail_after) {}
+
+  ssize_t write(const void *buffer, size_t length) override {
+    if (content().size() + length > m_fail_after) {
+      return -1;
+    }
+
+    return Memory_file::write(buffer, length);
+  }
+
+ private:
+  std::size_t m_fail_after;
+};
+
+std::string data(std::size_t length) {
+  std::string s;
+  s.reserve(length);
+
+  for (std::size_t i = 0; i < length; ++i) {
+    s += static_cast<char>('a' + i % 26);
+  }
+
+  return s;
+}
+
+}  // namespace
+
+TEST(Pipelined_file, write) {
+  auto memfile = std::make_unique<Memory_file>("");
+  const auto mf = memfile.get();
+  Pipelined_file file{std::move(memfile), 100, 2};
+  const auto expected = data(12345);
+
+  file.open(Mode::WRITE);
+
+  // write using various sizes: smaller than, equal to and bigger than a block
+  std::size_t offset = 0;
+  std::size_t length = 1;
+
+  while (offset < expected.size()) {
+    const auto bytes = std::min(length, expected.size() - offset);
+    EXPECT_EQ(static_cast<ssize_t>(bytes),
+              file.write(expected.data() + offset, bytes));
+    offset += bytes;
+    length = length * 3 % 317;
+  }
+
+  file.close();
+
+  EXPECT_FALSE(file.is_open());
+  EXPECT_EQ(expected, mf->content());
+  EXPECT_EQ(expected.size(), file.bytes_written());
+  EXPECT_EQ(expected.size(), file.file_size());
+}
+
+TEST(Pipelined_file, flush) {
+  auto memfile = std::make_unique<Memory_file>("");
+  const auto mf = memfile.get();
+  Pipelined_file file{std::move(memfile), 100, 2};
+  const auto expected = data(150);
+
+  file.open(Mode::WRITE);
+  file.write(expected.data(), expected.size());
+
+  EXPECT_TRUE(file.flush());
+  EXPECT_EQ(expected, mf->content());
+  EXPECT_EQ(expected.size(), file.file_size());
+
+  file.close();
+
+  EXPECT_EQ(expected, mf->content());
+}
+
+TEST(Pipelined_file, compressed) {
+  auto memfile = std::make_unique<Memory_file>("");
+  const auto mf = memfile.get();
+  const auto expected = data(1000000);
+  std::string compressed;
+
+  {
+    Pipelined_file file{make_file(std::make_unique<Pipelined_file>(
+                                      std::move(memfile), 1000, 3),
+                                  Compression::ZSTD)};
+
+    file.open(Mode::WRITE);
+    file.write(expected.data(), expected.size());
+    file.close();
+
+    compressed = mf->content();
+
+    EXPECT_TRUE(file.is_compressed());
+    EXPECT_LT(compressed.size(), expected.size());
+    // data flushed when file is closed is not reported
+    EXPECT_GE(compressed.size(), file.bytes_written());
+    EXPECT_EQ(compressed.size(), file.file_size());
+  }
+
+  auto input = std::make_unique<Memory_file>("");
+  input->set_content(compressed);
+  const auto decompress = make_file(std::move(input), Compression::ZSTD);
+  std::string actual(expected.size() + 1, '\0');
+
+  decompress->open(Mode::READ);
+  EXPECT_EQ(static_cast<ssize_t>(expected.size()),
+            decompress->read(actual.data(), actual.size()));
+  decompress->close();
+
+  actual.resize(expected.size());
+  EXPECT_EQ(expected, actual);
+}
+
+TEST(Pipelined_file, write_error) {
+  Pipelined_file file{std::make_unique<Failing_file>(250), 100, 2};
+  const auto block = data(100);
+
+  file.open(Mode::WRITE);
+
+  // error is reported by a subsequent call
+  EXPECT_THROW(
+      {
+        for (int i = 0; i < 100; ++i) {
+          file.write(block.data(), block.size());
+        }
+
+        file.close();
+      },
+      std::runtime_error);
+
+  // file is safely destroyed after an error
+}
+
+TEST(Pipelined_file, close_error) {
+  Pipelined_file file{std::make_unique<Failing_file>(250), 100, 2};
+  const auto block = data(300);
+
+  file.open(Mode::WRITE);
+  file.write(block.data(), 50);
+  EXPECT_NO_THROW(file.flush());
+
+  file.write(block.data(), block.size());
+  EXPECT_THROW(file.close(), std::runtime_error);
+}
+
+TEST(Pipelined_file, unsupported) {
+  EXPECT_THROW(Pipelined_file(nullptr), std::invalid_argument);
+  EXPECT_THROW(Pipelined_file(std::make_unique<Memory_file>(""), 0),
+               std::invalid_argument);
+  EXPECT_THROW(Pipelined_file(std::make_unique<Memory_file>(""), 1, 0),
+               std::invalid_argument);
+
+  Pipelined_file file{std::make_unique<Memory_file>("")};
+  char buffer[16];
+
+  EXPECT_THROW(file.open(Mode::READ), std::invalid_argument);
+
+  file.open(Mode::WRITE);
+
+  EXPECT_THROW(file.read(buffer, sizeof(buffer)), std::logic_error);
+  EXPECT_THROW(file.seek(0), std::logic_error);
+  EXPECT_THROW(file.tell(), std::logic_error);
+
+  file.close();
+}
+
+TEST(Pipelined_file, destroy_without_close) {
+  auto memfile = std::make_unique<Memory_file>("");
+  const auto block = data(1000);
+
+  Pipelined_file file{std::move(memfile), 100, 2};
+  file.open(Mode::WRITE);
+  file.write(block.data(), block.size());
+}
+
+}  // namespace tests
+}  // namespace storage
+}  // namespace mysqlshdk
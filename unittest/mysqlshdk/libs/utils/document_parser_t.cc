@@ -23,10 +23,14 @@
  * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
  */
 
+#include <algorithm>
 #include <stdexcept>
+#include <string>
+#include <vector>
 #include "mysqlshdk/libs/utils/document_parser.h"
 #include "mysqlshdk/libs/utils/utils_file.h"
 #include "mysqlshdk/libs/utils/utils_general.h"
+#include "mysqlshdk/libs/utils/utils_string.h"
 #include "unittest/gtest_clean.h"
 #include "unittest/test_utils/shell_test_env.h"
 
@@ -169,4 +173,127 @@ TEST(Document_parser, bom_utf32be) {
                       "UTF-32BE encoded document is not supported.");
   }
 }
+
+TEST(Document_parser, split) {
+  const std::string content{
+      "\xef\xbb\xbf{\"a\": \"}\"}\n"
+      "{\"b\": [1, {\"c\": \"\\\"{\"}]}  {\"d\": \"\\\\\"}\n"
+      "{}{\"e\": {\"f\": {\"g\": \"]]\"}}}\n"};
+
+  const std::string filename{"test.json"};
+  shcore::create_file(filename, content, true);
+  auto exit_scope =
+      shcore::on_leave_scope([&]() { shcore::delete_file(filename); });
+
+  shcore::Document_reader_options options{};
+  const auto read = [&](shcore::Buffered_input *input, bool parse_bom,
+                        std::vector<std::string> *documents) {
+    shcore::Json_reader reader(input, options);
+
+    if (parse_bom) {
+      reader.parse_bom();
+    }
+
+    while (!reader.eof()) {
+      auto jd = reader.next();
+
+      if (!jd.empty()) {
+        // whitespace which follows a document is not significant, and it's
+        // reported at the beginning of the next chunk when reading in ranges
+        documents->emplace_back(shcore::str_rstrip(jd));
+      }
+    }
+  };
+
+  std::vector<std::string> expected;
+
+  {
+    shcore::Buffered_input input{filename};
+    read(&input, true, &expected);
+  }
+
+  ASSERT_EQ(5, expected.size());
+
+  for (std::size_t block = 1; block <= content.size(); ++block) {
+    SCOPED_TRACE("block size: " + std::to_string(block));
+
+    // split after each block which contains an end of a document
+    shcore::Json_document_splitter splitter;
+    std::vector<std::size_t> boundaries{0};
+
+    for (std::size_t offset = 0; offset < content.size(); offset += block) {
+      const auto length = std::min(block, content.size() - offset);
+      const auto end = splitter.scan(content.data() + offset, length);
+
+      if (std::string::npos != end) {
+        boundaries.emplace_back(offset + end);
+      }
+    }
+
+    if (boundaries.back() != content.size()) {
+      boundaries.emplace_back(content.size());
+    }
+
+    std::vector<std::string> documents;
+
+    for (std::size_t i = 1; i < boundaries.size(); ++i) {
+      shcore::Buffered_input input;
+      input.open(filename, boundaries[i - 1], boundaries[i] - boundaries[i - 1]);
+      read(&input, 0 == boundaries[i - 1], &documents);
+    }
+
+    EXPECT_EQ(expected, documents);
+  }
+}
+
+TEST(Document_parser, split_error_offset) {
+  const std::string content{"{}\n{\"a\": 1}\n{\"b\" 2}"};
+
+  const std::string filename{"test.json"};
+  shcore::create_file(filename, content, true);
+  auto exit_scope =
+      shcore::on_leave_scope([&]() { shcore::delete_file(filename); });
+
+  shcore::Buffered_input input;
+  input.open(filename, 12, content.size() - 12);
+  shcore::Document_reader_options options{};
+  shcore::Json_reader reader(&input, options);
+
+  // offset is relative to the beginning of the file
+  EXPECT_THROW_LIKE(reader.next(), shcore::invalid_json, "at offset 17");
+}
+
+TEST(Document_parser, split_long_documents) {
+  std::string content;
+  std::vector<std::size_t> boundaries;
+
+  for (int i = 0; i < 100; ++i) {
+    content += "{\"id\": " + std::to_string(i) + ", \"s\": \"" +
+               std::string(i, '}') + "\\\\\", \"a\": [" +
+               std::string(i % 7, '[') + std::string(i % 7, ']') +
+               "], \"e\": \"\\\"{\\\\\"}";
+    boundaries.emplace_back(content.size());
+    content += std::string(i % 3, '\n');
+  }
+
+  for (const std::size_t block : {1, 63, 64, 65, 128, 1000, 100000}) {
+    SCOPED_TRACE("block size: " + std::to_string(block));
+
+    shcore::Json_document_splitter splitter;
+
+    for (std::size_t offset = 0; offset < content.size(); offset += block) {
+      const auto length = std::min(block, content.size() - offset);
+      const auto end = splitter.scan(content.data() + offset, length);
+
+      // the last document which ends in this block
+      const auto it = std::upper_bound(boundaries.begin(), boundaries.end(),
+                                       offset + length);
+      const auto expected = boundaries.begin() == it || *(it - 1) <= offset
+                                ? std::string::npos
+                                : *(it - 1) - offset;
+
+      ASSERT_EQ(expected, end) << "offset: " << offset;
+    }
+  }
+}
 }  // namespace shcore
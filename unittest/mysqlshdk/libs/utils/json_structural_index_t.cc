@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/utils/json_structural_index.h"
+
+#include <random>
+#include <string>
+
+#include "unittest/gtest_clean.h"
+
+namespace shcore {
+
+namespace {
+
+struct Expected_block {
+  uint64_t open = 0;
+  uint64_t close = 0;
+};
+
+class Reference_index {
+ public:
+  Expected_block next(const char *p) {
+    Expected_block block;
+
+    for (std::size_t i = 0; i < Json_structural_index::k_block_size; ++i) {
+      const auto c = p[i];
+      const auto bit = uint64_t{1} << i;
+
+      // backslash escapes the next character also outside of a string
+      if (m_escaped) {
+        m_escaped = false;
+      } else if ('\\' == c) {
+        m_escaped = true;
+      } else if (m_in_string) {
+        if ('"' == c) {
+          m_in_string = false;
+        }
+      } else if ('"' == c) {
+        m_in_string = true;
+      } else if ('{' == c || '[' == c) {
+        block.open |= bit;
+      } else if ('}' == c || ']' == c) {
+        block.close |= bit;
+      }
+    }
+
+    return block;
+  }
+
+  bool in_string() const { return m_in_string; }
+
+  bool escaped() const { return m_escaped; }
+
+ private:
+  bool m_in_string = false;
+  bool m_escaped = false;
+};
+
+}  // namespace
+
+TEST(Json_structural_index, strings_and_escapes) {
+  std::string data =
+      R"({"a":"{[\"]}","b":"\\","c":["\\\"}"]} "xxxxxxxxxxxxxxxxxxxxxxxxx)"
+      R"({" [{"d":"\\\\\\\\\"{"}])";
+  data.resize(2 * Json_structural_index::k_block_size, ' ');
+
+  Json_structural_index index;
+  const auto first = index.next(data.data());
+
+  EXPECT_EQ(uint64_t{1} << 0 | uint64_t{1} << 27, first.open);
+  EXPECT_EQ(uint64_t{1} << 35 | uint64_t{1} << 36, first.close);
+  // quote at offset 38 opens a string which spans into the next block
+  EXPECT_TRUE(index.in_string());
+  EXPECT_FALSE(index.escaped());
+
+  const auto second = index.next(data.data() + 64);
+
+  // '{' at offset 0 is inside of the string, as well as the one at offset 20
+  EXPECT_EQ(uint64_t{1} << 3 | uint64_t{1} << 4, second.open);
+  EXPECT_EQ(uint64_t{1} << 22 | uint64_t{1} << 23, second.close);
+  EXPECT_FALSE(index.in_string());
+}
+
+TEST(Json_structural_index, escape_across_blocks) {
+  std::string data(2 * Json_structural_index::k_block_size, ' ');
+  data[0] = '"';
+  // a backslash at the end of a block escapes the first byte of the next one
+  data[63] = '\\';
+  data[64] = '"';
+  data[65] = '"';
+  data[66] = '[';
+
+  Json_structural_index index;
+
+  EXPECT_EQ(uint64_t{0}, index.next(data.data()).open);
+  EXPECT_TRUE(index.in_string());
+  EXPECT_TRUE(index.escaped());
+
+  EXPECT_EQ(uint64_t{1} << 2, index.next(data.data() + 64).open);
+  EXPECT_FALSE(index.in_string());
+  EXPECT_FALSE(index.escaped());
+
+  // state can be restored
+  Json_structural_index resumed{true, true};
+  EXPECT_EQ(uint64_t{1} << 2, resumed.next(data.data() + 64).open);
+}
+
+TEST(Json_structural_index, random) {
+  static constexpr char k_chars[] = "\"\\\\\\{}[]a ";
+  static constexpr std::size_t k_blocks = 64;
+
+  std::mt19937 gen{1234};
+  std::uniform_int_distribution<std::size_t> dist{0, sizeof(k_chars) - 2};
+
+  for (int round = 0; round < 100; ++round) {
+    SCOPED_TRACE("round: " + std::to_string(round));
+
+    std::string data(k_blocks * Json_structural_index::k_block_size, ' ');
+
+    for (auto &c : data) {
+      c = k_chars[dist(gen)];
+    }
+
+    Json_structural_index index;
+    Reference_index reference;
+
+    for (std::size_t i = 0; i < k_blocks; ++i) {
+      const auto p = data.data() + i * Json_structural_index::k_block_size;
+      const auto actual = index.next(p);
+      const auto expected = reference.next(p);
+
+      ASSERT_EQ(expected.open, actual.open) << "block: " << i;
+      ASSERT_EQ(expected.close, actual.close) << "block: " << i;
+      ASSERT_EQ(reference.in_string(), index.in_string()) << "block: " << i;
+      ASSERT_EQ(reference.escaped(), index.escaped()) << "block: " << i;
+    }
+  }
+}
+
+TEST(Json_structural_index, find_quote_or_backslash) {
+  for (std::size_t length = 0; length < 100; ++length) {
+    std::string data(length, 'x');
+    const auto begin = data.data();
+    const auto end = begin + length;
+
+    EXPECT_EQ(end, Json_structural_index::find_quote_or_backslash(begin, end));
+
+    for (std::size_t i = 0; i < length; ++i) {
+      data[i] = 0 == i % 2 ? '"' : '\\';
+
+      EXPECT_EQ(begin + i,
+                Json_structural_index::find_quote_or_backslash(begin, end));
+
+      data[i] = 'x';
+    }
+  }
+}
+
+}  // namespace shcore
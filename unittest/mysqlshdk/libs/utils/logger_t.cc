@@ -26,6 +26,8 @@
 #include <fstream>
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "unittest/gtest_clean.h"
 #include "unittest/test_utils/mocks/gmock_clean.h"
@@ -254,6 +256,84 @@ TEST_F(Logger_test, log_format) {
   EXPECT_TRUE(tests.empty());
 }
 
+TEST_F(Logger_test, async) {
+  const auto name = get_log_file("mylog.txt");
+  shcore::on_leave_scope scope_leave([&name]() {
+    if (!shcore::is_folder(name)) {
+      shcore::delete_file(name);
+    }
+  });
+
+  constexpr int k_threads = 8;
+  constexpr int k_messages = 10000;
+
+  {
+    mysqlsh::Scoped_logger logger(Logger::create_instance(
+        name.c_str(), false, Logger::LOG_INFO, true));
+
+    const auto l = current_logger();
+    EXPECT_TRUE(l->is_async());
+
+    l->log(Logger::LOG_INFO, "First");
+    l->flush();
+
+    std::string contents;
+    EXPECT_TRUE(get_log_file_contents("mylog.txt", &contents));
+    EXPECT_THAT(contents, ::testing::HasSubstr(": Info: First\n"));
+
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < k_threads; ++t) {
+      threads.emplace_back([t]() {
+        for (int i = 0; i < k_messages; ++i) {
+          log_info("thread %d message %d", t, i);
+
+          if (0 == i % 1000) {
+            // bigger than the buffer of a thread, written directly
+            log_info("%s", std::string(100000, 'x').c_str());
+          }
+        }
+      });
+    }
+
+    for (auto &t : threads) {
+      t.join();
+    }
+
+    // remaining messages are written when logger is destroyed
+  }
+
+  std::string contents;
+  EXPECT_TRUE(get_log_file_contents("mylog.txt", &contents));
+
+  std::vector<int> next(k_threads, 0);
+  int big = 0;
+
+  for (const auto &line : shcore::str_split(contents, "\n")) {
+    int t = 0;
+    int i = 0;
+
+    if (const auto pos = line.find(": Info: thread ");
+        std::string::npos != pos &&
+        2 == sscanf(line.c_str() + pos, ": Info: thread %d message %d", &t,
+                    &i)) {
+      ASSERT_LE(0, t);
+      ASSERT_GT(k_threads, t);
+      // messages of a single thread are written in order
+      EXPECT_EQ(next[t], i);
+      next[t] = i + 1;
+    } else if (std::string::npos != line.find(": Info: xxx")) {
+      ++big;
+    }
+  }
+
+  for (const auto n : next) {
+    EXPECT_EQ(k_messages, n);
+  }
+
+  EXPECT_EQ(k_threads * k_messages / 1000, big);
+}
+
 #ifndef _WIN32
 // on Windows Logger is using OutputDebugString() instead of stderr
 
@@ -40,5 +40,23 @@ TEST(ssl, md5) {
   EXPECT_EQ(expected, restricted::md5(data.c_str(), data.length()));
 }
 
+TEST(ssl, sha256_incremental) {
+  const std::string data = "Welcome to Amazon S3.";
+  const auto expected = sha256(data.c_str(), data.length());
+  Sha256 hash;
+
+  for (const auto c : data) {
+    hash.update(&c, 1);
+  }
+
+  EXPECT_EQ(expected, hash.finish());
+
+  // hash can be reused once finished
+  hash.update(data.c_str(), data.length());
+  EXPECT_EQ(expected, hash.finish());
+
+  EXPECT_EQ(sha256("", 0), hash.finish());
+}
+
 }  // namespace ssl
 }  // namespace shcore
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2.0,
+ * as published by the Free Software Foundation.
+ *
+ * This program is designed to work with certain software (including
+ * but not limited to OpenSSL) that is licensed under separate terms,
+ * as designated in a particular file or component or in included license
+ * documentation.  The authors of MySQL hereby grant you an additional
+ * permission to link the program and your derivative works with the
+ * separately licensed software that they have either included with
+ * the program or referenced in the documentation.
+ *
+ * This program is distributed in the hope that it will be useful,  but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See
+ * the GNU General Public License, version 2.0, for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "mysqlshdk/libs/utils/work_stealing_queue.h"
+
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "unittest/gtest_clean.h"
+
+namespace shcore {
+
+TEST(Work_stealing_queue, priorities) {
+  Work_stealing_queue<int> queue{4};
+
+  queue.push(1, Queue_priority::LOW);
+  queue.push(2, Queue_priority::MEDIUM);
+  queue.push(3, Queue_priority::HIGH);
+  queue.push(4, Queue_priority::LOWEST);
+  queue.push(5, Queue_priority::HIGH);
+
+  EXPECT_EQ(5, queue.size());
+
+  // higher priority tasks are taken first, even if they were added to a queue
+  // of a different worker
+  std::set<int> high;
+  high.emplace(queue.pop(0));
+  high.emplace(queue.pop(0));
+  EXPECT_EQ((std::set<int>{3, 5}), high);
+
+  EXPECT_EQ(2, queue.pop(0));
+  EXPECT_EQ(1, queue.pop(0));
+  EXPECT_EQ(4, queue.pop(0));
+
+  EXPECT_EQ(0, queue.size());
+  EXPECT_FALSE(queue.try_pop(0).has_value());
+}
+
+TEST(Work_stealing_queue, local_fifo) {
+  Work_stealing_queue<int> queue{2};
+
+  for (int i = 1; i <= 10; ++i) {
+    queue.push_local(1, i);
+  }
+
+  // worker 1 takes tasks from its own queue in the FIFO order
+  for (int i = 1; i <= 5; ++i) {
+    EXPECT_EQ(i, queue.pop(1));
+  }
+
+  // worker 0 steals the remaining ones
+  for (int i = 6; i <= 10; ++i) {
+    EXPECT_EQ(i, queue.pop(0));
+  }
+}
+
+TEST(Work_stealing_queue, shutdown) {
+  Work_stealing_queue<int> queue{2};
+
+  queue.push(1);
+  queue.push(2);
+  queue.shutdown(2);
+
+  // remaining tasks are taken before the shutdown markers
+  std::set<int> tasks;
+  tasks.emplace(queue.pop(0));
+  tasks.emplace(queue.pop(0));
+  EXPECT_EQ((std::set<int>{1, 2}), tasks);
+
+  EXPECT_EQ(0, queue.pop(0));
+  EXPECT_EQ(0, queue.pop(1));
+}
+
+TEST(Work_stealing_queue, multiple_threads) {
+  constexpr int k_threads = 8;
+  constexpr int k_tasks = 100000;
+
+  Work_stealing_queue<int> queue{k_threads};
+  std::atomic<int64_t> sum{0};
+  std::atomic<int> count{0};
+  std::vector<std::thread> workers;
+
+  for (int i = 0; i < k_threads; ++i) {
+    workers.emplace_back([&, i]() {
+      while (const auto task = queue.pop(i)) {
+        // workers create tasks as well
+        if (task > 0 && task % 2) {
+          queue.push_local(i, -task);
+        }
+
+        sum += task;
+        ++count;
+      }
+    });
+  }
+
+  for (int i = 1; i <= k_tasks; ++i) {
+    queue.push(i, i % 3 ? Queue_priority::MEDIUM : Queue_priority::HIGH);
+  }
+
+  // wait for all tasks created by workers
+  while (count < k_tasks + k_tasks / 2) {
+    std::this_thread::yield();
+  }
+
+  queue.shutdown(k_threads);
+
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  // each odd task is cancelled out by the negative one
+  int64_t expected = 0;
+
+  for (int i = 2; i <= k_tasks; i += 2) {
+    expected += i;
+  }
+
+  EXPECT_EQ(expected, sum);
+  EXPECT_EQ(k_tasks + k_tasks / 2, count);
+  EXPECT_EQ(0, queue.size());
+}
+
+}  // namespace shcore
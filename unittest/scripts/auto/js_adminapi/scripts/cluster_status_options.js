@@ -303,6 +303,8 @@ const extended_2_status_templ_80 = {
                 "mode": "",
                 "readReplicas": {},
                 "role": "",
+                "shellConnectTime": 0,
+                "shellProbeTime": 0,
                 "status": "",
                 "transactions": {
                     "appliedCount": 0,
@@ -346,6 +348,8 @@ const extended_2_status_templ_8023 = {
                 "mode": "",
                 "readReplicas": {},
                 "role": "",
+                "shellConnectTime": 0,
+                "shellProbeTime": 0,
                 "applierWorkerThreads": 4,
                 "status": "",
                 "transactions": {
@@ -391,6 +395,8 @@ const extended_2_status_templ_8026 = {
                 "mode": "",
                 "readReplicas": {},
                 "role": "",
+                "shellConnectTime": 0,
+                "shellProbeTime": 0,
                 "applierWorkerThreads": 4,
                 "status": "",
                 "transactions": {
@@ -438,6 +444,8 @@ const extended_2_status_templ_57 = {
                 "mode": "",
                 "readReplicas": {},
                 "role": "",
+                "shellConnectTime": 0,
+                "shellProbeTime": 0,
                 "status": "",
                 "transactions": {
                     "checkedCount": 0,
@@ -476,6 +484,8 @@ const full_status_templ_80 = {
                 "mode": "",
                 "readReplicas": {},
                 "role": "",
+                "shellConnectTime": 0,
+                "shellProbeTime": 0,
                 "status": "",
                 "version": __version,
                 "transactions": {
@@ -561,6 +571,8 @@ const full_status_templ_8023 = {
                 "readReplicas": {},
                 "replicationLag": "",
                 "role": "",
+                "shellConnectTime": 0,
+                "shellProbeTime": 0,
                 "applierWorkerThreads": 4,
                 "status": "",
                 "version": __version,
@@ -655,6 +667,8 @@ const full_status_templ_57 = {
                 "mode": "",
                 "readReplicas": {},
                 "role": "",
+                "shellConnectTime": 0,
+                "shellProbeTime": 0,
                 "status": "",
                 "version": __version,
                 "transactions": {
@@ -868,6 +882,15 @@ EXPECT_NE(undefined, fence_sys_vars);
 var transactions = json_find_key(stat, "transactions");
 EXPECT_NE(undefined, transactions);
 
+//@<> extended: 2 includes the time spent connecting to and probing each member
+var topology = stat["defaultReplicaSet"]["topology"];
+for (var member in topology) {
+    EXPECT_EQ("Number", type(topology[member]["shellConnectTime"]), member);
+    EXPECT_LE(0, topology[member]["shellConnectTime"], member);
+    EXPECT_EQ("Number", type(topology[member]["shellProbeTime"]), member);
+    EXPECT_LE(0, topology[member]["shellProbeTime"], member);
+}
+
 // TS1_2 - Verify that information about additional transactions stats is not printed when using cluster.status() and the option extended is not given or is set to false.
 //@<> F2- default 8.0 {VER(>=8.0)}
 var stat = cluster.status();
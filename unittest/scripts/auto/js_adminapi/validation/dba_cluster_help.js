@@ -1153,7 +1153,8 @@ DESCRIPTION
         states as reported by Group Replication and the list of fenced system
         variables;
       - 2: includes information about transactions processed by connection and
-        applier;
+        applier, as well as the time taken by the Shell to connect to and query
+        each cluster member;
       - 3: includes more detailed stats about the replication machinery of each
         cluster member;
       - Boolean: equivalent to assign either 0 (false) or 1 (true).
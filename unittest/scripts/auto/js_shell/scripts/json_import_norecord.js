@@ -461,6 +461,34 @@ EXPECT_THROWS(
     },
     "tableColumn cannot be used with collection.");
 
+//@<> Import using multiple threads
+const threads_file = __tmp_dir + '/json_import_threads.json';
+const threads_docs = 20000;
+const threads_pad = 'x'.repeat(64);
+var threads_data = '';
+
+for (var i = 1; i <= threads_docs; ++i) {
+  threads_data += `{"_id": "${i}", "n": ${i}, "pad": "${threads_pad}"}\n`;
+}
+
+testutil.createFile(threads_file, threads_data);
+// file needs to be big enough to be split between the threads
+EXPECT_LT(1024 * 1024, threads_data.length);
+
+util.importJson(threads_file, {schema: target_schema, collection: 'threads_sample', threads: 4});
+EXPECT_STDOUT_CONTAINS(`Total successfully imported documents ${threads_docs} `);
+
+EXPECT_EQ(threads_docs, session.getSchema(target_schema).getCollection('threads_sample').count());
+// each document was imported once
+EXPECT_EQ(threads_docs, session.sql(`SELECT COUNT(DISTINCT doc->>'$.n') FROM \`${target_schema}\`.threads_sample`).execute().fetchOne()[0]);
+
+testutil.rmfile(threads_file);
+
+//@<> Import using invalid number of threads
+EXPECT_THROWS(function() {
+  util.importJson(__import_data_path + '/sample.json', {schema: target_schema, collection: 'threads_sample', threads: 0});
+}, "The value of the 'threads' option must be greater than 0.");
+
 //@ Import document with size greater than mysqlx_max_allowed_packet
 session.close()
 testutil.stopSandbox(target_port, {wait:1});
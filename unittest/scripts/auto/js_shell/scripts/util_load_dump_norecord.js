@@ -1284,6 +1284,98 @@ check_worker_distribution(16, ntables, __tmp_dir+"/ldtest/dump2/load-progress."+
 testutil.rmfile(__tmp_dir+"/ldtest/dump2/load-progress*");
 wipe_instance(session);
 
+//@<> large chunks are split between idle threads - setup
+session.runSql("create schema split_test");
+session.runSql("create table split_test.big (id int primary key, value text)");
+// ~100MB of data, more than 64MB have to be left to load for a chunk to be split
+session.runSql("set @@session.cte_max_recursion_depth = 100000");
+session.runSql("insert into split_test.big with recursive n(i) as (select 1 union all select i + 1 from n where i < 100000) select i, repeat(md5(i), 32) from n");
+const split_test_checksum = session.runSql("checksum table split_test.big").fetchOne()[1];
+
+// data is written to a single chunk file, zstd files are seekable if frameSize is set
+util.dumpSchemas(["split_test"], __tmp_dir+"/ldtest/dump-split-zstd", {chunking: false, compression: "zstd;frameSize=8M", showProgress: false});
+util.dumpSchemas(["split_test"], __tmp_dir+"/ldtest/dump-split-gzip", {chunking: false, compression: "gzip", showProgress: false});
+
+const split_test_log_level = shell.options.logLevel;
+shell.options.logLevel = "debug";
+
+//@<> large chunks are split between idle threads - seekable file
+wipe_instance(session);
+WIPE_SHELL_LOG();
+
+util.loadDump(__tmp_dir+"/ldtest/dump-split-zstd", {threads: 4, showProgress: false});
+
+// table is not chunked, its data is in a single file
+EXPECT_SHELL_LOG_CONTAINS("Splitting `split_test`.`big` at offset");
+EXPECT_SHELL_LOG_CONTAINS(" starting at offset ");
+EXPECT_SHELL_LOG_NOT_CONTAINS("unable to split");
+EXPECT_EQ(100000, session.runSql("select count(*) from split_test.big").fetchOne()[0]);
+EXPECT_EQ(split_test_checksum, session.runSql("checksum table split_test.big").fetchOne()[1]);
+
+//@<> large chunks are split between idle threads - gzip files are not split
+wipe_instance(session);
+WIPE_SHELL_LOG();
+
+util.loadDump(__tmp_dir+"/ldtest/dump-split-gzip", {threads: 4, showProgress: false});
+
+EXPECT_SHELL_LOG_NOT_CONTAINS("Splitting `split_test`.`big`");
+EXPECT_EQ(100000, session.runSql("select count(*) from split_test.big").fetchOne()[0]);
+EXPECT_EQ(split_test_checksum, session.runSql("checksum table split_test.big").fetchOne()[1]);
+
+//@<> large chunks are split between idle threads - cleanup
+shell.options.logLevel = split_test_log_level;
+testutil.rmdir(__tmp_dir+"/ldtest/dump-split-zstd", true);
+testutil.rmdir(__tmp_dir+"/ldtest/dump-split-gzip", true);
+wipe_instance(session);
+
+//@<> deferred foreign keys are recreated before triggers - setup
+wipe_instance(session);
+
+const fk_trg_schemas = ["fk_trg_1", "fk_trg_2", "fk_trg_3"];
+
+for (const schema of fk_trg_schemas) {
+  session.runSql(`CREATE SCHEMA ${schema}`);
+  session.runSql(`CREATE TABLE ${schema}.parent (id INT PRIMARY KEY)`);
+  session.runSql(`CREATE TABLE ${schema}.child (id INT PRIMARY KEY, pid INT, inserted INT DEFAULT 0, FOREIGN KEY (pid) REFERENCES ${schema}.parent (id))`);
+  session.runSql(`CREATE TRIGGER ${schema}.child_bi BEFORE INSERT ON ${schema}.child FOR EACH ROW SET NEW.inserted = 1`);
+  session.runSql(`INSERT INTO ${schema}.parent VALUES (1), (2)`);
+  session.runSql(`INSERT INTO ${schema}.child (id, pid) VALUES (1, 1)`);
+}
+
+// foreign key which references a table in another schema
+session.runSql("ALTER TABLE fk_trg_2.child ADD COLUMN ext INT, ADD FOREIGN KEY (ext) REFERENCES fk_trg_1.parent (id)");
+
+util.dumpSchemas(fk_trg_schemas, __tmp_dir+"/ldtest/dump-fk-trg", {showProgress: false});
+
+//@<> deferred foreign keys are recreated before triggers
+wipe_instance(session);
+WIPE_SHELL_LOG();
+
+EXPECT_NO_THROWS(() => util.loadDump(__tmp_dir+"/ldtest/dump-fk-trg", {threads: 4, deferTableIndexes: "all", showProgress: false}));
+
+const fk_trg_log = testutil.catFile(testutil.getShellLogPath());
+const last_fk = fk_trg_log.lastIndexOf("Recreating FOREIGN KEY constraints for schema");
+const first_trigger = fk_trg_log.indexOf("Executing triggers SQL for");
+
+EXPECT_NE(-1, last_fk);
+EXPECT_NE(-1, first_trigger);
+EXPECT_LT(last_fk, first_trigger, "foreign keys should be recreated before the triggers");
+
+const fk_trg_in = fk_trg_schemas.map(s => `'${s}'`).join(", ");
+EXPECT_EQ(4, session.runSql(`SELECT COUNT(*) FROM information_schema.referential_constraints WHERE constraint_schema IN (${fk_trg_in})`).fetchOne()[0]);
+EXPECT_EQ(3, session.runSql(`SELECT COUNT(*) FROM information_schema.triggers WHERE trigger_schema IN (${fk_trg_in})`).fetchOne()[0]);
+
+for (const schema of fk_trg_schemas) {
+  // both the trigger and the foreign key are active
+  session.runSql(`INSERT INTO ${schema}.child (id, pid) VALUES (2, 2)`);
+  EXPECT_EQ(1, session.runSql(`SELECT inserted FROM ${schema}.child WHERE id = 2`).fetchOne()[0]);
+  EXPECT_THROWS(() => session.runSql(`INSERT INTO ${schema}.child (id, pid) VALUES (3, 3)`), "a foreign key constraint fails");
+}
+
+//@<> deferred foreign keys are recreated before triggers - cleanup
+testutil.rmdir(__tmp_dir+"/ldtest/dump-fk-trg", true);
+wipe_instance(session);
+
 //@<> Load dump with GR running {VER(>=8.0.0)}
 
 testutil.rmfile(__tmp_dir+"/ldtest/dump/load-progress*");
@@ -228,6 +228,11 @@ OPTIONS
 --list=<bool>
             Bool value to indicate the operation should only list the checks.
 
+--threads=<uint>
+            Number of threads used to execute the checks. Each thread other
+            than the first one opens an additional session to the server.
+            Default: 4.
+
 //@<OUT> CLI util copy-instance --help
 NAME
       copy-instance - Copies a source instance to the target instance. Requires
@@ -796,8 +801,15 @@ OPTIONS
 
 --compression=<str>
             Compression used when writing the data dump files, one of: "none",
-            "gzip", "zstd". Compression level may be specified as
-            "gzip;level=8" or "zstd;level=8". Default: "zstd;level=1".
+            "gzip", "zstd", "lz4". Compression level may be specified as
+            "gzip;level=8", "zstd;level=8" or "lz4;level=8". If the maximum
+            uncompressed size of a zstd frame is given, e.g.
+            "zstd;frameSize=8M", files are written in the seekable format,
+            which lets the loader resume an interrupted chunk without
+            decompressing it from the start. The zstd and gzip compressions
+            accept the number of additional compression threads, e.g.
+            "gzip;threads=4"; this number is split among the threads which are
+            dumping the data. Default: "zstd;level=1".
 
 --defaultCharacterSet=<str>
             Character set used for the dump. Default: "utf8mb4".
@@ -840,6 +852,13 @@ OPTIONS
             Sets average estimated number of bytes to be written to each chunk
             file, enables chunking. Default: "64M".
 
+--adaptiveChunking=<bool>
+            Allows chunks of tables which are chunked using an integer column
+            to be split while they are being dumped, if some of the threads are
+            idle. As the number of chunks of such tables is not known up front,
+            their last chunk file is always empty. Cannot be used if chunking
+            is disabled. Default: false.
+
 --threads=<uint>
             Use N threads to dump data chunks from the server. Default: 4.
 
@@ -1044,8 +1063,15 @@ OPTIONS
 
 --compression=<str>
             Compression used when writing the data dump files, one of: "none",
-            "gzip", "zstd". Compression level may be specified as
-            "gzip;level=8" or "zstd;level=8". Default: "zstd;level=1".
+            "gzip", "zstd", "lz4". Compression level may be specified as
+            "gzip;level=8", "zstd;level=8" or "lz4;level=8". If the maximum
+            uncompressed size of a zstd frame is given, e.g.
+            "zstd;frameSize=8M", files are written in the seekable format,
+            which lets the loader resume an interrupted chunk without
+            decompressing it from the start. The zstd and gzip compressions
+            accept the number of additional compression threads, e.g.
+            "gzip;threads=4"; this number is split among the threads which are
+            dumping the data. Default: "zstd;level=1".
 
 --defaultCharacterSet=<str>
             Character set used for the dump. Default: "utf8mb4".
@@ -1088,6 +1114,13 @@ OPTIONS
             Sets average estimated number of bytes to be written to each chunk
             file, enables chunking. Default: "64M".
 
+--adaptiveChunking=<bool>
+            Allows chunks of tables which are chunked using an integer column
+            to be split while they are being dumped, if some of the threads are
+            idle. As the number of chunks of such tables is not known up front,
+            their last chunk file is always empty. Cannot be used if chunking
+            is disabled. Default: false.
+
 --threads=<uint>
             Use N threads to dump data chunks from the server. Default: 4.
 
@@ -1273,8 +1306,15 @@ OPTIONS
 
 --compression=<str>
             Compression used when writing the data dump files, one of: "none",
-            "gzip", "zstd". Compression level may be specified as
-            "gzip;level=8" or "zstd;level=8". Default: "zstd;level=1".
+            "gzip", "zstd", "lz4". Compression level may be specified as
+            "gzip;level=8", "zstd;level=8" or "lz4;level=8". If the maximum
+            uncompressed size of a zstd frame is given, e.g.
+            "zstd;frameSize=8M", files are written in the seekable format,
+            which lets the loader resume an interrupted chunk without
+            decompressing it from the start. The zstd and gzip compressions
+            accept the number of additional compression threads, e.g.
+            "gzip;threads=4"; this number is split among the threads which are
+            dumping the data. Default: "zstd;level=1".
 
 --defaultCharacterSet=<str>
             Character set used for the dump. Default: "utf8mb4".
@@ -1317,6 +1357,13 @@ OPTIONS
             Sets average estimated number of bytes to be written to each chunk
             file, enables chunking. Default: "64M".
 
+--adaptiveChunking=<bool>
+            Allows chunks of tables which are chunked using an integer column
+            to be split while they are being dumped, if some of the threads are
+            idle. As the number of chunks of such tables is not known up front,
+            their last chunk file is always empty. Cannot be used if chunking
+            is disabled. Default: false.
+
 --threads=<uint>
             Use N threads to dump data chunks from the server. Default: 4.
 
@@ -1471,8 +1518,15 @@ OPTIONS
 
 --compression=<str>
             Compression used when writing the data dump files, one of: "none",
-            "gzip", "zstd". Compression level may be specified as
-            "gzip;level=8" or "zstd;level=8". Default: "none".
+            "gzip", "zstd", "lz4". Compression level may be specified as
+            "gzip;level=8", "zstd;level=8" or "lz4;level=8". If the maximum
+            uncompressed size of a zstd frame is given, e.g.
+            "zstd;frameSize=8M", files are written in the seekable format,
+            which lets the loader resume an interrupted chunk without
+            decompressing it from the start. The zstd and gzip compressions
+            accept the number of additional compression threads, e.g.
+            "zstd;threads=8", all of them are used to compress the single
+            output file. Default: "none".
 
 --defaultCharacterSet=<str>
             Character set used for the dump. Default: "utf8mb4".
@@ -1594,6 +1648,9 @@ OPTIONS
             Name of column in target table where the imported JSON documents
             will be stored. Default: "doc".
 
+--threads=<int>
+            Use N threads to parse and insert the documents. Default: 1.
+
 --convertBsonTypes=<bool>
             Enables the BSON data type conversion. Default: false.
 
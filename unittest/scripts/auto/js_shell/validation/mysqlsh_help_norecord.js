@@ -156,6 +156,8 @@ Usage: mysqlsh [OPTIONS] [URI]
   --force                          In SQL batch mode, forces processing to
                                    continue if an error is found.
   --log-file=<path>                Override location of the Shell log file.
+  --log-async                      Write the log file in a background thread,
+                                   in batches.
   --log-level=<value>              Set logging level. The log level value must
                                    be an integer between 1 and 8 or any of
                                    [none, internal, error, warning, info,
@@ -319,6 +319,7 @@
  history.sql.ignorePattern       *IDENTIFIED*:*PASSWORD*
  history.sql.syslog              false
  interactive                     true
+ logAsync                        false
  logFile                         <<<testutil.getShellLogPath()>>>
  logLevel                        5
  logSql                          error
@@ -359,6 +360,7 @@
  history.sql.ignorePattern       *IDENTIFIED*:*PASSWORD* (Compiled default)
  history.sql.syslog              false (Compiled default)
  interactive                     true (Compiled default)
+ logAsync                        false (Compiled default)
  logFile                         <<<testutil.getShellLogPath()>>> (Compiled default)
  logLevel                        5 (Compiled default)
  logSql                          error (Compiled default)
@@ -480,6 +482,7 @@
  history.sql.ignorePattern       *IDENTIFIED*:*PASSWORD*
  history.sql.syslog              false
  interactive                     true
+ logAsync                        false
  logFile                         <<<testutil.getShellLogPath()>>>
  logLevel                        5
  logSql                          error
@@ -521,6 +524,7 @@ Switching to SQL mode... Commands end with ;
  history.sql.ignorePattern       *IDENTIFIED*:*PASSWORD* (Compiled default)
  history.sql.syslog              false (Compiled default)
  interactive                     true (Compiled default)
+ logAsync                        false (Compiled default)
  logFile                         <<<testutil.getShellLogPath()>>> (Compiled default)
  logLevel                        5 (Compiled default)
  logSql                          error (Compiled default)
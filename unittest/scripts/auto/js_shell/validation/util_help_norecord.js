@@ -88,6 +88,9 @@ DESCRIPTION
         excluded from the operation.
       - list - bool value to indicate the operation should only list the
         checks.
+      - threads - number of threads used to execute the checks. Each thread
+        other than the first one opens an additional session to the server.
+        Default: 4.
 
       If targetVersion is not specified, the current shell version will be used
       as target version.
@@ -589,6 +592,11 @@ DESCRIPTION
       - chunking: bool (default: true) - Enable chunking of the tables.
       - bytesPerChunk: string (default: "64M") - Sets average estimated number
         of bytes to be written to each chunk file, enables chunking.
+      - adaptiveChunking: bool (default: false) - Allows chunks of tables which
+        are chunked using an integer column to be split while they are being
+        dumped, if some of the threads are idle. As the number of chunks of
+        such tables is not known up front, their last chunk file is always
+        empty. Cannot be used if chunking is disabled.
       - threads: int (default: 4) - Use N threads to dump data chunks from the
         server.
       - fieldsTerminatedBy: string (default: "\t") - This option has the same
@@ -617,8 +625,14 @@ DESCRIPTION
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the dump.
       - compression: string (default: "zstd;level=1") - Compression used when
-        writing the data dump files, one of: "none", "gzip", "zstd".
-        Compression level may be specified as "gzip;level=8" or "zstd;level=8".
+        writing the data dump files, one of: "none", "gzip", "zstd", "lz4".
+        Compression level may be specified as "gzip;level=8", "zstd;level=8" or
+        "lz4;level=8". If the maximum uncompressed size of a zstd frame is
+        given, e.g. "zstd;frameSize=8M", files are written in the seekable
+        format, which lets the loader resume an interrupted chunk without
+        decompressing it from the start. The zstd and gzip compressions accept
+        the number of additional compression threads, e.g. "gzip;threads=4";
+        this number is split among the threads which are dumping the data.
       - osBucketName: string (default: not set) - Use specified OCI bucket for
         the location of the dump.
       - osNamespace: string (default: not set) - Specifies the namespace where
@@ -1056,6 +1070,11 @@ DESCRIPTION
         if it is set to an empty string, it is not used to authenticate the
         user.
 
+      If the payload_signing_enabled setting from the config file for the
+      specified profile is set to false and the AWS S3 API endpoint uses HTTPS,
+      the uploaded data is not included in the request signatures, its
+      integrity is protected by TLS.
+
       Dumping to a Container in the Azure Blob Storage
 
       If the azureContainerName option is used, the dump is stored in the
@@ -1213,6 +1232,11 @@ DESCRIPTION
       - chunking: bool (default: true) - Enable chunking of the tables.
       - bytesPerChunk: string (default: "64M") - Sets average estimated number
         of bytes to be written to each chunk file, enables chunking.
+      - adaptiveChunking: bool (default: false) - Allows chunks of tables which
+        are chunked using an integer column to be split while they are being
+        dumped, if some of the threads are idle. As the number of chunks of
+        such tables is not known up front, their last chunk file is always
+        empty. Cannot be used if chunking is disabled.
       - threads: int (default: 4) - Use N threads to dump data chunks from the
         server.
       - fieldsTerminatedBy: string (default: "\t") - This option has the same
@@ -1241,8 +1265,14 @@ DESCRIPTION
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the dump.
       - compression: string (default: "zstd;level=1") - Compression used when
-        writing the data dump files, one of: "none", "gzip", "zstd".
-        Compression level may be specified as "gzip;level=8" or "zstd;level=8".
+        writing the data dump files, one of: "none", "gzip", "zstd", "lz4".
+        Compression level may be specified as "gzip;level=8", "zstd;level=8" or
+        "lz4;level=8". If the maximum uncompressed size of a zstd frame is
+        given, e.g. "zstd;frameSize=8M", files are written in the seekable
+        format, which lets the loader resume an interrupted chunk without
+        decompressing it from the start. The zstd and gzip compressions accept
+        the number of additional compression threads, e.g. "gzip;threads=4";
+        this number is split among the threads which are dumping the data.
       - osBucketName: string (default: not set) - Use specified OCI bucket for
         the location of the dump.
       - osNamespace: string (default: not set) - Specifies the namespace where
@@ -1669,6 +1699,11 @@ DESCRIPTION
         if it is set to an empty string, it is not used to authenticate the
         user.
 
+      If the payload_signing_enabled setting from the config file for the
+      specified profile is set to false and the AWS S3 API endpoint uses HTTPS,
+      the uploaded data is not included in the request signatures, its
+      integrity is protected by TLS.
+
       Dumping to a Container in the Azure Blob Storage
 
       If the azureContainerName option is used, the dump is stored in the
@@ -1814,6 +1849,11 @@ DESCRIPTION
       - chunking: bool (default: true) - Enable chunking of the tables.
       - bytesPerChunk: string (default: "64M") - Sets average estimated number
         of bytes to be written to each chunk file, enables chunking.
+      - adaptiveChunking: bool (default: false) - Allows chunks of tables which
+        are chunked using an integer column to be split while they are being
+        dumped, if some of the threads are idle. As the number of chunks of
+        such tables is not known up front, their last chunk file is always
+        empty. Cannot be used if chunking is disabled.
       - threads: int (default: 4) - Use N threads to dump data chunks from the
         server.
       - fieldsTerminatedBy: string (default: "\t") - This option has the same
@@ -1842,8 +1882,14 @@ DESCRIPTION
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the dump.
       - compression: string (default: "zstd;level=1") - Compression used when
-        writing the data dump files, one of: "none", "gzip", "zstd".
-        Compression level may be specified as "gzip;level=8" or "zstd;level=8".
+        writing the data dump files, one of: "none", "gzip", "zstd", "lz4".
+        Compression level may be specified as "gzip;level=8", "zstd;level=8" or
+        "lz4;level=8". If the maximum uncompressed size of a zstd frame is
+        given, e.g. "zstd;frameSize=8M", files are written in the seekable
+        format, which lets the loader resume an interrupted chunk without
+        decompressing it from the start. The zstd and gzip compressions accept
+        the number of additional compression threads, e.g. "gzip;threads=4";
+        this number is split among the threads which are dumping the data.
       - osBucketName: string (default: not set) - Use specified OCI bucket for
         the location of the dump.
       - osNamespace: string (default: not set) - Specifies the namespace where
@@ -2276,6 +2322,11 @@ DESCRIPTION
         if it is set to an empty string, it is not used to authenticate the
         user.
 
+      If the payload_signing_enabled setting from the config file for the
+      specified profile is set to false and the AWS S3 API endpoint uses HTTPS,
+      the uploaded data is not included in the request signatures, its
+      integrity is protected by TLS.
+
       Dumping to a Container in the Azure Blob Storage
 
       If the azureContainerName option is used, the dump is stored in the
@@ -2393,8 +2444,14 @@ DESCRIPTION
       - defaultCharacterSet: string (default: "utf8mb4") - Character set used
         for the dump.
       - compression: string (default: "none") - Compression used when writing
-        the data dump files, one of: "none", "gzip", "zstd". Compression level
-        may be specified as "gzip;level=8" or "zstd;level=8".
+        the data dump files, one of: "none", "gzip", "zstd", "lz4". Compression
+        level may be specified as "gzip;level=8", "zstd;level=8" or
+        "lz4;level=8". If the maximum uncompressed size of a zstd frame is
+        given, e.g. "zstd;frameSize=8M", files are written in the seekable
+        format, which lets the loader resume an interrupted chunk without
+        decompressing it from the start. The zstd and gzip compressions accept
+        the number of additional compression threads, e.g. "zstd;threads=8",
+        all of them are used to compress the single output file.
       - osBucketName: string (default: not set) - Use specified OCI bucket for
         the location of the dump.
       - osNamespace: string (default: not set) - Specifies the namespace where
@@ -2638,6 +2695,11 @@ DESCRIPTION
         if it is set to an empty string, it is not used to authenticate the
         user.
 
+      If the payload_signing_enabled setting from the config file for the
+      specified profile is set to false and the AWS S3 API endpoint uses HTTPS,
+      the uploaded data is not included in the request signatures, its
+      integrity is protected by TLS.
+
       Dumping to a Container in the Azure Blob Storage
 
       If the azureContainerName option is used, the dump is stored in the
@@ -2719,6 +2781,8 @@ DESCRIPTION
       - table: string - name of table where the data will be imported.
       - tableColumn: string (default: "doc") - name of column in target table
         where the imported JSON documents will be stored.
+      - threads: int (default: 1) - use N threads to parse and insert the
+        documents.
       - convertBsonTypes: bool (default: false) - enables the BSON data type
         conversion.
       - convertBsonOid: bool (default: the value of convertBsonTypes) - enables
@@ -2753,6 +2817,12 @@ DESCRIPTION
       The tableColumn implies the use of the table option and cannot be
       combined with the collection option.
 
+      If threads is greater than 1 and the data is read from a file, the file
+      is split into chunks at the boundaries of the JSON documents and the
+      chunks are imported in parallel, each thread using its own session. In
+      this case, the documents are not imported in the order in which they
+      appear in the file.
+
       BSON Data Type Processing.
 
       If only convertBsonOid is enabled, no conversion will be done on the rest
@@ -3057,6 +3127,11 @@ DESCRIPTION
         if it is set to an empty string, it is not used to authenticate the
         user.
 
+      If the payload_signing_enabled setting from the config file for the
+      specified profile is set to false and the AWS S3 API endpoint uses HTTPS,
+      the uploaded data is not included in the request signatures, its
+      integrity is protected by TLS.
+
       Azure Blob Storage Options
 
       - azureContainerName: string (default: not set) - Name of the Azure
@@ -855,6 +855,7 @@ EXPECT_TRUE(os.path.isfile(os.path.join(test_output_absolute, encode_table_basen
 EXPECT_FAIL("ValueError", "Argument #2: Compression options not supported", test_output_relative, {"compression": "none;level=3"})
 EXPECT_FAIL("ValueError", "Argument #2: Invalid compression level for zstd: 9000", test_output_relative, {"compression": "zstd;level=9000"})
 EXPECT_FAIL("ValueError", "Argument #2: Invalid compression level for gzip: 12", test_output_relative, {"compression": "gzip;level=12"})
+EXPECT_FAIL("ValueError", "Argument #2: Invalid number of compression threads for zstd: -1", test_output_relative, {"compression": "zstd;threads=-1"})
 EXPECT_FAIL("ValueError", "Argument #2: Invalid compression option for zstd: superfast", test_output_relative, {"compression": "zstd;superfast=1"})
 EXPECT_FAIL("ValueError", "Argument #2: Invalid compression option for gzip: superfast", test_output_relative, {"compression": "gzip;superfast=1"})
 EXPECT_FAIL("ValueError", "Argument #2: Invalid compression option for zstd: superfast", test_output_relative, {"compression": "zstd;level=2;superfast=1"})
@@ -3956,6 +3957,55 @@ EXPECT_STDOUT_CONTAINS("Checksumming enabled.")
 #@<> WL15947 - cleanup
 session.run_sql("DROP SCHEMA IF EXISTS !;", [schema_name])
 
+#@<> adaptive chunking - setup
+schema_name = "adaptive_chunking"
+test_table_name = "adaptive"
+
+session.run_sql("DROP SCHEMA IF EXISTS !;", [schema_name])
+session.run_sql("CREATE SCHEMA !;", [schema_name])
+session.run_sql("CREATE TABLE !.! (id BIGINT PRIMARY KEY, data VARCHAR(255));", [schema_name, test_table_name])
+# ~4MB of data, with bytesPerChunk set to 1M there are fewer chunks than threads, so idle threads are always available
+session.run_sql("SET @@SESSION.cte_max_recursion_depth = 20000;")
+session.run_sql("INSERT INTO !.! WITH RECURSIVE n(i) AS (SELECT 1 UNION ALL SELECT i + 1 FROM n WHERE i < 20000) SELECT i, REPEAT('x', 200) FROM n;", [schema_name, test_table_name])
+session.run_sql("ANALYZE TABLE !.!;", [schema_name, test_table_name])
+
+basename = encode_table_basename(schema_name, test_table_name)
+
+def data_chunks():
+    return sorted([f for f in os.listdir(test_output_absolute) if f.startswith(basename + "@") and f.endswith(".tsv")])
+
+#@<> adaptive chunking - invalid options
+TEST_BOOL_OPTION("adaptiveChunking")
+EXPECT_FAIL("ValueError", "Argument #2: The option 'adaptiveChunking' cannot be used if the 'chunking' option is set to false.", test_output_absolute, { "adaptiveChunking": True, "chunking": False })
+
+#@<> adaptive chunking - disabled by default
+EXPECT_SUCCESS([schema_name], test_output_absolute, { "bytesPerChunk": "1M", "threads": 8, "compression": "none", "showProgress": False })
+
+static_chunks = data_chunks()
+EXPECT_LT(1, len(static_chunks))
+EXPECT_GT(8, len(static_chunks))
+EXPECT_TRUE(f"{basename}@@{len(static_chunks) - 1}.tsv" in static_chunks)
+EXPECT_NE(0, os.path.getsize(os.path.join(test_output_absolute, f"{basename}@@{len(static_chunks) - 1}.tsv")))
+
+#@<> adaptive chunking - chunks are split by idle threads
+EXPECT_SUCCESS([schema_name], test_output_absolute, { "bytesPerChunk": "1M", "adaptiveChunking": True, "threads": 8, "compression": "none", "showProgress": False })
+
+adaptive_chunks = data_chunks()
+# chunks are numbered consecutively, the final one is empty
+final_chunk = f"{basename}@@{len(adaptive_chunks) - 1}.tsv"
+EXPECT_TRUE(final_chunk in adaptive_chunks)
+EXPECT_EQ(0, os.path.getsize(os.path.join(test_output_absolute, final_chunk)))
+# each chunk holds at least 2 queries worth of data when it's split, so the number of non-empty chunks grows
+EXPECT_LT(len(static_chunks), len(adaptive_chunks) - 1)
+
+for chunk in adaptive_chunks[:-1]:
+    EXPECT_TRUE(os.path.getsize(os.path.join(test_output_absolute, chunk)) > 0, f"chunk {chunk} should not be empty")
+
+TEST_LOAD(schema_name, test_table_name)
+
+#@<> adaptive chunking - cleanup
+session.run_sql("DROP SCHEMA IF EXISTS !;", [schema_name])
+
 #@<> Cleanup
 drop_all_schemas()
 session.run_sql("SET GLOBAL local_infile = false;")
@@ -2868,7 +2868,7 @@ void Testutils::inject_gtid_set(int port, const std::string &gtid_set) {
   auto instance = mysqlshdk::mysql::Instance(session);
 
   auto gtids = mysqlshdk::mysql::Gtid_set::from_string(gtid_set);
-  gtids.normalize(instance);
+  gtids.normalize();
 
   mysqlshdk::mysql::inject_gtid_set(instance, gtids);
 }